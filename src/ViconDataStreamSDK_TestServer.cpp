@@ -0,0 +1,979 @@
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+
+// Synthetic DataStream server.
+//
+// Speaks the CGStream protocol on a TCP port (801 by default) and, optionally, multicast,
+// emitting N subjects x M segments x K markers at a fixed rate. Motion is generated in the
+// same way as VSegmentPoseReader::GenerateTestData. Intended for load testing clients
+// without a Vicon system.
+
+#include <ViconCGStream/ApplicationInfo.h>
+#include <ViconCGStream/Contents.h>
+#include <ViconCGStream/FrameInfo.h>
+#include <ViconCGStream/GlobalSegments.h>
+#include <ViconCGStream/LabeledRecons.h>
+#include <ViconCGStream/LatencyInfo.h>
+#include <ViconCGStream/LocalSegments.h>
+#include <ViconCGStream/ObjectEnums.h>
+#include <ViconCGStream/Ping.h>
+#include <ViconCGStream/RequestFrame.h>
+#include <ViconCGStream/ScopedReader.h>
+#include <ViconCGStream/ScopedWriter.h>
+#include <ViconCGStream/StartMulticastSender.h>
+#include <ViconCGStream/StreamInfo.h>
+#include <ViconCGStream/SubjectInfo.h>
+#include <ViconCGStream/SubjectTopology.h>
+#include <ViconCGStream/UnlabeledRecons.h>
+#include <ViconCGStreamClient/CGStreamReaderWriter.h>
+#include <ViconDataStreamSDKCoreUtils/ClientUtils.h>
+
+#include <boost/asio.hpp>
+#include <boost/thread.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  typedef std::set< ViconCGStreamType::Enum > TEnums;
+  typedef std::array< double, 3 > TVector;
+  typedef std::array< double, 9 > TMatrix;
+
+  const double Pi = 3.14159265358979323846;
+
+  // Ticks per second used by VStreamInfo::m_FramePeriod
+  const double TicksPerSecond = 135000000.0;
+
+  // Largest datagram the multicast client will read
+  const unsigned int MaxDatagramSize = 64 * 1024;
+
+  const ViconCGStreamType::UInt32 NoFrame = 0xFFFFFFFF;
+
+  class VServerSettings
+  {
+  public:
+    VServerSettings()
+    : m_Port( 801 )
+    , m_SubjectCount( 1 )
+    , m_SegmentCount( 1 )
+    , m_MarkerCount( 4 )
+    , m_UnlabeledCount( 0 )
+    , m_FrameRate( 100.0 )
+    , m_Latency( -1.0 )
+    , m_Jitter( -1.0 )
+    , m_MulticastPort( 44801 )
+    , m_bYUp( false )
+    , m_bQuiet( false )
+    {
+    }
+
+    unsigned short m_Port;
+    unsigned int m_SubjectCount;
+    unsigned int m_SegmentCount;
+    unsigned int m_MarkerCount;
+    unsigned int m_UnlabeledCount;
+    double m_FrameRate;
+    // Reported processing latency and jitter in ms; negative values mean one frame period and a tenth of one
+    double m_Latency;
+    double m_Jitter;
+    std::string m_MulticastAddress;
+    unsigned short m_MulticastPort;
+    bool m_bYUp;
+    bool m_bQuiet;
+  };
+
+  TEnums SupportedEnums()
+  {
+    TEnums Enums;
+    Enums.insert( ViconCGStreamEnum::Contents );
+    Enums.insert( ViconCGStreamEnum::StreamInfo );
+    Enums.insert( ViconCGStreamEnum::ApplicationInfo );
+    Enums.insert( ViconCGStreamEnum::SubjectInfo );
+    Enums.insert( ViconCGStreamEnum::SubjectTopology );
+    Enums.insert( ViconCGStreamEnum::FrameInfo );
+    Enums.insert( ViconCGStreamEnum::LatencyInfo );
+    Enums.insert( ViconCGStreamEnum::GlobalSegments );
+    Enums.insert( ViconCGStreamEnum::LocalSegments );
+    Enums.insert( ViconCGStreamEnum::LabeledRecons );
+    Enums.insert( ViconCGStreamEnum::UnlabeledRecons );
+    return Enums;
+  }
+
+  // Row-major rotation about the X axis
+  TMatrix RotationX( double i_Angle )
+  {
+    const double C = std::cos( i_Angle );
+    const double S = std::sin( i_Angle );
+    return TMatrix{ { 1, 0, 0, 0, C, -S, 0, S, C } };
+  }
+
+  // Row-major rotation about the Z axis
+  TMatrix RotationZ( double i_Angle )
+  {
+    const double C = std::cos( i_Angle );
+    const double S = std::sin( i_Angle );
+    return TMatrix{ { C, -S, 0, S, C, 0, 0, 0, 1 } };
+  }
+
+  TVector Apply( const TMatrix & i_rR, const TVector & i_rV, const TVector & i_rT )
+  {
+    return TVector{ { i_rR[ 0 ] * i_rV[ 0 ] + i_rR[ 1 ] * i_rV[ 1 ] + i_rR[ 2 ] * i_rV[ 2 ] + i_rT[ 0 ],
+                      i_rR[ 3 ] * i_rV[ 0 ] + i_rR[ 4 ] * i_rV[ 1 ] + i_rR[ 5 ] * i_rV[ 2 ] + i_rT[ 1 ],
+                      i_rR[ 6 ] * i_rV[ 0 ] + i_rR[ 7 ] * i_rV[ 1 ] + i_rR[ 8 ] * i_rV[ 2 ] + i_rT[ 2 ] } };
+  }
+
+  template< typename T >
+  void Copy( const std::array< double, 3 > & i_rSource, T ( & o_rDest )[ 3 ] )
+  {
+    std::copy( i_rSource.begin(), i_rSource.end(), o_rDest );
+  }
+
+  template< typename T >
+  void Copy( const std::array< double, 9 > & i_rSource, T ( & o_rDest )[ 9 ] )
+  {
+    std::copy( i_rSource.begin(), i_rSource.end(), o_rDest );
+  }
+
+  // The dynamic objects making up one frame. Immutable once published.
+  class VSyntheticFrame
+  {
+  public:
+    ViconCGStream::VFrameInfo m_FrameInfo;
+    ViconCGStream::VLatencyInfo m_LatencyInfo;
+    std::vector< ViconCGStream::VGlobalSegments > m_GlobalSegments;
+    std::vector< ViconCGStream::VLocalSegments > m_LocalSegments;
+    ViconCGStream::VLabeledRecons m_LabeledRecons;
+    ViconCGStream::VUnlabeledRecons m_UnlabeledRecons;
+  };
+
+  // The static description of the scene, and the motion model used to generate frames.
+  class VSyntheticScene
+  {
+  public:
+    explicit VSyntheticScene( const VServerSettings & i_rSettings )
+    : m_Settings( i_rSettings )
+    {
+      m_StreamInfo.m_FramePeriod = static_cast< ViconCGStreamType::Int64 >( TicksPerSecond / m_Settings.m_FrameRate + 0.5 );
+      m_ApplicationInfo.m_AxisOrientation = m_Settings.m_bYUp ? ViconCGStream::VApplicationInfo::EYUp : ViconCGStream::VApplicationInfo::EZUp;
+
+      // Segments form a chain hanging off the root; each child sits 100mm along the parent's Z axis.
+      // Segment ids start at 1 as a parent id of zero denotes the root.
+      for( unsigned int Marker = 0; Marker < m_Settings.m_MarkerCount; ++Marker )
+      {
+        VMarkerLayout Layout;
+        Layout.m_SegmentIndex = Marker % m_Settings.m_SegmentCount;
+        const double Angle = 2.0 * Pi * Marker / m_Settings.m_MarkerCount;
+        Layout.m_Offset = TVector{ { 40.0 * std::cos( Angle ), 40.0 * std::sin( Angle ), 15.0 } };
+        m_MarkerLayout.push_back( Layout );
+      }
+
+      const unsigned int GridSize = static_cast< unsigned int >( std::ceil( std::sqrt( static_cast< double >( m_Settings.m_SubjectCount ) ) ) );
+      for( unsigned int Subject = 0; Subject < m_Settings.m_SubjectCount; ++Subject )
+      {
+        ViconCGStream::VSubjectInfo Info;
+        Info.m_SubjectID = Subject + 1;
+        Info.m_Name = "Subject" + std::to_string( Subject + 1 );
+
+        ViconCGStream::VSubjectTopology Topology;
+        Topology.m_SubjectID = Info.m_SubjectID;
+
+        for( unsigned int Segment = 0; Segment < m_Settings.m_SegmentCount; ++Segment )
+        {
+          ViconCGStreamDetail::VSubjectInfo_Segment SegmentInfo;
+          SegmentInfo.m_SegmentID = Segment + 1;
+          SegmentInfo.m_ParentID = Segment;
+          std::fill( SegmentInfo.m_Bounds, SegmentInfo.m_Bounds + 6, 0.0f );
+          SegmentInfo.m_Name = Segment == 0 ? std::string( "Root" ) : "Segment" + std::to_string( Segment );
+          Info.m_Segments.push_back( SegmentInfo );
+
+          ViconCGStreamDetail::VSubjectTopology_Segment SegmentTopology;
+          SegmentTopology.m_SegmentID = SegmentInfo.m_SegmentID;
+          Copy( SegmentOffset( Segment ), SegmentTopology.m_Translation );
+          Copy( RotationZ( 0.0 ), SegmentTopology.m_Rotation );
+          Topology.m_Segments.push_back( SegmentTopology );
+        }
+
+        for( unsigned int Marker = 0; Marker < m_Settings.m_MarkerCount; ++Marker )
+        {
+          ViconCGStreamDetail::VSubjectInfo_Marker MarkerInfo;
+          MarkerInfo.m_MarkerID = Marker + 1;
+          MarkerInfo.m_Name = "Marker" + std::to_string( Marker + 1 );
+          Info.m_Markers.push_back( MarkerInfo );
+
+          ViconCGStreamDetail::VSubjectInfo_Attachment Attachment;
+          Attachment.m_MarkerID = MarkerInfo.m_MarkerID;
+          Attachment.m_SegmentID = m_MarkerLayout[ Marker ].m_SegmentIndex + 1;
+          Info.m_Attachments.push_back( Attachment );
+        }
+
+        m_SubjectInfo.push_back( Info );
+        m_SubjectTopology.push_back( Topology );
+
+        // Lay the subjects out on a 500mm grid so they do not overlap
+        m_Origins.push_back( TVector{ { 500.0 * ( Subject % GridSize ), 500.0 * ( Subject / GridSize ), 1000.0 } } );
+      }
+    }
+
+    const VServerSettings & Settings() const
+    {
+      return m_Settings;
+    }
+
+    std::shared_ptr< const VSyntheticFrame > Generate( ViconCGStreamType::UInt32 i_FrameID, std::default_random_engine & io_rEngine ) const
+    {
+      std::shared_ptr< VSyntheticFrame > pFrame = std::make_shared< VSyntheticFrame >();
+      pFrame->m_FrameInfo.m_FrameID = i_FrameID;
+
+      const double FramePeriod = 1000.0 / m_Settings.m_FrameRate;
+      const double Latency = m_Settings.m_Latency < 0.0 ? FramePeriod : m_Settings.m_Latency;
+      const double Jitter = m_Settings.m_Jitter < 0.0 ? FramePeriod / 10.0 : m_Settings.m_Jitter;
+      ViconCGStreamDetail::VLatencyInfo_Sample Processing;
+      Processing.m_Name = "Processing";
+      Processing.m_Latency = ClientUtils::JitterVal( io_rEngine, Latency, Jitter, 0.0, 0 ) / 1000.0;
+      pFrame->m_LatencyInfo.m_Samples.push_back( Processing );
+
+      const unsigned int SegmentCount = m_Settings.m_SegmentCount;
+      pFrame->m_GlobalSegments.resize( m_SubjectInfo.size() );
+      pFrame->m_LocalSegments.resize( m_SubjectInfo.size() );
+      pFrame->m_LabeledRecons.m_LabeledRecons.resize( m_SubjectInfo.size() * m_MarkerLayout.size() );
+
+      std::vector< TVector > GlobalT( SegmentCount );
+      std::vector< TMatrix > GlobalR( SegmentCount );
+
+      for( unsigned int Subject = 0; Subject < m_SubjectInfo.size(); ++Subject )
+      {
+        // As VSegmentPoseReader::GenerateTestData, phase shifted per subject
+        const double Angle = ( ( i_FrameID + 10 * Subject ) % 360 ) * Pi / 180.0;
+
+        ViconCGStream::VGlobalSegments & rGlobal = pFrame->m_GlobalSegments[ Subject ];
+        ViconCGStream::VLocalSegments & rLocal = pFrame->m_LocalSegments[ Subject ];
+        rGlobal.m_SubjectID = m_SubjectInfo[ Subject ].m_SubjectID;
+        rLocal.m_SubjectID = rGlobal.m_SubjectID;
+        rGlobal.m_Segments.resize( SegmentCount );
+        rLocal.m_Segments.resize( SegmentCount );
+
+        for( unsigned int Segment = 0; Segment < SegmentCount; ++Segment )
+        {
+          TVector LocalT;
+          TMatrix LocalR;
+          if( Segment == 0 )
+          {
+            const TVector& rOrigin = m_Origins[ Subject ];
+            LocalT = TVector{ { rOrigin[ 0 ] + 10.0 * std::sin( Angle ),
+                                rOrigin[ 1 ] + 10.0 * std::cos( Angle ),
+                                rOrigin[ 2 ] + 10.0 * std::sin( 2 * Angle ) } };
+            LocalR = RotationZ( Angle );
+            GlobalT[ Segment ] = LocalT;
+            GlobalR[ Segment ] = LocalR;
+          }
+          else
+          {
+            LocalT = SegmentOffset( Segment );
+            LocalR = RotationX( 0.2 * std::sin( Angle + Segment ) );
+            GlobalT[ Segment ] = Apply( GlobalR[ Segment - 1 ], LocalT, GlobalT[ Segment - 1 ] );
+            GlobalR[ Segment ] = ClientUtils::operator*( GlobalR[ Segment - 1 ], LocalR );
+          }
+
+          ViconCGStreamDetail::VLocalSegments_Segment & rLocalSegment = rLocal.m_Segments[ Segment ];
+          rLocalSegment.m_SegmentID = Segment + 1;
+          Copy( LocalT, rLocalSegment.m_Translation );
+          Copy( LocalR, rLocalSegment.m_Rotation );
+
+          ViconCGStreamDetail::VGlobalSegments_Segment & rGlobalSegment = rGlobal.m_Segments[ Segment ];
+          rGlobalSegment.m_SegmentID = Segment + 1;
+          Copy( GlobalT[ Segment ], rGlobalSegment.m_Translation );
+          Copy( GlobalR[ Segment ], rGlobalSegment.m_Rotation );
+        }
+
+        for( unsigned int Marker = 0; Marker < m_MarkerLayout.size(); ++Marker )
+        {
+          const VMarkerLayout & rLayout = m_MarkerLayout[ Marker ];
+          ViconCGStreamDetail::VLabeledRecons_LabeledRecon & rRecon = pFrame->m_LabeledRecons.m_LabeledRecons[ Subject * m_MarkerLayout.size() + Marker ];
+          rRecon.m_SubjectID = rGlobal.m_SubjectID;
+          rRecon.m_MarkerID = Marker + 1;
+          rRecon.m_Radius = 7.0;
+          Copy( Apply( GlobalR[ rLayout.m_SegmentIndex ], rLayout.m_Offset, GlobalT[ rLayout.m_SegmentIndex ] ), rRecon.m_Position );
+          std::fill( rRecon.m_Covariance, rRecon.m_Covariance + 9, 0.0 );
+          rRecon.m_TrajectoryId = static_cast< ViconCGStreamType::UInt32 >( Subject * m_MarkerLayout.size() + Marker + 1 );
+        }
+      }
+
+      std::uniform_real_distribution< double > Position( -2000.0, 2000.0 );
+      pFrame->m_UnlabeledRecons.m_UnlabeledRecons.resize( m_Settings.m_UnlabeledCount );
+      for( unsigned int Unlabeled = 0; Unlabeled < m_Settings.m_UnlabeledCount; ++Unlabeled )
+      {
+        ViconCGStreamDetail::VUnlabeledRecons_UnlabeledRecon & rRecon = pFrame->m_UnlabeledRecons.m_UnlabeledRecons[ Unlabeled ];
+        rRecon.m_Radius = 7.0;
+        rRecon.m_Position[ 0 ] = Position( io_rEngine );
+        rRecon.m_Position[ 1 ] = Position( io_rEngine );
+        rRecon.m_Position[ 2 ] = std::abs( Position( io_rEngine ) );
+        std::fill( rRecon.m_Covariance, rRecon.m_Covariance + 9, 0.0 );
+        rRecon.m_TrajectoryId = static_cast< ViconCGStreamType::UInt32 >( m_SubjectInfo.size() * m_MarkerLayout.size() + Unlabeled + 1 );
+      }
+
+      return pFrame;
+    }
+
+    // Write one Objects packet containing those of the requested objects we have.
+    // Static objects are only written when i_bStatic is set; pings are echoed back.
+    void Write( ViconCGStreamIO::VBuffer & o_rBuffer,
+                const VSyntheticFrame * i_pFrame,
+                const TEnums & i_rEnums,
+                bool i_bStatic,
+                const std::vector< ViconCGStreamType::UInt64 > & i_rPings ) const
+    {
+      o_rBuffer.Clear();
+      ViconCGStreamIO::VScopedWriter Objects( o_rBuffer );
+
+      if( i_pFrame )
+      {
+        if( i_rEnums.count( ViconCGStreamEnum::Contents ) )
+        {
+          Objects.Write( ViconCGStream::VContents() );
+        }
+
+        if( i_bStatic )
+        {
+          if( i_rEnums.count( ViconCGStreamEnum::StreamInfo ) )
+          {
+            Objects.Write( m_StreamInfo );
+          }
+          if( i_rEnums.count( ViconCGStreamEnum::ApplicationInfo ) )
+          {
+            Objects.Write( m_ApplicationInfo );
+          }
+          if( i_rEnums.count( ViconCGStreamEnum::SubjectInfo ) )
+          {
+            for( const ViconCGStream::VSubjectInfo & rInfo : m_SubjectInfo )
+            {
+              Objects.Write( rInfo );
+            }
+          }
+          if( i_rEnums.count( ViconCGStreamEnum::SubjectTopology ) )
+          {
+            for( const ViconCGStream::VSubjectTopology & rTopology : m_SubjectTopology )
+            {
+              Objects.Write( rTopology );
+            }
+          }
+        }
+
+        if( i_rEnums.count( ViconCGStreamEnum::FrameInfo ) )
+        {
+          Objects.Write( i_pFrame->m_FrameInfo );
+        }
+        if( i_rEnums.count( ViconCGStreamEnum::LatencyInfo ) )
+        {
+          Objects.Write( i_pFrame->m_LatencyInfo );
+        }
+        if( i_rEnums.count( ViconCGStreamEnum::GlobalSegments ) )
+        {
+          for( const ViconCGStream::VGlobalSegments & rSegments : i_pFrame->m_GlobalSegments )
+          {
+            Objects.Write( rSegments );
+          }
+        }
+        if( i_rEnums.count( ViconCGStreamEnum::LocalSegments ) )
+        {
+          for( const ViconCGStream::VLocalSegments & rSegments : i_pFrame->m_LocalSegments )
+          {
+            Objects.Write( rSegments );
+          }
+        }
+        if( i_rEnums.count( ViconCGStreamEnum::LabeledRecons ) )
+        {
+          Objects.Write( i_pFrame->m_LabeledRecons );
+        }
+        if( i_rEnums.count( ViconCGStreamEnum::UnlabeledRecons ) )
+        {
+          Objects.Write( i_pFrame->m_UnlabeledRecons );
+        }
+      }
+
+      for( const ViconCGStreamType::UInt64 PingID : i_rPings )
+      {
+        ViconCGStream::VPing Ping;
+        Ping.m_PingID = PingID;
+        Objects.Write( Ping );
+      }
+    }
+
+  private:
+    static TVector SegmentOffset( unsigned int i_Segment )
+    {
+      return i_Segment == 0 ? TVector{ { 0.0, 0.0, 0.0 } } : TVector{ { 0.0, 0.0, 100.0 } };
+    }
+
+    class VMarkerLayout
+    {
+    public:
+      unsigned int m_SegmentIndex;
+      TVector m_Offset;
+    };
+
+    VServerSettings m_Settings;
+    ViconCGStream::VStreamInfo m_StreamInfo;
+    ViconCGStream::VApplicationInfo m_ApplicationInfo;
+    std::vector< ViconCGStream::VSubjectInfo > m_SubjectInfo;
+    std::vector< ViconCGStream::VSubjectTopology > m_SubjectTopology;
+    std::vector< VMarkerLayout > m_MarkerLayout;
+    std::vector< TVector > m_Origins;
+  };
+
+  // Holds the most recently generated frame and wakes connections when it changes.
+  class VFrameSource
+  {
+  public:
+    void Publish( std::shared_ptr< const VSyntheticFrame > i_pFrame )
+    {
+      {
+        boost::mutex::scoped_lock Lock( m_Mutex );
+        m_pFrame = i_pFrame;
+      }
+      m_Condition.notify_all();
+    }
+
+    void Notify()
+    {
+      boost::mutex::scoped_lock Lock( m_Mutex );
+      m_Condition.notify_all();
+    }
+
+    // Block until i_Predicate( latest frame ) holds
+    template< typename TPredicate >
+    std::shared_ptr< const VSyntheticFrame > Wait( TPredicate i_Predicate )
+    {
+      boost::mutex::scoped_lock Lock( m_Mutex );
+      while( !i_Predicate( m_pFrame ) )
+      {
+        m_Condition.wait( Lock );
+      }
+      return m_pFrame;
+    }
+
+  private:
+    boost::mutex m_Mutex;
+    boost::condition_variable m_Condition;
+    std::shared_ptr< const VSyntheticFrame > m_pFrame;
+  };
+
+  // Transmits every frame as a single datagram while enabled.
+  class VMulticastSender
+  {
+  public:
+    explicit VMulticastSender( boost::asio::io_service & i_rService )
+    : m_Socket( i_rService )
+    , m_bEnabled( false )
+    , m_bWarned( false )
+    , m_bSentStatic( false )
+    {
+    }
+
+    bool Start( const boost::asio::ip::address_v4 & i_rAddress, unsigned short i_Port )
+    {
+      boost::mutex::scoped_lock Lock( m_Mutex );
+
+      boost::system::error_code Error;
+      if( !m_Socket.is_open() )
+      {
+        m_Socket.open( boost::asio::ip::udp::v4(), Error );
+        if( Error )
+        {
+          return false;
+        }
+        m_Socket.set_option( boost::asio::ip::multicast::hops( 1 ), Error );
+        m_Socket.set_option( boost::asio::socket_base::broadcast( true ), Error );
+      }
+
+      m_Endpoint = boost::asio::ip::udp::endpoint( i_rAddress, i_Port );
+      m_bEnabled = true;
+      return true;
+    }
+
+    void Stop()
+    {
+      boost::mutex::scoped_lock Lock( m_Mutex );
+      m_bEnabled = false;
+    }
+
+    void Send( const VSyntheticScene & i_rScene, const VSyntheticFrame & i_rFrame, bool i_bStatic )
+    {
+      boost::mutex::scoped_lock Lock( m_Mutex );
+      if( !m_bEnabled )
+      {
+        return;
+      }
+
+      // Multicast clients may join at any point, so static objects are repeated periodically
+      i_rScene.Write( m_Buffer, &i_rFrame, SupportedEnums(), i_bStatic || !m_bSentStatic, std::vector< ViconCGStreamType::UInt64 >() );
+      if( m_Buffer.Length() > MaxDatagramSize )
+      {
+        if( !m_bWarned )
+        {
+          std::cerr << "Frame of " << m_Buffer.Length() << " bytes exceeds the multicast datagram limit; not sending" << std::endl;
+          m_bWarned = true;
+        }
+        return;
+      }
+
+      boost::system::error_code Error;
+      m_Socket.send_to( boost::asio::buffer( m_Buffer.Raw(), m_Buffer.Length() ), m_Endpoint, 0, Error );
+      m_bSentStatic = m_bSentStatic || ( !Error && i_bStatic );
+    }
+
+  private:
+    boost::mutex m_Mutex;
+    boost::asio::ip::udp::socket m_Socket;
+    boost::asio::ip::udp::endpoint m_Endpoint;
+    ViconCGStreamIO::VBuffer m_Buffer;
+    bool m_bEnabled;
+    bool m_bWarned;
+    bool m_bSentStatic;
+  };
+
+  // Serves one TCP client. Requests are read on a separate thread; frames are written from Run().
+  class VClientConnection
+  {
+  public:
+    VClientConnection( std::shared_ptr< boost::asio::ip::tcp::socket > i_pSocket,
+                       const VSyntheticScene & i_rScene,
+                       VFrameSource & i_rSource,
+                       VMulticastSender & i_rMulticast )
+    : m_pSocket( i_pSocket )
+    , m_rScene( i_rScene )
+    , m_rSource( i_rSource )
+    , m_rMulticast( i_rMulticast )
+    , m_bEnumsChanged( false )
+    , m_bClosed( false )
+    , m_bStreaming( false )
+    , m_bPending( false )
+    , m_FrameRequests( 0 )
+    , m_NextFrameRequests( 0 )
+    {
+    }
+
+    void Run()
+    {
+      boost::system::error_code Error;
+      m_pSocket->set_option( boost::asio::ip::tcp::no_delay( true ), Error );
+
+      VCGStreamReaderWriter ReaderWriter( m_pSocket );
+      {
+        ViconCGStreamIO::VScopedWriter Objects( ReaderWriter );
+        ViconCGStream::VObjectEnums Supported;
+        Supported.m_Enums = SupportedEnums();
+        Objects.Write( Supported );
+      }
+      if( !ReaderWriter.Flush() )
+      {
+        return;
+      }
+
+      boost::thread ReadThread( &VClientConnection::ReadRequests, this );
+
+      TEnums Enums;
+      bool bSendStatic = false;
+      ViconCGStreamType::UInt32 LastFrameID = NoFrame;
+      std::vector< ViconCGStreamType::UInt64 > Pings;
+
+      for( ;; )
+      {
+        std::shared_ptr< const VSyntheticFrame > pFrame = m_rSource.Wait( [&]( const std::shared_ptr< const VSyntheticFrame > & i_pFrame )
+        {
+          if( m_bClosed || m_bPending )
+          {
+            return true;
+          }
+          if( !i_pFrame )
+          {
+            return false;
+          }
+          return m_FrameRequests > 0 || ( i_pFrame->m_FrameInfo.m_FrameID != LastFrameID && ( m_bStreaming || m_NextFrameRequests > 0 ) );
+        } );
+
+        if( m_bClosed )
+        {
+          break;
+        }
+
+        {
+          boost::mutex::scoped_lock Lock( m_Mutex );
+          if( m_bEnumsChanged )
+          {
+            Enums = m_RequestedEnums;
+            bSendStatic = true;
+            m_bEnumsChanged = false;
+          }
+          Pings.swap( m_Pings );
+          m_bPending = false;
+        }
+
+        bool bSendFrame = false;
+        if( pFrame )
+        {
+          if( m_FrameRequests > 0 )
+          {
+            --m_FrameRequests;
+            bSendFrame = true;
+          }
+          else if( pFrame->m_FrameInfo.m_FrameID != LastFrameID )
+          {
+            if( m_bStreaming )
+            {
+              bSendFrame = true;
+            }
+            else if( m_NextFrameRequests > 0 )
+            {
+              --m_NextFrameRequests;
+              bSendFrame = true;
+            }
+          }
+        }
+
+        if( !bSendFrame && Pings.empty() )
+        {
+          continue;
+        }
+
+        m_rScene.Write( ReaderWriter, bSendFrame ? pFrame.get() : nullptr, Enums, bSendStatic, Pings );
+        if( !ReaderWriter.Flush() )
+        {
+          break;
+        }
+
+        Pings.clear();
+        if( bSendFrame )
+        {
+          LastFrameID = pFrame->m_FrameInfo.m_FrameID;
+          bSendStatic = false;
+        }
+      }
+
+      m_bClosed = true;
+      m_pSocket->shutdown( boost::asio::ip::tcp::socket::shutdown_both, Error );
+      ReadThread.join();
+      m_pSocket->close( Error );
+    }
+
+  private:
+    void ReadRequests()
+    {
+      VCGStreamReaderWriter ReaderWriter( m_pSocket );
+      while( !m_bClosed && ReaderWriter.Fill() )
+      {
+        ViconCGStreamIO::VScopedReader Objects( ReaderWriter );
+        if( Objects.Enum() != ViconCGStreamEnum::Objects )
+        {
+          break;
+        }
+
+        while( Objects.Ok() )
+        {
+          ViconCGStreamIO::VScopedReader Object( ReaderWriter );
+
+          switch( Object.Enum() )
+          {
+          case ViconCGStreamEnum::ObjectEnums:
+            {
+              ViconCGStream::VObjectEnums Requested;
+              if( Object.Read( Requested ) )
+              {
+                boost::mutex::scoped_lock Lock( m_Mutex );
+                m_RequestedEnums = Requested.m_Enums;
+                m_bEnumsChanged = true;
+                m_bPending = true;
+              }
+            }
+            break;
+          case ViconCGStreamEnum::RequestFrame:
+            {
+              ViconCGStream::VRequestFrame Request;
+              if( Object.Read( Request ) )
+              {
+                m_bStreaming = Request.m_bStreaming;
+                if( !Request.m_bStreaming )
+                {
+                  ++m_FrameRequests;
+                }
+              }
+            }
+            break;
+          case ViconCGStreamEnum::RequestNextFrame:
+            ++m_NextFrameRequests;
+            break;
+          case ViconCGStreamEnum::Ping:
+            {
+              ViconCGStream::VPing Ping;
+              if( Object.Read( Ping ) )
+              {
+                boost::mutex::scoped_lock Lock( m_Mutex );
+                m_Pings.push_back( Ping.m_PingID );
+                m_bPending = true;
+              }
+            }
+            break;
+          case ViconCGStreamEnum::StartMulticastSender:
+            {
+              ViconCGStream::VStartMulticastSender Start;
+              if( Object.Read( Start ) )
+              {
+                m_rMulticast.Start( boost::asio::ip::address_v4( Start.m_MulticastIpAddress ), Start.m_Port );
+              }
+            }
+            break;
+          case ViconCGStreamEnum::StopMulticastSender:
+            m_rMulticast.Stop();
+            break;
+          }
+        }
+
+        m_rSource.Notify();
+      }
+
+      m_bClosed = true;
+      m_rSource.Notify();
+    }
+
+    std::shared_ptr< boost::asio::ip::tcp::socket > m_pSocket;
+    const VSyntheticScene & m_rScene;
+    VFrameSource & m_rSource;
+    VMulticastSender & m_rMulticast;
+
+    boost::mutex m_Mutex;
+    TEnums m_RequestedEnums;
+    bool m_bEnumsChanged;
+    std::vector< ViconCGStreamType::UInt64 > m_Pings;
+
+    std::atomic< bool > m_bClosed;
+    std::atomic< bool > m_bStreaming;
+    std::atomic< bool > m_bPending;
+    std::atomic< unsigned int > m_FrameRequests;
+    std::atomic< unsigned int > m_NextFrameRequests;
+  };
+
+  // Generate frames on absolute deadlines so the rate does not drift.
+  void GenerateFrames( const VSyntheticScene & i_rScene, VFrameSource & io_rSource, VMulticastSender & io_rMulticast, const std::atomic< unsigned int > & i_rClientCount )
+  {
+    typedef std::chrono::steady_clock TClock;
+
+    const VServerSettings & rSettings = i_rScene.Settings();
+    const TClock::duration Period = std::chrono::duration_cast< TClock::duration >( std::chrono::duration< double >( 1.0 / rSettings.m_FrameRate ) );
+    const unsigned int FramesPerSecond = std::max( 1u, static_cast< unsigned int >( rSettings.m_FrameRate + 0.5 ) );
+
+    std::default_random_engine Engine;
+    unsigned int Overruns = 0;
+    TClock::time_point Next = TClock::now();
+
+    for( ViconCGStreamType::UInt32 FrameID = 0;; ++FrameID )
+    {
+      std::shared_ptr< const VSyntheticFrame > pFrame = i_rScene.Generate( FrameID, Engine );
+      io_rSource.Publish( pFrame );
+      io_rMulticast.Send( i_rScene, *pFrame, FrameID % FramesPerSecond == 0 );
+
+      if( !rSettings.m_bQuiet && FrameID % ( 5 * FramesPerSecond ) == 0 )
+      {
+        std::cout << "Frame " << FrameID << ": " << i_rClientCount << " client(s), " << Overruns << " overrun(s)" << std::endl;
+      }
+
+      Next += Period;
+      std::this_thread::sleep_until( Next );
+
+      // If we have fallen more than a frame behind, skip ahead rather than sending a burst
+      const TClock::time_point Now = TClock::now();
+      if( Now - Next > Period )
+      {
+        ++Overruns;
+        Next = Now;
+      }
+    }
+  }
+
+  bool SplitAddress( const std::string & i_rAddress, std::string & o_rHost, unsigned short & io_rPort )
+  {
+    const std::string::size_type Colon = i_rAddress.rfind( ':' );
+    o_rHost = i_rAddress.substr( 0, Colon );
+    if( Colon != std::string::npos )
+    {
+      io_rPort = static_cast< unsigned short >( std::atoi( i_rAddress.substr( Colon + 1 ).c_str() ) );
+    }
+    return !o_rHost.empty() && io_rPort != 0;
+  }
+}
+
+int main( int argc, char* argv[] )
+{
+  VServerSettings Settings;
+
+  for( int a = 1; a < argc; ++a )
+  {
+    std::string arg = argv[a];
+    const bool bHasValue = a + 1 < argc;
+    if( arg == "--help" )
+    {
+      std::cout << argv[ 0 ] << ": allowed options include:" << std::endl;
+      std::cout << " --port <Port>                       (default 801)" << std::endl;
+      std::cout << " --subjects <Count>                  (default 1)" << std::endl;
+      std::cout << " --segments <Count>                  per subject (default 1)" << std::endl;
+      std::cout << " --markers <Count>                   per subject (default 4)" << std::endl;
+      std::cout << " --unlabeled <Count>                 (default 0)" << std::endl;
+      std::cout << " --frame-rate <Hz>                   (default 100)" << std::endl;
+      std::cout << " --latency <ms>                      reported processing latency (default one frame)" << std::endl;
+      std::cout << " --jitter <ms>                       (default a tenth of a frame)" << std::endl;
+      std::cout << " --multicast <MulticastAddress:Port> transmit without waiting for a client request" << std::endl;
+      std::cout << " --y-up" << std::endl;
+      std::cout << " --quiet" << std::endl;
+      std::cout << " --help" << std::endl;
+      return 0;
+    }
+    else if( arg == "--port" && bHasValue )
+    {
+      Settings.m_Port = static_cast< unsigned short >( std::atoi( argv[ ++a ] ) );
+    }
+    else if( arg == "--subjects" && bHasValue )
+    {
+      Settings.m_SubjectCount = static_cast< unsigned int >( std::atoi( argv[ ++a ] ) );
+    }
+    else if( arg == "--segments" && bHasValue )
+    {
+      Settings.m_SegmentCount = static_cast< unsigned int >( std::atoi( argv[ ++a ] ) );
+    }
+    else if( arg == "--markers" && bHasValue )
+    {
+      Settings.m_MarkerCount = static_cast< unsigned int >( std::atoi( argv[ ++a ] ) );
+    }
+    else if( arg == "--unlabeled" && bHasValue )
+    {
+      Settings.m_UnlabeledCount = static_cast< unsigned int >( std::atoi( argv[ ++a ] ) );
+    }
+    else if( arg == "--frame-rate" && bHasValue )
+    {
+      Settings.m_FrameRate = std::atof( argv[ ++a ] );
+    }
+    else if( arg == "--latency" && bHasValue )
+    {
+      Settings.m_Latency = std::atof( argv[ ++a ] );
+    }
+    else if( arg == "--jitter" && bHasValue )
+    {
+      Settings.m_Jitter = std::atof( argv[ ++a ] );
+    }
+    else if( arg == "--multicast" && bHasValue )
+    {
+      if( !SplitAddress( argv[ ++a ], Settings.m_MulticastAddress, Settings.m_MulticastPort ) )
+      {
+        std::cerr << "Invalid multicast address " << argv[ a ] << std::endl;
+        return 1;
+      }
+    }
+    else if( arg == "--y-up" )
+    {
+      Settings.m_bYUp = true;
+    }
+    else if( arg == "--quiet" )
+    {
+      Settings.m_bQuiet = true;
+    }
+    else
+    {
+      std::cerr << "Unknown or incomplete option " << arg << "; see --help" << std::endl;
+      return 1;
+    }
+  }
+
+  if( Settings.m_SegmentCount == 0 || Settings.m_FrameRate <= 0.0 )
+  {
+    std::cerr << "At least one segment and a positive frame rate are required" << std::endl;
+    return 1;
+  }
+
+  const VSyntheticScene Scene( Settings );
+  VFrameSource Source;
+  std::atomic< unsigned int > ClientCount( 0 );
+
+  boost::asio::io_service Service;
+  VMulticastSender Multicast( Service );
+  if( !Settings.m_MulticastAddress.empty() )
+  {
+    boost::system::error_code Error;
+    const boost::asio::ip::address_v4 Address = boost::asio::ip::address_v4::from_string( Settings.m_MulticastAddress, Error );
+    if( Error || !Multicast.Start( Address, Settings.m_MulticastPort ) )
+    {
+      std::cerr << "Unable to multicast to " << Settings.m_MulticastAddress << ":" << Settings.m_MulticastPort << std::endl;
+      return 1;
+    }
+  }
+
+  boost::asio::ip::tcp::acceptor Acceptor( Service );
+  try
+  {
+    const boost::asio::ip::tcp::endpoint Endpoint( boost::asio::ip::tcp::v4(), Settings.m_Port );
+    Acceptor.open( Endpoint.protocol() );
+    Acceptor.set_option( boost::asio::socket_base::reuse_address( true ) );
+    Acceptor.bind( Endpoint );
+    Acceptor.listen();
+  }
+  catch( boost::system::system_error & rError )
+  {
+    std::cerr << "Unable to listen on port " << Settings.m_Port << ": " << rError.what() << std::endl;
+    return 1;
+  }
+
+  std::cout << "Serving " << Settings.m_SubjectCount << " subject(s) x " << Settings.m_SegmentCount << " segment(s) x "
+            << Settings.m_MarkerCount << " marker(s) at " << Settings.m_FrameRate << "Hz on port " << Settings.m_Port << std::endl;
+
+  boost::thread Generator( [&]() { GenerateFrames( Scene, Source, Multicast, ClientCount ); } );
+
+  for( ;; )
+  {
+    std::shared_ptr< boost::asio::ip::tcp::socket > pSocket = std::make_shared< boost::asio::ip::tcp::socket >( Service );
+    boost::system::error_code Error;
+    Acceptor.accept( *pSocket, Error );
+    if( Error )
+    {
+      continue;
+    }
+
+    boost::thread( [&Scene, &Source, &Multicast, &ClientCount, pSocket]()
+    {
+      ++ClientCount;
+      VClientConnection Connection( pSocket, Scene, Source, Multicast );
+      Connection.Run();
+      --ClientCount;
+    } ).detach();
+  }
+
+  return 0;
+}
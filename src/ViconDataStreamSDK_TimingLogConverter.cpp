@@ -0,0 +1,68 @@
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+
+// Converts the binary timing logs written by SetTimingLogFile to comma separated values,
+// one row per frame with a column for each latency sample.
+
+#include <ViconCGStreamClient/TimingTrace.h>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+int main( int argc, char* argv[] )
+{
+  if( argc < 2 || argc > 3 || std::string( argv[ 1 ] ) == "--help" )
+  {
+    std::cout << argv[ 0 ] << " <TimingLog> [<CsvFile>]" << std::endl;
+    std::cout << " Writes to standard output if no CsvFile is given" << std::endl;
+    return argc < 2 ? 1 : 0;
+  }
+
+  std::ifstream Trace( argv[ 1 ], std::ios::binary );
+  if( !Trace )
+  {
+    std::cerr << "Could not open " << argv[ 1 ] << std::endl;
+    return 1;
+  }
+
+  std::ofstream CsvFile;
+  if( argc == 3 )
+  {
+    CsvFile.open( argv[ 2 ] );
+    if( !CsvFile )
+    {
+      std::cerr << "Could not create " << argv[ 2 ] << std::endl;
+      return 1;
+    }
+  }
+
+  if( !ConvertTimingTraceToCsv( Trace, argc == 3 ? static_cast< std::ostream & >( CsvFile ) : std::cout ) )
+  {
+    std::cerr << argv[ 1 ] << " is not a timing log" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -33,9 +33,12 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  *********************************************************************/
 
+#include <atomic>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 // ROS
 #include <ros/ros.h>
@@ -135,19 +138,219 @@ class SegmentPublisher
 {
 public:
   ros::Publisher pub;
-  bool is_ready;
-  tf::Transform calibration_pose;
+  // Set (with release semantics) by the thread creating the segment once pub, the names and msg are complete.
+  // The publish thread must not touch them before it has seen is_ready.
+  std::atomic<bool> is_ready;
   bool calibrated;
+  string subject_name;
+  string segment_name;
+  string tracked_frame;
+  // Filled and sent again for every frame, so the frame ids are only built once
+  geometry_msgs::TransformStamped msg;
   SegmentPublisher() :
-    is_ready(false), calibration_pose(tf::Pose::getIdentity()),
-        calibrated(false)
+    is_ready(false), calibrated(false), calibration_pose(tf::Pose::getIdentity())
   {
   }
   ;
+
+  // the calibration can be changed by a service call while frames are being published
+  tf::Transform getCalibration() const
+  {
+    boost::mutex::scoped_lock lock(calibration_mutex);
+    return calibration_pose;
+  }
+
+  void setCalibration(const tf::Transform& pose)
+  {
+    boost::mutex::scoped_lock lock(calibration_mutex);
+    calibration_pose = pose;
+  }
+
+private:
+  mutable boost::mutex calibration_mutex;
+  tf::Transform calibration_pose;
 };
 
 typedef map<string, SegmentPublisher> SegmentMap;
 
+// Subjects and segments of the current Vicon topology, with their publishers and DataStream segment handles.
+// The registry is only rebuilt when the topology changes, so reading the poses of a frame needs neither
+// string building nor name lookups.
+struct SegmentRegistry
+{
+  struct Subject
+  {
+    string name;
+    unsigned int first_segment;
+    unsigned int n_segments;
+  };
+
+  struct Segment
+  {
+    string name;
+    SegmentHandle handle;         // DataStream handle; goes stale when the subject list changes
+    SegmentPublisher* publisher;  // owned by the SegmentMap, whose nodes are never erased
+  };
+
+  std::vector<Subject> subjects;
+  std::vector<Segment> segments;
+};
+
+// Flat arrays filled by Client::GetAllMarkerGlobalTranslations, and the names of the labeled markers they list.
+// The names are only looked up again when the layout generation reported with the markers changes.
+struct MarkerBuffers
+{
+  struct Names
+  {
+    string subject, segment, marker;
+  };
+
+  unsigned int labeled_capacity;
+  std::vector<unsigned int> subject_indices;
+  std::vector<unsigned int> segment_indices;
+  std::vector<unsigned int> marker_indices;
+  std::vector<double> translations;
+  std::unique_ptr<bool[]> occluded;
+  unsigned int n_labeled;
+
+  unsigned int unlabeled_capacity;
+  std::vector<double> unlabeled_translations;
+  std::vector<unsigned int> unlabeled_ids;
+  unsigned int n_unlabeled;
+  unsigned int layout_generation;
+
+  std::vector<Names> names;
+  unsigned int names_generation;
+
+  MarkerBuffers() :
+    labeled_capacity(0), n_labeled(0), unlabeled_capacity(0), n_unlabeled(0), layout_generation(0), names_generation(0)
+  {
+  }
+
+  void reserve(unsigned int n_labeled_markers, unsigned int n_unlabeled_markers)
+  {
+    if (n_labeled_markers > labeled_capacity)
+    {
+      labeled_capacity = n_labeled_markers;
+      subject_indices.resize(labeled_capacity);
+      segment_indices.resize(labeled_capacity);
+      marker_indices.resize(labeled_capacity);
+      translations.resize(3 * labeled_capacity);
+      occluded.reset(new bool[labeled_capacity]);
+    }
+    if (n_unlabeled_markers > unlabeled_capacity)
+    {
+      unlabeled_capacity = n_unlabeled_markers;
+      unlabeled_translations.resize(3 * unlabeled_capacity);
+      unlabeled_ids.resize(unlabeled_capacity);
+    }
+  }
+};
+
+// Pose of one segment as read from the DataStream, in Vicon units (mm)
+struct SegmentPose
+{
+  SegmentPublisher* segment;
+  double translation[3];
+  double rotation[4];
+  bool occluded;
+};
+
+// Everything the publisher needs from one Vicon frame. Slots are reused, so the vectors only grow and
+// n_segments / n_markers tell how many entries belong to the current frame.
+struct FrameSample
+{
+  unsigned int frame_number;
+  ros::Time frame_time;
+  std::vector<SegmentPose> segments;
+  size_t n_segments;
+  bool has_markers;
+  std::vector<vicon_bridge::Marker> markers;
+  size_t n_markers;
+  unsigned int n_unlabeled_markers;
+
+  FrameSample() :
+    frame_number(0), n_segments(0), has_markers(false), n_markers(0), n_unlabeled_markers(0)
+  {
+  }
+};
+
+// Bounded single-producer/single-consumer ring with preallocated slots. The producer fills the slot returned by
+// beginWrite() in place and publishes it with endWrite(); the consumer reads front() and releases it with pop().
+// When the ring is full the new frame is rejected and counted as an overrun, so a slow consumer never blocks the
+// producer.
+template<typename T>
+class SpscRing
+{
+public:
+  explicit SpscRing(size_t capacity) :
+    slots_(capacity + 1), head_(0), tail_(0), overruns_(0), high_water_(0)
+  {
+  }
+
+  T* beginWrite()
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (next(head) == tail_.load(std::memory_order_acquire))
+    {
+      overruns_.fetch_add(1, std::memory_order_relaxed);
+      return NULL;
+    }
+    return &slots_[head];
+  }
+
+  void endWrite()
+  {
+    const size_t head = next(head_.load(std::memory_order_relaxed));
+    head_.store(head, std::memory_order_release);
+    const size_t occupancy = size();
+    if (occupancy > high_water_.load(std::memory_order_relaxed))
+    {
+      high_water_.store(occupancy, std::memory_order_relaxed);
+    }
+  }
+
+  T* front()
+  {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire))
+    {
+      return NULL;
+    }
+    return &slots_[tail];
+  }
+
+  void pop()
+  {
+    tail_.store(next(tail_.load(std::memory_order_relaxed)), std::memory_order_release);
+  }
+
+  bool empty() const
+  {
+    return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+  }
+
+  size_t size() const
+  {
+    const size_t head = head_.load(std::memory_order_acquire);
+    const size_t tail = tail_.load(std::memory_order_acquire);
+    return head >= tail ? head - tail : head + slots_.size() - tail;
+  }
+
+  size_t capacity() const { return slots_.size() - 1; }
+  size_t highWater() const { return high_water_.load(std::memory_order_relaxed); }
+  size_t overruns() const { return overruns_.load(std::memory_order_relaxed); }
+
+private:
+  size_t next(size_t i) const { return (i + 1) % slots_.size(); }
+
+  std::vector<T> slots_;
+  std::atomic<size_t> head_;
+  std::atomic<size_t> tail_;
+  std::atomic<size_t> overruns_;
+  std::atomic<size_t> high_water_;
+};
+
 class ViconReceiver
 {
 private:
@@ -165,6 +368,8 @@ private:
   string tracked_frame_suffix_;
   // Publisher
   ros::Publisher marker_pub_;
+  // reused for every frame, so the marker strings keep their storage
+  vicon_bridge::Markers markers_msg_;
   // TF Broadcaster
   tf::TransformBroadcaster tf_broadcaster_;
   //geometry_msgs::PoseStamped vicon_pose;
@@ -173,9 +378,9 @@ private:
   // TODO: Make the following configurable:
   ros::ServiceServer m_grab_vicon_pose_service_server;
   ros::ServiceServer calibrate_segment_server_;
-  unsigned int lastFrameNumber;
-  unsigned int frameCount;
-  unsigned int droppedFrameCount;
+  std::atomic<unsigned int> lastFrameNumber;
+  std::atomic<unsigned int> frameCount;
+  std::atomic<unsigned int> droppedFrameCount;
   ros::Time time_datum;
   unsigned int frame_datum;
   unsigned int n_markers;
@@ -185,13 +390,24 @@ private:
   bool unlabeled_marker_data_enabled;
 
   bool broadcast_tf_, publish_tf_, publish_markers_;
+  bool lazy_decoding_;
+  int executor_threads_;
 
-  bool grab_frames_;
-  // boost::thread grab_frames_thread_;
+  std::atomic<bool> grab_frames_;
+  boost::thread grab_frames_thread_;
   // std::unordered_map<std::string, ros::Publisher> segment_publishers_;
   SegmentMap segment_publishers_;
   boost::mutex segments_mutex_;
   std::vector<std::string> time_log_;
+  SegmentRegistry segment_registry_;
+  MarkerBuffers marker_buffers_;
+  std::vector<geometry_msgs::TransformStamped> transforms_;
+
+  // Hand-off between the acquisition thread (producer) and the publishing thread (consumer)
+  SpscRing<FrameSample> frame_ring_;
+  boost::mutex frame_ready_mutex_;
+  boost::condition_variable frame_ready_;
+  size_t reported_overruns_;
 
   Client vicon_client_;
 
@@ -199,15 +415,19 @@ public:
   void startGrabbing()
   {
     grab_frames_ = true;
-    // test grabbing in the main loop and run an asynchronous spinner instead
-    grabThread();
-    //grab_frames_thread_ = boost::thread(&ViconReceiver::grabThread, this);
+    // frames are acquired on a dedicated thread, while this thread publishes them
+    grab_frames_thread_ = boost::thread(&ViconReceiver::grabThread, this);
+    publishThread();
   }
 
   void stopGrabbing()
   {
     grab_frames_ = false;
-    //grab_frames_thread_.join();
+    frame_ready_.notify_all();
+    if (grab_frames_thread_.joinable())
+    {
+      grab_frames_thread_.join();
+    }
   }
 
   ViconReceiver() :
@@ -218,7 +438,8 @@ public:
     stream_mode_("ClientPull"),
         host_name_(""), tf_ref_frame_id_("world"), tracked_frame_suffix_("vicon"),
         lastFrameNumber(0), frameCount(0), droppedFrameCount(0), frame_datum(0), n_markers(0), n_unlabeled_markers(0),
-        marker_data_enabled(false), unlabeled_marker_data_enabled(false), grab_frames_(false)
+        marker_data_enabled(false), unlabeled_marker_data_enabled(false), grab_frames_(false),
+        frame_ring_(getFrameBufferSize()), reported_overruns_(0)
   {
     // Diagnostics
     diag_updater.add("ViconReceiver Status", this, &ViconReceiver::diagnostics);
@@ -232,6 +453,8 @@ public:
     nh_priv.param("broadcast_transform", broadcast_tf_, true);
     nh_priv.param("publish_transform", publish_tf_, true);
     nh_priv.param("publish_markers", publish_markers_, true);
+    nh_priv.param("lazy_decoding", lazy_decoding_, false);
+    nh_priv.param("executor_threads", executor_threads_, 0);
     if (init_vicon() == false){
       ROS_ERROR("Error while connecting to Vicon. Exiting now.");
       return;
@@ -265,14 +488,35 @@ public:
   }
 
 private:
+  static int getFrameBufferSize()
+  {
+    int frame_buffer_size = 16;
+    ros::NodeHandle("~").param("frame_buffer_size", frame_buffer_size, frame_buffer_size);
+    return max(frame_buffer_size, 1);
+  }
+
   void diagnostics(diagnostic_updater::DiagnosticStatusWrapper& stat)
   {
-    stat.summary(diagnostic_msgs::DiagnosticStatus::OK, "OK");
-    stat.add("latest VICON frame number", lastFrameNumber);
-    stat.add("dropped frames", droppedFrameCount);
-    stat.add("framecount", frameCount);
+    const size_t overruns = frame_ring_.overruns();
+    if (overruns > reported_overruns_)
+    {
+      stat.summary(diagnostic_msgs::DiagnosticStatus::WARN, "publishing falls behind acquisition");
+    }
+    else
+    {
+      stat.summary(diagnostic_msgs::DiagnosticStatus::OK, "OK");
+    }
+    reported_overruns_ = overruns;
+
+    stat.add("latest VICON frame number", lastFrameNumber.load());
+    stat.add("dropped frames", droppedFrameCount.load());
+    stat.add("framecount", frameCount.load());
     stat.add("# markers", n_markers);
     stat.add("# unlabeled markers", n_unlabeled_markers);
+    stat.add("frame buffer size", frame_ring_.capacity());
+    stat.add("frame buffer occupancy", frame_ring_.size());
+    stat.add("frame buffer high-water mark", frame_ring_.highWater());
+    stat.add("frame buffer overruns", overruns);
   }
 
   bool init_vicon()
@@ -282,6 +526,11 @@ private:
     ros::Duration d(1);
     Result::Enum result(Result::Unknown);
 
+    // Frames that overflow the SDK buffer are then dropped without being decoded
+    vicon_client_.SetLazyDecoding(lazy_decoding_);
+    // Non-zero runs the connection on the SDK's shared thread pool instead of a thread of its own
+    vicon_client_.SetExecutorThreads(std::max(executor_threads_, 0));
+
     while (!vicon_client_.IsConnected().Connected)
     {
       vicon_client_.Connect(host_name_);
@@ -335,6 +584,12 @@ private:
     // we don't need the lock anymore, since rest is protected by is_ready
     lock.unlock();
 
+    spub.subject_name = subject_name;
+    spub.segment_name = segment_name;
+    spub.tracked_frame = tracked_frame_suffix_ + "/" + subject_name + "/" + segment_name;
+    spub.msg.header.frame_id = tf_ref_frame_id_;
+    spub.msg.child_frame_id = spub.tracked_frame;
+
     if(publish_tf_)
     {
       spub.pub = nh.advertise<geometry_msgs::TransformStamped>(tracked_frame_suffix_ + "/" + subject_name + "/"
@@ -355,17 +610,15 @@ private:
     if (have_params)
     {
       ROS_INFO("loaded zero pose for %s/%s", subject_name.c_str(), segment_name.c_str());
-      spub.calibration_pose.setRotation(tf::Quaternion(qx, qy, qz, qw));
-      spub.calibration_pose.setOrigin(tf::Vector3(x, y, z));
-      spub.calibration_pose = spub.calibration_pose.inverse();
+      spub.setCalibration(tf::Transform(tf::Quaternion(qx, qy, qz, qw), tf::Vector3(x, y, z)).inverse());
     }
     else
     {
       ROS_WARN("unable to load zero pose for %s/%s", subject_name.c_str(), segment_name.c_str());
-      spub.calibration_pose.setIdentity();
+      spub.setCalibration(tf::Transform::getIdentity());
     }
 
-    spub.is_ready = true;
+    spub.is_ready.store(true, std::memory_order_release);
     ROS_INFO("... done, advertised as \" %s/%s/%s\" ", tracked_frame_suffix_.c_str(), subject_name.c_str(), segment_name.c_str());
 
   }
@@ -377,20 +630,57 @@ private:
 
   void grabThread()
   {
-    ros::Duration d(1.0 / 240.0);  // TODO: Configurable
+    // block on frame arrival; the timeout only bounds how long we take to notice a shutdown
+    const unsigned int wait_timeout_ms = 100;
 
     while (ros::ok() && grab_frames_)
     {
-      while (vicon_client_.GetFrame().Result != Result::Success && ros::ok())
+      const Result::Enum result = vicon_client_.WaitForFrame(wait_timeout_ms).Result;
+      if (result == Result::NoFrame)
       {
-        ROS_INFO("getFrame returned false");
-        d.sleep();
+        continue;
+      }
+      if (result != Result::Success)
+      {
+        // e.g. NotConnected returns immediately, so back off instead of spinning
+        ROS_WARN_THROTTLE(1.0, "WaitForFrame returned %s", Adapt(result).c_str());
+        ros::Duration(0.1).sleep();
+        continue;
       }
       now_time = ros::Time::now();
 
       bool was_new_frame = process_frame();
       ROS_WARN_COND(!was_new_frame, "grab frame returned false");
+    }
+  }
+
+  void publishThread()
+  {
+    while (ros::ok() && grab_frames_)
+    {
+      FrameSample* frame = frame_ring_.front();
+      if (frame == NULL)
+      {
+        boost::mutex::scoped_lock lock(frame_ready_mutex_);
+        // the timeout only bounds how long we take to notice a shutdown
+        frame_ready_.wait_for(lock, boost::chrono::milliseconds(100),
+                              [this]() { return !frame_ring_.empty() || !grab_frames_; });
+        continue;
+      }
 
+      freq_status_.tick();
+
+      if (publish_tf_ || broadcast_tf_)
+      {
+        publish_subjects(*frame);
+      }
+
+      if (frame->has_markers)
+      {
+        publish_markers(*frame);
+      }
+
+      frame_ring_.pop();
       diag_updater.update();
     }
   }
@@ -434,17 +724,35 @@ private:
     }
     else
     {
-      freq_status_.tick();
+      FrameSample* frame = frame_ring_.beginWrite();
+      if (frame == NULL)
+      {
+        ROS_DEBUG_STREAM("frame buffer full, dropping frame " << OutputFrameNum.FrameNumber
+            << " (" << frame_ring_.overruns() << " overruns so far)");
+        return true;
+      }
+
       ros::Duration vicon_latency(vicon_client_.GetLatencyTotal().Total);
+      frame->frame_number = OutputFrameNum.FrameNumber;
+      frame->frame_time = now_time - vicon_latency;
+      frame->n_segments = 0;
+      frame->has_markers = false;
+      frame->n_markers = 0;
 
       if(publish_tf_ || broadcast_tf_)
       {
-        process_subjects(now_time - vicon_latency);
+        process_subjects(*frame);
       }
 
       if(publish_markers_)
       {
-        process_markers(now_time - vicon_latency, lastFrameNumber);
+        process_markers(*frame);
+      }
+
+      frame_ring_.endWrite();
+      {
+        boost::mutex::scoped_lock lock(frame_ready_mutex_);
+        frame_ready_.notify_one();
       }
 
       lastTime = now_time;
@@ -452,94 +760,153 @@ private:
     }
   }
 
-  void process_subjects(const ros::Time& frame_time)
+  void process_subjects(FrameSample& frame)
   {
-    string tracked_frame, subject_name, segment_name;
-    unsigned int n_subjects = vicon_client_.GetSubjectCount().SubjectCount;
-    SegmentMap::iterator pub_it;
-    tf::Transform transform;
-    std::vector<tf::StampedTransform, std::allocator<tf::StampedTransform> > transforms;
-    geometry_msgs::TransformStampedPtr pose_msg(new geometry_msgs::TransformStamped);
-    static unsigned int cnt = 0;
+    if (!read_segment_poses(frame))
+    {
+      rebuild_segment_registry();
+      frame.n_segments = 0;
+      read_segment_poses(frame);
+    }
+  }
 
-    for (unsigned int i_subjects = 0; i_subjects < n_subjects; i_subjects++)
+  // Reads the poses of all registered segments. Returns false if the topology no longer matches the registry.
+  bool read_segment_poses(FrameSample& frame)
+  {
+    // stale handles catch changes to existing subjects; the count catches subjects being added
+    Output_GetSubjectCount subject_count = vicon_client_.GetSubjectCount();
+    if (subject_count.Result != Result::Success || subject_count.SubjectCount != segment_registry_.subjects.size())
     {
+      return false;
+    }
 
-      subject_name = vicon_client_.GetSubjectName(i_subjects).SubjectName;
-      unsigned int n_segments = vicon_client_.GetSegmentCount(subject_name).SegmentCount;
+    if (frame.segments.size() < segment_registry_.segments.size())
+    {
+      frame.segments.resize(segment_registry_.segments.size());
+    }
 
-      for (unsigned int i_segments = 0; i_segments < n_segments; i_segments++)
+    for (size_t i_segment = 0; i_segment < segment_registry_.segments.size(); i_segment++)
+    {
+      const SegmentRegistry::Segment& segment = segment_registry_.segments[i_segment];
+      Output_GetSegmentGlobalPose global_pose = vicon_client_.GetSegmentGlobalPose(segment.handle);
+
+      if (global_pose.Result == Result::InvalidIndex)
+      {
+        return false;
+      }
+
+      if (global_pose.Result == Result::Success)
+      {
+        SegmentPose& pose = frame.segments[frame.n_segments++];
+        pose.segment = segment.publisher;
+        std::copy(global_pose.Translation, global_pose.Translation + 3, pose.translation);
+        std::copy(global_pose.Rotation, global_pose.Rotation + 4, pose.rotation);
+        pose.occluded = global_pose.Occluded;
+      }
+      else
       {
-        segment_name = vicon_client_.GetSegmentName(subject_name, i_segments).SegmentName;
+        ROS_WARN("GetSegmentGlobalPose failed (result = %s), not publishing...", Adapt(global_pose.Result).c_str());
+      }
+    }
+    return true;
+  }
 
-        Output_GetSegmentGlobalTranslation trans = vicon_client_.GetSegmentGlobalTranslation(subject_name, segment_name);
-        Output_GetSegmentGlobalRotationQuaternion quat = vicon_client_.GetSegmentGlobalRotationQuaternion(subject_name,
-                                                                                                        segment_name);
+  void rebuild_segment_registry()
+  {
+    ROS_INFO("subject topology changed, updating segments");
+    segment_registry_.subjects.clear();
+    segment_registry_.segments.clear();
 
-        if (trans.Result == Result::Success && quat.Result == Result::Success)
+    std::vector<std::pair<string, string> > new_segments;
+    unsigned int n_subjects = vicon_client_.GetSubjectCount().SubjectCount;
+    {
+      boost::mutex::scoped_lock lock(segments_mutex_);
+      for (unsigned int i_subjects = 0; i_subjects < n_subjects; i_subjects++)
+      {
+        SegmentRegistry::Subject subject;
+        subject.name = vicon_client_.GetSubjectName(i_subjects).SubjectName;
+        subject.first_segment = segment_registry_.segments.size();
+        subject.n_segments = vicon_client_.GetSegmentCount(subject.name).SegmentCount;
+
+        for (unsigned int i_segments = 0; i_segments < subject.n_segments; i_segments++)
         {
-          if (!trans.Occluded && !quat.Occluded)
+          SegmentRegistry::Segment segment;
+          segment.name = vicon_client_.GetSegmentName(subject.name, i_segments).SegmentName;
+          segment.handle = vicon_client_.GetSegmentHandle(subject.name, segment.name).Handle;
+
+          const size_t n_known = segment_publishers_.size();
+          segment.publisher = &segment_publishers_[subject.name + "/" + segment.name];
+          if (segment_publishers_.size() != n_known)
           {
-            transform.setOrigin(tf::Vector3(trans.Translation[0] / 1000, trans.Translation[1] / 1000,
-                                                  trans.Translation[2] / 1000));
-            transform.setRotation(tf::Quaternion(quat.Rotation[0], quat.Rotation[1], quat.Rotation[2],
-                                                       quat.Rotation[3]));
-
-            tracked_frame = tracked_frame_suffix_ + "/" + subject_name + "/" + segment_name;
-
-            boost::mutex::scoped_try_lock lock(segments_mutex_);
-
-            if (lock.owns_lock())
-            {
-              pub_it = segment_publishers_.find(subject_name + "/" + segment_name);
-              if (pub_it != segment_publishers_.end())
-              {
-                SegmentPublisher & seg = pub_it->second;
-                //ros::Time thisTime = now_time - ros::Duration(latencyInMs / 1000);
-
-                if (seg.is_ready)
-                {
-                  transform = transform * seg.calibration_pose;
-                  transforms.push_back(tf::StampedTransform(transform, frame_time, tf_ref_frame_id_, tracked_frame));
-//                  transform = tf::StampedTransform(flyer_transform, frame_time, tf_ref_frame_id_, tracked_frame);
-//                  tf_broadcaster_.sendTransform(transform);
-
-                  if(publish_tf_)
-                  {
-                    tf::transformStampedTFToMsg(transforms.back(), *pose_msg);
-                    seg.pub.publish(pose_msg);
-                  }
-                }
-              }
-              else
-              {
-                lock.unlock();
-                createSegment(subject_name, segment_name);
-              }
-            }
+            new_segments.push_back(std::make_pair(subject.name, segment.name));
+          }
+          segment_registry_.segments.push_back(segment);
+        }
+        segment_registry_.subjects.push_back(subject);
+      }
+    }
+
+    for (size_t i = 0; i < new_segments.size(); i++)
+    {
+      createSegment(new_segments[i].first, new_segments[i].second);
+    }
+  }
+
+  void publish_subjects(const FrameSample& frame)
+  {
+    static unsigned int cnt = 0;
+
+    size_t n_transforms = 0;
+    for (size_t i_pose = 0; i_pose < frame.n_segments; i_pose++)
+    {
+      const SegmentPose& pose = frame.segments[i_pose];
+      SegmentPublisher & seg = *pose.segment;
+
+      if (!pose.occluded)
+      {
+        if (seg.is_ready.load(std::memory_order_acquire))
+        {
+          tf::Transform transform(tf::Quaternion(pose.rotation[0], pose.rotation[1], pose.rotation[2], pose.rotation[3]),
+                                  tf::Vector3(pose.translation[0] / 1000, pose.translation[1] / 1000,
+                                              pose.translation[2] / 1000));
+          transform = transform * seg.getCalibration();
+          seg.msg.header.stamp = frame.frame_time;
+          tf::transformTFToMsg(transform, seg.msg.transform);
+
+          if(publish_tf_)
+          {
+            // published by reference, as msg is overwritten by the next frame
+            seg.pub.publish(seg.msg);
+          }
+
+          // assigning over an existing slot reuses the storage of its frame id strings
+          if (n_transforms < transforms_.size())
+          {
+            transforms_[n_transforms] = seg.msg;
           }
           else
           {
-            if (cnt % 100 == 0)
-              ROS_WARN_STREAM("" << subject_name <<" occluded, not publishing... " );
+            transforms_.push_back(seg.msg);
           }
-        }
-        else
-        {
-          ROS_WARN("GetSegmentGlobalTranslation/Rotation failed (result = %s, %s), not publishing...",
-              Adapt(trans.Result).c_str(), Adapt(quat.Result).c_str());
+          n_transforms++;
         }
       }
+      else
+      {
+        if (cnt % 100 == 0 && seg.is_ready.load(std::memory_order_acquire))
+          ROS_WARN_STREAM("" << seg.subject_name <<" occluded, not publishing... " );
+      }
     }
 
     if(broadcast_tf_)
     {
-      tf_broadcaster_.sendTransform(transforms);
+      transforms_.resize(n_transforms);
+      tf_broadcaster_.sendTransform(transforms_);
     }
     cnt++;
   }
 
-  void process_markers(const ros::Time& frame_time, unsigned int vicon_frame_num)
+  void process_markers(FrameSample& frame)
   {
     if (marker_pub_.getNumSubscribers() > 0)
     {
@@ -555,70 +922,120 @@ private:
         ROS_ASSERT(vicon_client_.IsUnlabeledMarkerDataEnabled().Enabled);
         unlabeled_marker_data_enabled = true;
       }
-      n_markers = 0;
-      vicon_bridge::Markers markers_msg;
-      markers_msg.header.stamp = frame_time;
-      markers_msg.frame_number = vicon_frame_num;
-      // Count the number of subjects
-      unsigned int SubjectCount = vicon_client_.GetSubjectCount().SubjectCount;
-      // Get labeled markers
-      for (unsigned int SubjectIndex = 0; SubjectIndex < SubjectCount; ++SubjectIndex)
+      if (!read_markers())
       {
-        std::string this_subject_name = vicon_client_.GetSubjectName(SubjectIndex).SubjectName;
-        // Count the number of markers
-        unsigned int num_subject_markers = vicon_client_.GetMarkerCount(this_subject_name).MarkerCount;
-        n_markers += num_subject_markers;
-        //std::cout << "    Markers (" << MarkerCount << "):" << std::endl;
-        for (unsigned int MarkerIndex = 0; MarkerIndex < num_subject_markers; ++MarkerIndex)
-        {
-          vicon_bridge::Marker this_marker;
-          this_marker.marker_name = vicon_client_.GetMarkerName(this_subject_name, MarkerIndex).MarkerName;
-          this_marker.subject_name = this_subject_name;
-          this_marker.segment_name
-              = vicon_client_.GetMarkerParentName(this_subject_name, this_marker.marker_name).SegmentName;
-
-          // Get the global marker translation
-          Output_GetMarkerGlobalTranslation _Output_GetMarkerGlobalTranslation =
-              vicon_client_.GetMarkerGlobalTranslation(this_subject_name, this_marker.marker_name);
-
-          this_marker.translation.x = _Output_GetMarkerGlobalTranslation.Translation[0];
-          this_marker.translation.y = _Output_GetMarkerGlobalTranslation.Translation[1];
-          this_marker.translation.z = _Output_GetMarkerGlobalTranslation.Translation[2];
-          this_marker.occluded = _Output_GetMarkerGlobalTranslation.Occluded;
-
-          markers_msg.markers.push_back(this_marker);
-        }
+        return;
       }
-      // get unlabeled markers
-      unsigned int UnlabeledMarkerCount = vicon_client_.GetUnlabeledMarkerCount().MarkerCount;
-      //ROS_INFO("# unlabeled markers: %d", UnlabeledMarkerCount);
-      n_markers += UnlabeledMarkerCount;
-      n_unlabeled_markers = UnlabeledMarkerCount;
-      for (unsigned int UnlabeledMarkerIndex = 0; UnlabeledMarkerIndex < UnlabeledMarkerCount; ++UnlabeledMarkerIndex)
+      frame.has_markers = true;
+      update_marker_names();
+
+      const MarkerBuffers& buffers = marker_buffers_;
+      // labeled markers first, in subject and marker order, then the unlabeled ones
+      for (unsigned int i_marker = 0; i_marker < buffers.n_labeled; i_marker++)
       {
-        // Get the global marker translation
-        Output_GetUnlabeledMarkerGlobalTranslation _Output_GetUnlabeledMarkerGlobalTranslation =
-            vicon_client_.GetUnlabeledMarkerGlobalTranslation(UnlabeledMarkerIndex);
+        const MarkerBuffers::Names& names = buffers.names[i_marker];
+        vicon_bridge::Marker& this_marker = next_marker(frame);
+        this_marker.marker_name = names.marker;
+        this_marker.subject_name = names.subject;
+        this_marker.segment_name = names.segment;
+        this_marker.translation.x = buffers.translations[3 * i_marker];
+        this_marker.translation.y = buffers.translations[3 * i_marker + 1];
+        this_marker.translation.z = buffers.translations[3 * i_marker + 2];
+        this_marker.occluded = buffers.occluded[i_marker];
+      }
 
-        if (_Output_GetUnlabeledMarkerGlobalTranslation.Result == Result::Success)
-        {
-          vicon_bridge::Marker this_marker;
-          this_marker.translation.x = _Output_GetUnlabeledMarkerGlobalTranslation.Translation[0];
-          this_marker.translation.y = _Output_GetUnlabeledMarkerGlobalTranslation.Translation[1];
-          this_marker.translation.z = _Output_GetUnlabeledMarkerGlobalTranslation.Translation[2];
-          this_marker.occluded = false; // unlabeled markers can't be occluded
-          markers_msg.markers.push_back(this_marker);
-        }
-        else
-        {
-          ROS_WARN("GetUnlabeledMarkerGlobalTranslation failed (result = %s)",
-              Adapt(_Output_GetUnlabeledMarkerGlobalTranslation.Result).c_str());
-        }
+      frame.n_unlabeled_markers = buffers.n_unlabeled;
+      for (unsigned int i_marker = 0; i_marker < buffers.n_unlabeled; i_marker++)
+      {
+        vicon_bridge::Marker& this_marker = next_marker(frame);
+        this_marker.marker_name.clear();
+        this_marker.subject_name.clear();
+        this_marker.segment_name.clear();
+        this_marker.translation.x = buffers.unlabeled_translations[3 * i_marker];
+        this_marker.translation.y = buffers.unlabeled_translations[3 * i_marker + 1];
+        this_marker.translation.z = buffers.unlabeled_translations[3 * i_marker + 2];
+        this_marker.occluded = false; // unlabeled markers can't be occluded
       }
-      marker_pub_.publish(markers_msg);
     }
   }
 
+  // Copy every marker of the current frame into marker_buffers_, growing them if the frame has more markers
+  bool read_markers()
+  {
+    MarkerBuffers& buffers = marker_buffers_;
+    while (true)
+    {
+      MarkerGlobalTranslations request = { buffers.labeled_capacity, buffers.subject_indices.data(),
+                                           buffers.segment_indices.data(), buffers.marker_indices.data(),
+                                           buffers.translations.data(), buffers.occluded.get(),
+                                           buffers.unlabeled_capacity, buffers.unlabeled_translations.data(),
+                                           buffers.unlabeled_ids.data() };
+      Output_GetAllMarkerGlobalTranslations output = vicon_client_.GetAllMarkerGlobalTranslations(request);
+      if (output.Result != Result::Success)
+      {
+        ROS_WARN("GetAllMarkerGlobalTranslations failed (result = %s)", Adapt(output.Result).c_str());
+        return false;
+      }
+      if (output.LabeledMarkerCount <= buffers.labeled_capacity && output.UnlabeledMarkerCount <= buffers.unlabeled_capacity)
+      {
+        buffers.n_labeled = output.LabeledMarkerCount;
+        buffers.n_unlabeled = output.UnlabeledMarkerCount;
+        buffers.layout_generation = output.LayoutGeneration;
+        return true;
+      }
+      // the frame stays the same until the next GetFrame, so simply read it again
+      buffers.reserve(output.LabeledMarkerCount, output.UnlabeledMarkerCount);
+    }
+  }
+
+  void update_marker_names()
+  {
+    MarkerBuffers& buffers = marker_buffers_;
+    // the indices, and so the names, only change together with the layout generation
+    if (buffers.names_generation == buffers.layout_generation && buffers.names.size() == buffers.n_labeled)
+    {
+      return;
+    }
+    buffers.names_generation = buffers.layout_generation;
+
+    std::vector<string> subject_names(vicon_client_.GetSubjectCount().SubjectCount);
+    for (unsigned int i_subject = 0; i_subject < subject_names.size(); i_subject++)
+    {
+      subject_names[i_subject] = vicon_client_.GetSubjectName(i_subject).SubjectName;
+    }
+
+    buffers.names.resize(buffers.n_labeled);
+    for (unsigned int i_marker = 0; i_marker < buffers.n_labeled; i_marker++)
+    {
+      MarkerBuffers::Names& names = buffers.names[i_marker];
+      const unsigned int subject_index = buffers.subject_indices[i_marker];
+      names.subject = subject_index < subject_names.size() ? subject_names[subject_index] : string();
+      // markers without a parent segment report an out of range segment index, so the name stays empty
+      names.segment = vicon_client_.GetSegmentName(names.subject, buffers.segment_indices[i_marker]).SegmentName;
+      names.marker = vicon_client_.GetMarkerName(names.subject, buffers.marker_indices[i_marker]).MarkerName;
+    }
+  }
+
+  static vicon_bridge::Marker& next_marker(FrameSample& frame)
+  {
+    if (frame.n_markers == frame.markers.size())
+    {
+      frame.markers.resize(frame.n_markers + 1);
+    }
+    return frame.markers[frame.n_markers++];
+  }
+
+  void publish_markers(const FrameSample& frame)
+  {
+    n_markers = frame.n_markers;
+    n_unlabeled_markers = frame.n_unlabeled_markers;
+
+    markers_msg_.header.stamp = frame.frame_time;
+    markers_msg_.frame_number = frame.frame_number;
+    markers_msg_.markers.assign(frame.markers.begin(), frame.markers.begin() + frame.n_markers);
+    marker_pub_.publish(markers_msg_);
+  }
+
   bool grabPoseCallback(vicon_bridge::viconGrabPose::Request& req, vicon_bridge::viconGrabPose::Response& resp)
   {
     ROS_INFO("Got request for a VICON pose");
@@ -682,9 +1099,13 @@ private:
     std::string full_name = req.subject_name + "/" + req.segment_name;
     ROS_INFO("trying to calibrate %s", full_name.c_str());
 
+    boost::mutex::scoped_lock lock(segments_mutex_);
     SegmentMap::iterator seg_it = segment_publishers_.find(full_name);
+    const bool found = seg_it != segment_publishers_.end();
+    // map nodes are never erased, so the segment stays valid without the lock
+    lock.unlock();
 
-    if (seg_it == segment_publishers_.end())
+    if (!found)
     {
       ROS_WARN("frame %s not found --> not calibrating", full_name.c_str());
       resp.success = false;
@@ -697,7 +1118,7 @@ private:
     if (seg.calibrated)
     {
       ROS_INFO("%s already calibrated, deleting old calibration", full_name.c_str());
-      seg.calibration_pose.setIdentity();
+      seg.setCalibration(tf::Transform::getIdentity());
     }
 
     vicon_bridge::viconGrabPose::Request grab_req;
@@ -722,7 +1143,7 @@ private:
     t.setRotation(tf::Quaternion(grab_resp.pose.pose.orientation.x, grab_resp.pose.pose.orientation.y,
                                  grab_resp.pose.pose.orientation.z, grab_resp.pose.pose.orientation.w));
 
-    seg.calibration_pose = t.inverse();
+    seg.setCalibration(t.inverse());
 
     // write zero_pose to parameter server
     string param_suffix(full_name + "/zero_pose/");
@@ -67,3 +67,18 @@ public:
 //-------------------------------------------------------------------------------------------------
 };
 
+namespace ViconCGStreamIO
+{
+//-------------------------------------------------------------------------------------------------
+
+/// The in-memory layout matches the stream layout, so arrays of wand points are read and written as a single block.
+template<>
+struct VIsPod< ViconCGStreamDetail::VCameraWand2d_Point >
+{
+  static_assert( sizeof( ViconCGStreamDetail::VCameraWand2d_Point ) == 2 * sizeof( ViconCGStreamType::Double ), "Unexpected padding" );
+  enum { Answer = 1 };
+};
+
+//-------------------------------------------------------------------------------------------------
+};
+
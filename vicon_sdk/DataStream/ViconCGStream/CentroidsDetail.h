@@ -76,3 +76,18 @@ public:
 //-------------------------------------------------------------------------------------------------
 };
 
+namespace ViconCGStreamIO
+{
+//-------------------------------------------------------------------------------------------------
+
+/// The in-memory layout matches the stream layout, so arrays of centroids are read and written as a single block.
+template<>
+struct VIsPod< ViconCGStreamDetail::VCentroids_Centroid >
+{
+  static_assert( sizeof( ViconCGStreamDetail::VCentroids_Centroid ) == 4 * sizeof( ViconCGStreamType::Double ), "Unexpected padding" );
+  enum { Answer = 1 };
+};
+
+//-------------------------------------------------------------------------------------------------
+};
+
@@ -71,3 +71,18 @@ public:
 //-------------------------------------------------------------------------------------------------
 };
 
+namespace ViconCGStreamIO
+{
+//-------------------------------------------------------------------------------------------------
+
+/// The in-memory layout matches the stream layout, so arrays of edge pairs are read and written as a single block.
+template<>
+struct VIsPod< ViconCGStreamDetail::VEdgePairs_EdgePair >
+{
+  static_assert( sizeof( ViconCGStreamDetail::VEdgePairs_EdgePair ) == 3 * sizeof( ViconCGStreamType::Int16 ), "Unexpected padding" );
+  enum { Answer = 1 };
+};
+
+//-------------------------------------------------------------------------------------------------
+};
+
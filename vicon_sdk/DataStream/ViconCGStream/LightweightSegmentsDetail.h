@@ -75,3 +75,18 @@ public:
 //-------------------------------------------------------------------------------------------------
 };
 
+namespace ViconCGStreamIO
+{
+//-------------------------------------------------------------------------------------------------
+
+/// The in-memory layout matches the stream layout, so arrays of segments are read and written as a single block.
+template<>
+struct VIsPod< ViconCGStreamDetail::VLightweightSegments_Segment >
+{
+  static_assert( sizeof( ViconCGStreamDetail::VLightweightSegments_Segment ) == sizeof( ViconCGStreamType::UInt32 ) + 6 * sizeof( ViconCGStreamType::Float ), "Unexpected padding" );
+  enum { Answer = 1 };
+};
+
+//-------------------------------------------------------------------------------------------------
+};
+
@@ -89,6 +89,12 @@ public:
     return m_Enum;
   }
 
+  /// Get the length of the block body, as read from the block header.
+  ViconCGStreamType::UInt32 Length() const
+  {
+    return m_End - m_Start;
+  }
+
   /// Read a single item from the buffer.
   bool Read( ViconCGStream::VItem & o_rItem ) const
   {
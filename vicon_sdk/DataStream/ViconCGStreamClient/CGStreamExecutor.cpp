@@ -0,0 +1,93 @@
+
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+#include "CGStreamExecutor.h"
+
+#include <functional>
+
+std::shared_ptr< VCGStreamExecutor > VCGStreamExecutor::Shared( unsigned int i_ThreadCount )
+{
+  static boost::mutex s_Mutex;
+  static std::weak_ptr< VCGStreamExecutor > s_pExecutor;
+
+  boost::mutex::scoped_lock Lock( s_Mutex );
+  std::shared_ptr< VCGStreamExecutor > pExecutor = s_pExecutor.lock();
+  if( !pExecutor )
+  {
+    pExecutor.reset( new VCGStreamExecutor() );
+    s_pExecutor = pExecutor;
+  }
+
+  pExecutor->Grow( i_ThreadCount );
+  return pExecutor;
+}
+
+VCGStreamExecutor::VCGStreamExecutor()
+: m_pService( std::make_shared< boost::asio::io_service >() )
+{
+  m_pWork = std::make_shared< boost::asio::io_service::work >( *m_pService );
+}
+
+VCGStreamExecutor::~VCGStreamExecutor()
+{
+  m_pWork.reset();
+
+  for( const std::shared_ptr< boost::thread > & rpThread : m_Threads )
+  {
+    // Each thread holds the service, so one that is releasing the executor can finish on its own
+    if( rpThread->get_id() == boost::this_thread::get_id() )
+    {
+      rpThread->detach();
+    }
+    else
+    {
+      rpThread->join();
+    }
+  }
+}
+
+boost::asio::io_service & VCGStreamExecutor::Service()
+{
+  return *m_pService;
+}
+
+unsigned int VCGStreamExecutor::ThreadCount() const
+{
+  boost::mutex::scoped_lock Lock( m_Mutex );
+  return static_cast< unsigned int >( m_Threads.size() );
+}
+
+void VCGStreamExecutor::Grow( unsigned int i_ThreadCount )
+{
+  boost::mutex::scoped_lock Lock( m_Mutex );
+  while( m_Threads.size() < i_ThreadCount )
+  {
+    m_Threads.push_back( std::make_shared< boost::thread >( std::bind( &VCGStreamExecutor::ThreadFunction, m_pService ) ) );
+  }
+}
+
+void VCGStreamExecutor::ThreadFunction( std::shared_ptr< boost::asio::io_service > i_pService )
+{
+  i_pService->run();
+}
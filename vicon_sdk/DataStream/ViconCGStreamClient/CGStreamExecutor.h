@@ -0,0 +1,61 @@
+
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <boost/asio/io_service.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <memory>
+#include <vector>
+
+// A process-wide io_service on which connections in asynchronous mode run their reads and writes,
+// so that any number of connections are serviced by a fixed pool of threads rather than one thread each.
+// The executor lives for as long as any client holds it.
+class VCGStreamExecutor
+{
+public:
+  // Get the shared executor, creating it on first use.
+  // The pool grows to at least i_ThreadCount threads; it does not shrink while the executor is in use.
+  static std::shared_ptr< VCGStreamExecutor > Shared( unsigned int i_ThreadCount );
+
+  ~VCGStreamExecutor();
+
+  boost::asio::io_service & Service();
+
+  unsigned int ThreadCount() const;
+
+private:
+  VCGStreamExecutor();
+
+  void Grow( unsigned int i_ThreadCount );
+
+  static void ThreadFunction( std::shared_ptr< boost::asio::io_service > i_pService );
+
+  mutable boost::mutex m_Mutex;
+  std::shared_ptr< boost::asio::io_service > m_pService;
+  std::shared_ptr< boost::asio::io_service::work > m_pWork;
+  std::vector< std::shared_ptr< boost::thread > > m_Threads;
+};
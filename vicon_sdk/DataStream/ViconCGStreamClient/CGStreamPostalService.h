@@ -24,10 +24,14 @@
 //////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include "CGStreamExecutor.h"
+
 #include <boost/asio/io_service.hpp>
+#include <boost/asio/strand.hpp>
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/thread.hpp>
 
+#include <future>
 #include <memory>
 
 class VCGStreamPostalService
@@ -35,7 +39,27 @@ class VCGStreamPostalService
 public:
   void Post( const std::function< void() >& i_rFunction ) const
   {
-    m_pService->post( i_rFunction );
+    if( m_pStrand )
+    {
+      m_pStrand->post( i_rFunction );
+    }
+    else if( m_pService )
+    {
+      m_pService->post( i_rFunction );
+    }
+  }
+
+  // Deliver posted functions in order on a shared executor rather than on a thread of our own
+  bool StartService( std::shared_ptr< VCGStreamExecutor > i_pExecutor )
+  {
+    boost::mutex::scoped_lock Lock( m_Mutex );
+    if( !m_pWork && !m_pStrand )
+    {
+      m_pExecutor = i_pExecutor;
+      m_pStrand = std::make_shared< boost::asio::io_service::strand >( m_pExecutor->Service() );
+    }
+
+    return true;
   }
 
   bool StartService()
@@ -58,6 +82,17 @@ public:
   bool StopService()
   {
     boost::mutex::scoped_lock Lock( m_Mutex );
+    if( m_pStrand )
+    {
+      // Functions already posted refer to their owner, so let them run before returning
+      std::shared_ptr< std::promise< void > > pDone = std::make_shared< std::promise< void > >();
+      m_pStrand->post( [ pDone ](){ pDone->set_value(); } );
+      pDone->get_future().wait();
+
+      m_pStrand.reset();
+      m_pExecutor.reset();
+      return true;
+    }
     if( m_pWork )
     {
       m_pWork.reset();
@@ -78,4 +113,6 @@ private:
   std::shared_ptr< boost::asio::io_service > m_pService;
   std::shared_ptr< boost::asio::io_service::work > m_pWork;
   boost::thread m_Thread;
+  std::shared_ptr< VCGStreamExecutor > m_pExecutor;
+  std::shared_ptr< boost::asio::io_service::strand > m_pStrand;
 };
@@ -24,8 +24,25 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "CGStreamReaderWriter.h"
 
+#include <algorithm>
+#include <string.h>
+
+#if defined( __linux__ )
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#endif
+
+namespace
+{
+  // Initial size of the TCP staging buffer; it grows to fit the largest block
+  const size_t s_StagingSize = 64 * 1024;
+}
+
 VCGStreamReaderWriter::VCGStreamReaderWriter( std::shared_ptr< boost::asio::ip::tcp::socket > i_pSocket ) 
 : m_pSocket( i_pSocket )
+, m_StagingStart( 0 )
+, m_StagingEnd( 0 )
 {
   // linger on shutdown a bit to ensure close packet arrives
   boost::system::error_code Error;
@@ -34,6 +51,15 @@ VCGStreamReaderWriter::VCGStreamReaderWriter( std::shared_ptr< boost::asio::ip::
 
 VCGStreamReaderWriter::VCGStreamReaderWriter( std::shared_ptr< boost::asio::ip::udp::socket > i_pMulticastSocket ) 
 : m_pMulticastSocket( i_pMulticastSocket  )
+, m_StagingStart( 0 )
+, m_StagingEnd( 0 )
+{
+}
+
+VCGStreamReaderWriter::VCGStreamReaderWriter( std::shared_ptr< VMulticastReceiver > i_pMulticastReceiver ) 
+: m_pMulticastReceiver( i_pMulticastReceiver )
+, m_StagingStart( 0 )
+, m_StagingEnd( 0 )
 {
 }
 
@@ -66,6 +92,11 @@ void VCGStreamReaderWriter::Close()
 
 bool VCGStreamReaderWriter::Fill()
 {
+  if( m_pMulticastReceiver )
+  {
+    return m_pMulticastReceiver->Receive( *this );
+  }
+
   try
   {
     if( m_pMulticastSocket )
@@ -77,17 +108,17 @@ bool VCGStreamReaderWriter::Fill()
     else
     {
       const unsigned int HeaderSize = sizeof( ViconCGStreamType::Enum ) + sizeof( ViconCGStreamType::UInt32 );
-      SetLength( HeaderSize );
-      SetOffset( 0 );
-      boost::asio::read( *m_pSocket, boost::asio::buffer( Raw(), Length() ) );
-      
-      SetOffset( sizeof( ViconCGStreamType::Enum ) );
+      Stage( HeaderSize );
+
       ViconCGStreamType::UInt32 BlockLength = 0;
-      Read( BlockLength );
-      
-      SetLength( Length() + BlockLength );
-      boost::asio::read( *m_pSocket, boost::asio::buffer( Raw() + HeaderSize, BlockLength ) );
-      SetOffset( 0 );
+      memcpy( &BlockLength, Raw() + m_StagingStart + sizeof( ViconCGStreamType::Enum ), sizeof( BlockLength ) );
+
+      const size_t BlockSize = HeaderSize + static_cast< size_t >( BlockLength );
+      Stage( BlockSize );
+
+      // The block is read where it was staged; it stays valid until the next call
+      SetOffset( static_cast< unsigned int >( m_StagingStart ) );
+      m_StagingStart += BlockSize;
     }
 
   } 
@@ -101,13 +132,23 @@ bool VCGStreamReaderWriter::Fill()
 }
 
 bool VCGStreamReaderWriter::Flush()
+{
+  SetOffset( 0 );
+  if( !Flush( *this ) )
+  {
+    return false;
+  }
+
+  Clear();
+  return true;
+}
+
+bool VCGStreamReaderWriter::Flush( const ViconCGStreamIO::VBuffer & i_rBuffer )
 {
   // Will generate an error if called on when initialized with a multicast socket
   try
   {
-    SetOffset( 0 );
-    boost::asio::write( *m_pSocket, boost::asio::buffer( Raw(), Length() ) );
-    Clear();
+    boost::asio::write( *m_pSocket, boost::asio::buffer( i_rBuffer.Raw(), i_rBuffer.Length() ) );
   } 
   catch( boost::system::system_error & rError )
   {
@@ -118,3 +159,39 @@ bool VCGStreamReaderWriter::Flush()
   return true;
 }
 
+
+void VCGStreamReaderWriter::Stage( size_t i_Bytes )
+{
+  if( m_StagingEnd - m_StagingStart >= i_Bytes )
+  {
+    return;
+  }
+
+  // Move the partial block to the front, growing the buffer if the block will not fit
+  if( m_StagingStart != 0 )
+  {
+    std::copy( Raw() + m_StagingStart, Raw() + m_StagingEnd, Raw() );
+    m_StagingEnd -= m_StagingStart;
+    m_StagingStart = 0;
+  }
+  if( Length() < i_Bytes )
+  {
+    SetLength( static_cast< unsigned int >( std::max( i_Bytes, s_StagingSize ) ) );
+  }
+
+  // Take whatever else is available along with the bytes we need
+  while( m_StagingEnd < i_Bytes )
+  {
+    m_StagingEnd += m_pSocket->read_some( boost::asio::buffer( Raw() + m_StagingEnd, Length() - m_StagingEnd ) );
+  }
+
+  EnableQuickAck( *m_pSocket );
+}
+
+void VCGStreamReaderWriter::EnableQuickAck( boost::asio::ip::tcp::socket & i_rSocket )
+{
+#if defined( __linux__ )
+  const int Enable = 1;
+  setsockopt( i_rSocket.native_handle(), IPPROTO_TCP, TCP_QUICKACK, &Enable, sizeof( Enable ) );
+#endif
+}
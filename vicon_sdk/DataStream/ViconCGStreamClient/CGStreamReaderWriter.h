@@ -24,6 +24,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include "MulticastReceiver.h"
 #include <StreamCommon/Buffer.h>
 #include <memory>
 #include <boost/asio.hpp>
@@ -37,6 +38,8 @@ public:
 
   VCGStreamReaderWriter( std::shared_ptr< boost::asio::ip::udp::socket > i_pMulticastSocket );
 
+  VCGStreamReaderWriter( std::shared_ptr< VMulticastReceiver > i_pMulticastReceiver );
+
   // determine if there is data ready to read. Return value indicates if an error occured
   bool DataReady( bool & o_rbDataReady ) const;
 
@@ -47,11 +50,30 @@ public:
   bool IsOpen() const;
 
   // Fill buffer from socket
+  // On TCP this reads as much as the socket has available into the buffer and leaves the offset at the start
+  // of the next complete block, which is parsed in place; the socket is only read when no complete block is staged.
+  // Blocks which are staged but not yet returned are kept, so objects to be sent while reading must be written
+  // to another buffer and sent with Flush( i_rBuffer ).
   bool Fill();
   
   // Flush buffer to socket
   bool Flush();
 
+  // Send another buffer to the socket, leaving this one unchanged
+  bool Flush( const ViconCGStreamIO::VBuffer & i_rBuffer );
+
   std::shared_ptr< boost::asio::ip::tcp::socket > m_pSocket;
   std::shared_ptr< boost::asio::ip::udp::socket > m_pMulticastSocket;
+  std::shared_ptr< VMulticastReceiver > m_pMulticastReceiver;
+
+  // Ask the kernel to acknowledge received data immediately rather than delaying the ack (Linux only).
+  // The kernel may clear this while receiving, so it is repeated after each read.
+  static void EnableQuickAck( boost::asio::ip::tcp::socket & i_rSocket );
+
+private:
+  // Read from the socket until at least i_Bytes are staged in the buffer from m_StagingStart
+  void Stage( size_t i_Bytes );
+
+  size_t m_StagingStart;
+  size_t m_StagingEnd;
 };
@@ -0,0 +1,333 @@
+
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+#include "MulticastReceiver.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string.h>
+
+#if defined( __linux__ )
+#include <errno.h>
+#include <linux/sock_diag.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif
+
+namespace
+{
+  // Largest datagram the server will send
+  const unsigned int s_MaxDatagramSize = 64 * 1024;
+}
+
+#if defined( __linux__ )
+
+// The recvmmsg headers for a batch, along with space for the drop count ancillary data of each datagram
+class VMulticastReceiver::VPlatformBatch
+{
+public:
+  explicit VPlatformBatch( unsigned int i_BatchSize )
+  : m_Headers( i_BatchSize )
+  , m_Vectors( i_BatchSize )
+  , m_Control( i_BatchSize * ControlSize )
+  {
+  }
+
+  static const size_t ControlSize = CMSG_SPACE( sizeof( ViconCGStreamType::UInt32 ) );
+
+  std::vector< mmsghdr > m_Headers;
+  std::vector< iovec > m_Vectors;
+  std::vector< unsigned char > m_Control;
+};
+
+#else
+
+class VMulticastReceiver::VPlatformBatch
+{
+};
+
+#endif
+
+VMulticastReceiver::VMulticastReceiver( std::shared_ptr< boost::asio::ip::udp::socket > i_pSocket, const VMulticastReceiveOptions & i_rOptions )
+: m_pSocket( i_pSocket )
+, m_Options( i_rOptions )
+, m_Next( 0 )
+, m_Count( 0 )
+, m_DatagramsReceived( 0 )
+, m_DatagramsDropped( 0 )
+, m_DatagramsTruncated( 0 )
+, m_BatchesReceived( 0 )
+, m_BatchesFull( 0 )
+, m_SocketBufferSize( 0 )
+, m_bShutdown( false )
+{
+#if defined( __linux__ )
+  const unsigned int BatchSize = std::max( m_Options.m_BatchSize, 1u );
+#else
+  const unsigned int BatchSize = 1;
+#endif
+  m_Datagrams.resize( BatchSize, std::vector< unsigned char >( s_MaxDatagramSize ) );
+  m_Lengths.resize( BatchSize, 0 );
+  m_Truncated.resize( BatchSize, false );
+  m_pPlatformBatch = std::make_shared< VPlatformBatch >( BatchSize );
+}
+
+bool VMulticastReceiver::Configure( boost::system::error_code & o_rError )
+{
+  m_pSocket->set_option( boost::asio::socket_base::receive_buffer_size( m_Options.m_SocketBufferSize ), o_rError );
+  if( o_rError )
+  {
+    return false;
+  }
+
+#if defined( __linux__ )
+  const int Socket = m_pSocket->native_handle();
+
+  // The kernel caps SO_RCVBUF at net.core.rmem_max; privileged processes may exceed it
+  int Granted = 0;
+  socklen_t GrantedSize = sizeof( Granted );
+  if( getsockopt( Socket, SOL_SOCKET, SO_RCVBUF, &Granted, &GrantedSize ) == 0 && static_cast< unsigned int >( Granted ) < m_Options.m_SocketBufferSize )
+  {
+    const int Requested = static_cast< int >( m_Options.m_SocketBufferSize );
+    setsockopt( Socket, SOL_SOCKET, SO_RCVBUFFORCE, &Requested, sizeof( Requested ) );
+  }
+
+  // Ask for the socket's drop count with each datagram
+  const int Enable = 1;
+  setsockopt( Socket, SOL_SOCKET, SO_RXQ_OVFL, &Enable, sizeof( Enable ) );
+#endif
+
+  boost::asio::socket_base::receive_buffer_size Size;
+  boost::system::error_code DontCareError;
+  m_pSocket->get_option( Size, DontCareError );
+  m_SocketBufferSize = static_cast< ViconCGStreamType::UInt64 >( Size.value() );
+  return true;
+}
+
+bool VMulticastReceiver::Receive( ViconCGStreamIO::VBuffer & o_rBuffer )
+{
+  return Next( o_rBuffer, true ) == EReceived;
+}
+
+VMulticastReceiver::EResult VMulticastReceiver::Poll( ViconCGStreamIO::VBuffer & o_rBuffer )
+{
+  return Next( o_rBuffer, false );
+}
+
+void VMulticastReceiver::Shutdown()
+{
+  // Set first, so that the empty read the shutdown wakes up is recognised as such
+  m_bShutdown = true;
+
+  boost::system::error_code DontCareError;
+  m_pSocket->shutdown( boost::asio::ip::udp::socket::shutdown_both, DontCareError );
+}
+
+VMulticastReceiver::EResult VMulticastReceiver::Next( ViconCGStreamIO::VBuffer & o_rBuffer, bool i_bWait )
+{
+  unsigned int Index = 0;
+  do
+  {
+    if( m_bShutdown )
+    {
+      return EClosed;
+    }
+
+    if( m_Next == m_Count )
+    {
+      m_Next = 0;
+      m_Count = 0;
+      const EResult Result = ReceiveBatch( i_bWait );
+      if( Result != EReceived )
+      {
+        return Result;
+      }
+    }
+
+    Index = m_Next++;
+  }
+  // Empty datagrams carry nothing to parse, so are skipped along with truncated ones
+  while( m_Truncated[ Index ] || m_Lengths[ Index ] == 0 );
+
+  const unsigned int Length = m_Lengths[ Index ];
+  o_rBuffer.SetLength( Length );
+  memcpy( o_rBuffer.Raw(), m_Datagrams[ Index ].data(), Length );
+  o_rBuffer.SetOffset( 0 );
+  return EReceived;
+}
+
+VMulticastReceiveStats VMulticastReceiver::Stats() const
+{
+  VMulticastReceiveStats Stats;
+  Stats.m_DatagramsReceived = m_DatagramsReceived;
+  Stats.m_DatagramsDropped = m_DatagramsDropped;
+  Stats.m_DatagramsTruncated = m_DatagramsTruncated;
+  Stats.m_BatchesReceived = m_BatchesReceived;
+  Stats.m_BatchesFull = m_BatchesFull;
+  Stats.m_SocketBufferSize = m_SocketBufferSize;
+  return Stats;
+}
+
+#if defined( __linux__ )
+
+VMulticastReceiver::EResult VMulticastReceiver::ReceiveBatch( bool i_bWait )
+{
+  VPlatformBatch & rBatch = *m_pPlatformBatch;
+  const unsigned int BatchSize = static_cast< unsigned int >( m_Datagrams.size() );
+
+  for( unsigned int Index = 0; Index != BatchSize; ++Index )
+  {
+    rBatch.m_Vectors[ Index ].iov_base = m_Datagrams[ Index ].data();
+    rBatch.m_Vectors[ Index ].iov_len = m_Datagrams[ Index ].size();
+
+    mmsghdr & rHeader = rBatch.m_Headers[ Index ];
+    memset( &rHeader, 0, sizeof( rHeader ) );
+    rHeader.msg_hdr.msg_iov = &rBatch.m_Vectors[ Index ];
+    rHeader.msg_hdr.msg_iovlen = 1;
+    rHeader.msg_hdr.msg_control = &rBatch.m_Control[ Index * VPlatformBatch::ControlSize ];
+    rHeader.msg_hdr.msg_controllen = VPlatformBatch::ControlSize;
+  }
+
+  const int Socket = m_pSocket->native_handle();
+  int Count = -1;
+
+  if( !i_bWait )
+  {
+    do
+    {
+      Count = recvmmsg( Socket, rBatch.m_Headers.data(), BatchSize, MSG_DONTWAIT, nullptr );
+    }
+    while( Count < 0 && errno == EINTR );
+
+    if( Count < 0 )
+    {
+      return ( errno == EAGAIN || errno == EWOULDBLOCK ) ? EEmpty : EClosed;
+    }
+  }
+  else if( m_Options.m_SpinMicroseconds != 0 )
+  {
+    const std::chrono::steady_clock::time_point Deadline = std::chrono::steady_clock::now() + std::chrono::microseconds( m_Options.m_SpinMicroseconds );
+    do
+    {
+      Count = recvmmsg( Socket, rBatch.m_Headers.data(), BatchSize, MSG_DONTWAIT, nullptr );
+    }
+    while( Count < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ) && std::chrono::steady_clock::now() < Deadline );
+
+    if( Count < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR )
+    {
+      return EClosed;
+    }
+  }
+
+  while( Count < 0 )
+  {
+    // Block for the first datagram, then take whatever else is already queued
+    Count = recvmmsg( Socket, rBatch.m_Headers.data(), BatchSize, MSG_WAITFORONE, nullptr );
+    if( Count < 0 && errno != EINTR )
+    {
+      return EClosed;
+    }
+  }
+
+  if( Count == 0 )
+  {
+    return EClosed;
+  }
+
+  ViconCGStreamType::UInt64 Received = 0;
+  ViconCGStreamType::UInt64 Truncated = 0;
+  for( int Index = 0; Index != Count; ++Index )
+  {
+    msghdr & rMessage = rBatch.m_Headers[ Index ].msg_hdr;
+    m_Lengths[ Index ] = rBatch.m_Headers[ Index ].msg_len;
+    if( m_Lengths[ Index ] != 0 )
+    {
+      ++Received;
+    }
+
+    // Skip these rather than deliver a partial frame
+    m_Truncated[ Index ] = ( rMessage.msg_flags & MSG_TRUNC ) != 0;
+    if( m_Truncated[ Index ] )
+    {
+      ++Truncated;
+    }
+
+    for( cmsghdr * pControl = CMSG_FIRSTHDR( &rMessage ); pControl; pControl = CMSG_NXTHDR( &rMessage, pControl ) )
+    {
+      if( pControl->cmsg_level == SOL_SOCKET && pControl->cmsg_type == SO_RXQ_OVFL )
+      {
+        // The kernel reports the total dropped by this socket so far
+        ViconCGStreamType::UInt32 Dropped = 0;
+        memcpy( &Dropped, CMSG_DATA( pControl ), sizeof( Dropped ) );
+        m_DatagramsDropped = std::max< ViconCGStreamType::UInt64 >( m_DatagramsDropped, Dropped );
+      }
+    }
+  }
+
+  m_Count = static_cast< unsigned int >( Count );
+  m_DatagramsReceived += Received;
+  m_DatagramsTruncated += Truncated;
+  ++m_BatchesReceived;
+  if( m_Count == BatchSize )
+  {
+    ++m_BatchesFull;
+
+    // A backlog is when drops happen, and the counts carried by queued datagrams predate them
+#if defined( SO_MEMINFO )
+    ViconCGStreamType::UInt32 MemInfo[ SK_MEMINFO_VARS ] = { 0 };
+    socklen_t MemInfoSize = sizeof( MemInfo );
+    if( getsockopt( Socket, SOL_SOCKET, SO_MEMINFO, MemInfo, &MemInfoSize ) == 0 && MemInfoSize > SK_MEMINFO_DROPS * sizeof( MemInfo[ 0 ] ) )
+    {
+      m_DatagramsDropped = std::max< ViconCGStreamType::UInt64 >( m_DatagramsDropped, MemInfo[ SK_MEMINFO_DROPS ] );
+    }
+#endif
+  }
+  return EReceived;
+}
+
+#else
+
+VMulticastReceiver::EResult VMulticastReceiver::ReceiveBatch( bool i_bWait )
+{
+  boost::system::error_code Error;
+  if( !i_bWait && m_pSocket->available( Error ) == 0 )
+  {
+    return Error ? EClosed : EEmpty;
+  }
+
+  const size_t Length = m_pSocket->receive( boost::asio::buffer( m_Datagrams[ 0 ] ), 0, Error );
+  if( Error )
+  {
+    return EClosed;
+  }
+
+  m_Lengths[ 0 ] = static_cast< unsigned int >( Length );
+  m_Truncated[ 0 ] = false;
+  m_Count = 1;
+  ++m_DatagramsReceived;
+  ++m_BatchesReceived;
+  return EReceived;
+}
+
+#endif
@@ -0,0 +1,159 @@
+
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <StreamCommon/Buffer.h>
+#include <StreamCommon/Type.h>
+
+#include <boost/asio.hpp>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// Tuning for the multicast receive path
+class VMulticastReceiveOptions
+{
+public:
+  VMulticastReceiveOptions()
+  : m_SocketBufferSize( 128 * 1024 )
+  , m_BatchSize( 16 )
+  , m_SpinMicroseconds( 0 )
+  {
+  }
+
+  // Requested kernel receive buffer (SO_RCVBUF) in bytes
+  unsigned int m_SocketBufferSize;
+
+  // Maximum number of datagrams drained per system call
+  unsigned int m_BatchSize;
+
+  // Time to poll the socket without blocking before falling back to a blocking wait; zero never polls
+  unsigned int m_SpinMicroseconds;
+};
+
+// Counters for the multicast receive path, accumulated since the receiver was created
+class VMulticastReceiveStats
+{
+public:
+  VMulticastReceiveStats()
+  : m_DatagramsReceived( 0 )
+  , m_DatagramsDropped( 0 )
+  , m_DatagramsTruncated( 0 )
+  , m_BatchesReceived( 0 )
+  , m_BatchesFull( 0 )
+  , m_SocketBufferSize( 0 )
+  {
+  }
+
+  // Combine the stats of several receivers. The counters are summed; the buffer size is per socket,
+  // so the smallest granted size is kept, as that is the receiver most likely to drop datagrams.
+  void Accumulate( const VMulticastReceiveStats & i_rOther )
+  {
+    m_DatagramsReceived += i_rOther.m_DatagramsReceived;
+    m_DatagramsDropped += i_rOther.m_DatagramsDropped;
+    m_DatagramsTruncated += i_rOther.m_DatagramsTruncated;
+    m_BatchesReceived += i_rOther.m_BatchesReceived;
+    m_BatchesFull += i_rOther.m_BatchesFull;
+    if( i_rOther.m_SocketBufferSize != 0 && ( m_SocketBufferSize == 0 || i_rOther.m_SocketBufferSize < m_SocketBufferSize ) )
+    {
+      m_SocketBufferSize = i_rOther.m_SocketBufferSize;
+    }
+  }
+
+  // Datagrams delivered by the kernel
+  ViconCGStreamType::UInt64 m_DatagramsReceived;
+
+  // Datagrams the kernel discarded because the socket buffer was full (Linux only)
+  ViconCGStreamType::UInt64 m_DatagramsDropped;
+
+  // Datagrams larger than the receive buffer, which are discarded
+  ViconCGStreamType::UInt64 m_DatagramsTruncated;
+
+  // System calls which returned data
+  ViconCGStreamType::UInt64 m_BatchesReceived;
+
+  // Batches which filled every slot, so more datagrams were probably queued behind them
+  ViconCGStreamType::UInt64 m_BatchesFull;
+
+  // Receive buffer size actually granted by the kernel
+  ViconCGStreamType::UInt64 m_SocketBufferSize;
+};
+
+// Receives datagrams from a multicast socket in batches.
+// On Linux several queued datagrams are drained by each recvmmsg call; elsewhere one datagram is read at a time.
+// Receive() and Poll() are called from one thread at a time; Stats() may be called from any thread.
+class VMulticastReceiver
+{
+public:
+  enum EResult
+  {
+    EReceived,
+    EEmpty,
+    EClosed
+  };
+
+  // The socket should be open but not yet bound, so that the buffer size applies before datagrams arrive
+  VMulticastReceiver( std::shared_ptr< boost::asio::ip::udp::socket > i_pSocket, const VMulticastReceiveOptions & i_rOptions );
+
+  // Apply the socket options; returns false if the receive buffer size could not be set
+  bool Configure( boost::system::error_code & o_rError );
+
+  // Copy the next datagram into the buffer; returns false once the socket is shut down or fails
+  bool Receive( ViconCGStreamIO::VBuffer & o_rBuffer );
+
+  // As Receive, but returns EEmpty rather than waiting when no datagram is queued
+  EResult Poll( ViconCGStreamIO::VBuffer & o_rBuffer );
+
+  // Wake a pending Receive or Poll and report EClosed from then on; may be called from any thread
+  void Shutdown();
+
+  VMulticastReceiveStats Stats() const;
+
+private:
+  EResult Next( ViconCGStreamIO::VBuffer & o_rBuffer, bool i_bWait );
+  EResult ReceiveBatch( bool i_bWait );
+
+  std::shared_ptr< boost::asio::ip::udp::socket > m_pSocket;
+  const VMulticastReceiveOptions m_Options;
+
+  std::vector< std::vector< unsigned char > > m_Datagrams;
+  std::vector< unsigned int > m_Lengths;
+  std::vector< bool > m_Truncated;
+  unsigned int m_Next;
+  unsigned int m_Count;
+
+  class VPlatformBatch;
+  std::shared_ptr< VPlatformBatch > m_pPlatformBatch;
+
+  std::atomic< ViconCGStreamType::UInt64 > m_DatagramsReceived;
+  std::atomic< ViconCGStreamType::UInt64 > m_DatagramsDropped;
+  std::atomic< ViconCGStreamType::UInt64 > m_DatagramsTruncated;
+  std::atomic< ViconCGStreamType::UInt64 > m_BatchesReceived;
+  std::atomic< ViconCGStreamType::UInt64 > m_BatchesFull;
+  std::atomic< ViconCGStreamType::UInt64 > m_SocketBufferSize;
+
+  std::atomic< bool > m_bShutdown;
+};
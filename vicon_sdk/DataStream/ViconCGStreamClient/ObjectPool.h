@@ -0,0 +1,138 @@
+
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <boost/thread/mutex.hpp>
+
+#include <iterator>
+#include <memory>
+#include <vector>
+
+// A pool of recycled objects.
+// Objects are handed out as shared pointers; when the last reference is released the object is
+// cleared and returned to the pool, so that the next Acquire() reuses the capacity of its containers
+// rather than growing them from empty.
+// T must provide a Clear() method which resets it to its default state without releasing capacity.
+// The pool may be destroyed while objects are still in use; those objects are then simply deleted.
+template< typename T >
+class VObjectPool
+{
+public:
+  explicit VObjectPool( unsigned int i_MaxFree = 8 )
+  : m_pFreeList( std::make_shared< VFreeList >( i_MaxFree ) )
+  {
+  }
+
+  std::shared_ptr< T > Acquire()
+  {
+    std::unique_ptr< T > pObject;
+    {
+      boost::mutex::scoped_lock Lock( m_pFreeList->m_Mutex );
+      if( !m_pFreeList->m_Objects.empty() )
+      {
+        pObject = std::move( m_pFreeList->m_Objects.back() );
+        m_pFreeList->m_Objects.pop_back();
+      }
+    }
+
+    if( !pObject )
+    {
+      pObject.reset( new T() );
+    }
+
+    std::weak_ptr< VFreeList > pFreeList = m_pFreeList;
+    return std::shared_ptr< T >( pObject.release(), [ pFreeList ]( T* i_pObject ){ Release( pFreeList, i_pObject ); } );
+  }
+
+  // The number of objects currently available for reuse
+  std::size_t FreeCount() const
+  {
+    boost::mutex::scoped_lock Lock( m_pFreeList->m_Mutex );
+    return m_pFreeList->m_Objects.size();
+  }
+
+private:
+  class VFreeList
+  {
+  public:
+    explicit VFreeList( unsigned int i_MaxFree )
+    : m_MaxFree( i_MaxFree )
+    {
+      m_Objects.reserve( i_MaxFree );
+    }
+
+    boost::mutex m_Mutex;
+    std::vector< std::unique_ptr< T > > m_Objects;
+    const unsigned int m_MaxFree;
+  };
+
+  static void Release( const std::weak_ptr< VFreeList >& i_rpFreeList, T* i_pObject )
+  {
+    std::unique_ptr< T > pObject( i_pObject );
+
+    std::shared_ptr< VFreeList > pFreeList = i_rpFreeList.lock();
+    if( !pFreeList )
+    {
+      return;
+    }
+
+    // Clear outside the lock; this runs on whichever thread released the last reference
+    pObject->Clear();
+
+    boost::mutex::scoped_lock Lock( pFreeList->m_Mutex );
+    if( pFreeList->m_Objects.size() < pFreeList->m_MaxFree )
+    {
+      pFreeList->m_Objects.push_back( std::move( pObject ) );
+    }
+  }
+
+  std::shared_ptr< VFreeList > m_pFreeList;
+};
+
+// Helpers for the Clear() method of pooled objects which hold a variable number of elements,
+// each with containers of their own. Clearing moves the elements to a spare list rather than
+// destroying them, and adding takes them back, so their containers keep their capacity.
+// Every field of an element taken from the spare list must be overwritten by the caller.
+template< typename T >
+T & AddRecycled( std::vector< T > & io_rValues, std::vector< T > & io_rSpare )
+{
+  if( io_rSpare.empty() )
+  {
+    io_rValues.emplace_back();
+  }
+  else
+  {
+    io_rValues.push_back( std::move( io_rSpare.back() ) );
+    io_rSpare.pop_back();
+  }
+  return io_rValues.back();
+}
+
+template< typename T >
+void Recycle( std::vector< T > & io_rValues, std::vector< T > & io_rSpare )
+{
+  io_rSpare.insert( io_rSpare.end(), std::make_move_iterator( io_rValues.begin() ), std::make_move_iterator( io_rValues.end() ) );
+  io_rValues.clear();
+}
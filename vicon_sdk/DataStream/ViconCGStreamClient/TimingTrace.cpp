@@ -0,0 +1,330 @@
+
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+#include "TimingTrace.h"
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+namespace
+{
+  const char s_Magic[ 8 ] = { 'V', 'T', 'I', 'M', 'I', 'N', 'G', '\0' };
+  const ViconCGStreamType::UInt32 s_Version = 1;
+
+  // How often the flusher wakes to write out the ring
+  const unsigned int s_FlushIntervalMs = 100;
+
+  // Characters of a channel name carried by each EChannelName record
+  const std::size_t s_NamePiece = sizeof( double );
+
+  VTimingRecord MakeRecord( VTimingRecord::EType i_Type, ViconCGStreamType::UInt16 i_Channel, ViconCGStreamType::UInt32 i_FrameID, double i_Value )
+  {
+    VTimingRecord Record;
+    Record.m_Type = static_cast< ViconCGStreamType::UInt16 >( i_Type );
+    Record.m_Channel = i_Channel;
+    Record.m_FrameID = i_FrameID;
+    Record.m_Value = i_Value;
+    return Record;
+  }
+}
+
+static_assert( sizeof( VTimingTraceHeader ) == 16, "Timing trace header is part of the file format" );
+static_assert( sizeof( VTimingRecord ) == 16, "Timing records are part of the file format" );
+
+VTimingTraceWriter::VTimingTraceWriter( unsigned int i_Capacity )
+: m_Capacity( std::max( i_Capacity, 256u ) )
+, m_pRing( new VTimingRecord[ m_Capacity ] )
+, m_WritePosition( 0 )
+, m_ReadPosition( 0 )
+, m_Dropped( 0 )
+, m_bStop( false )
+{
+}
+
+VTimingTraceWriter::~VTimingTraceWriter()
+{
+  Close();
+}
+
+bool VTimingTraceWriter::Open( const std::string & i_rFilename )
+{
+  Close();
+
+  m_File.open( i_rFilename, std::ios::binary | std::ios::trunc );
+  if( !m_File.good() )
+  {
+    m_File.close();
+    return false;
+  }
+
+  VTimingTraceHeader Header;
+  std::memcpy( Header.m_Magic, s_Magic, sizeof( s_Magic ) );
+  Header.m_Version = s_Version;
+  Header.m_RecordSize = sizeof( VTimingRecord );
+  m_File.write( reinterpret_cast< const char * >( &Header ), sizeof( Header ) );
+
+  // Channel numbers are per file
+  m_Channels.clear();
+  m_FrameChannels.clear();
+  m_WritePosition = 0;
+  m_ReadPosition = 0;
+  m_Dropped = 0;
+
+  m_bStop = false;
+  m_FlushThread = boost::thread( &VTimingTraceWriter::FlushThread, this );
+  return m_File.good();
+}
+
+void VTimingTraceWriter::Close()
+{
+  if( !m_FlushThread.joinable() )
+  {
+    return;
+  }
+
+  {
+    boost::mutex::scoped_lock Lock( m_FlushMutex );
+    m_bStop = true;
+  }
+  m_FlushCondition.notify_all();
+  m_FlushThread.join();
+
+  m_File.close();
+}
+
+bool VTimingTraceWriter::IsOpen() const
+{
+  return m_File.is_open();
+}
+
+ViconCGStreamType::UInt64 VTimingTraceWriter::Dropped() const
+{
+  return m_Dropped.load( std::memory_order_relaxed );
+}
+
+void VTimingTraceWriter::WriteFrame( ViconCGStreamType::UInt32 i_FrameID, double i_ReceiptTime )
+{
+  m_Pending.clear();
+  m_Pending.push_back( MakeRecord( VTimingRecord::EFrame, 0, i_FrameID, i_ReceiptTime ) );
+  Commit();
+}
+
+void VTimingTraceWriter::WriteFrame( ViconCGStreamType::UInt32 i_FrameID, double i_ReceiptTime, const std::vector< ViconCGStreamDetail::VLatencyInfo_Sample > & i_rLatencies )
+{
+  const std::size_t ChannelCount = m_Channels.size();
+
+  // Channel names are queued first, so that a reader meets them before they are used
+  m_Pending.clear();
+  m_FrameChannels.resize( i_rLatencies.size(), 0 );
+  for( std::size_t Index = 0; Index != i_rLatencies.size(); ++Index )
+  {
+    m_FrameChannels[ Index ] = Channel( Index, i_rLatencies[ Index ].m_Name );
+  }
+
+  m_Pending.push_back( MakeRecord( VTimingRecord::EFrame, 0, i_FrameID, i_ReceiptTime ) );
+  for( std::size_t Index = 0; Index != i_rLatencies.size(); ++Index )
+  {
+    m_Pending.push_back( MakeRecord( VTimingRecord::ELatency, m_FrameChannels[ Index ], i_FrameID, i_rLatencies[ Index ].m_Latency ) );
+  }
+
+  const std::size_t WritePosition = m_WritePosition.load( std::memory_order_relaxed );
+  Commit();
+  if( m_WritePosition.load( std::memory_order_relaxed ) == WritePosition )
+  {
+    // Dropped; forget any channels named by this frame, so they are named again by the next
+    m_Channels.resize( ChannelCount );
+  }
+}
+
+ViconCGStreamType::UInt16 VTimingTraceWriter::Channel( std::size_t i_Index, const std::string & i_rName )
+{
+  // Latencies usually arrive in the same order every frame, so try the channel used at this position last time
+  const ViconCGStreamType::UInt16 Cached = m_FrameChannels[ i_Index ];
+  if( Cached < m_Channels.size() && m_Channels[ Cached ] == i_rName )
+  {
+    return Cached;
+  }
+
+  const auto ChannelIt = std::find( m_Channels.begin(), m_Channels.end(), i_rName );
+  if( ChannelIt != m_Channels.end() )
+  {
+    return static_cast< ViconCGStreamType::UInt16 >( ChannelIt - m_Channels.begin() );
+  }
+
+  const ViconCGStreamType::UInt16 Channel = static_cast< ViconCGStreamType::UInt16 >( m_Channels.size() );
+  m_Channels.push_back( i_rName );
+
+  // Always finish with a piece that is not full, which marks the end of the name
+  for( std::size_t Offset = 0, Piece = 0; Offset <= i_rName.size(); Offset += s_NamePiece, ++Piece )
+  {
+    VTimingRecord Record = MakeRecord( VTimingRecord::EChannelName, Channel, static_cast< ViconCGStreamType::UInt32 >( Piece ), 0.0 );
+    char Characters[ s_NamePiece ] = {};
+    i_rName.copy( Characters, s_NamePiece, Offset );
+    std::memcpy( &Record.m_Value, Characters, s_NamePiece );
+    m_Pending.push_back( Record );
+  }
+  return Channel;
+}
+
+void VTimingTraceWriter::Commit()
+{
+  const std::size_t WritePosition = m_WritePosition.load( std::memory_order_relaxed );
+  const std::size_t ReadPosition = m_ReadPosition.load( std::memory_order_acquire );
+  if( !m_FlushThread.joinable() || m_Pending.size() > m_Capacity - ( WritePosition - ReadPosition ) )
+  {
+    m_Dropped.fetch_add( 1, std::memory_order_relaxed );
+    return;
+  }
+
+  for( std::size_t Index = 0; Index != m_Pending.size(); ++Index )
+  {
+    m_pRing[ ( WritePosition + Index ) % m_Capacity ] = m_Pending[ Index ];
+  }
+  m_WritePosition.store( WritePosition + m_Pending.size(), std::memory_order_release );
+}
+
+void VTimingTraceWriter::FlushThread()
+{
+  boost::mutex::scoped_lock Lock( m_FlushMutex );
+  while( !m_bStop )
+  {
+    m_FlushCondition.timed_wait( Lock, boost::posix_time::milliseconds( s_FlushIntervalMs ) );
+
+    Lock.unlock();
+    Flush();
+    Lock.lock();
+  }
+
+  Lock.unlock();
+  Flush();
+  m_File.flush();
+}
+
+void VTimingTraceWriter::Flush()
+{
+  const std::size_t WritePosition = m_WritePosition.load( std::memory_order_acquire );
+  std::size_t ReadPosition = m_ReadPosition.load( std::memory_order_relaxed );
+
+  // At most two contiguous pieces of the ring
+  while( ReadPosition != WritePosition )
+  {
+    const std::size_t Start = ReadPosition % m_Capacity;
+    const std::size_t Count = std::min( WritePosition - ReadPosition, m_Capacity - Start );
+    m_File.write( reinterpret_cast< const char * >( &m_pRing[ Start ] ), Count * sizeof( VTimingRecord ) );
+    ReadPosition += Count;
+  }
+
+  m_ReadPosition.store( ReadPosition, std::memory_order_release );
+}
+
+bool ConvertTimingTraceToCsv( std::istream & i_rTrace, std::ostream & o_rCsv )
+{
+  VTimingTraceHeader Header;
+  if( !i_rTrace.read( reinterpret_cast< char * >( &Header ), sizeof( Header ) ) ||
+      std::memcmp( Header.m_Magic, s_Magic, sizeof( s_Magic ) ) != 0 ||
+      Header.m_Version != s_Version ||
+      Header.m_RecordSize != sizeof( VTimingRecord ) )
+  {
+    return false;
+  }
+
+  std::vector< VTimingRecord > Records;
+  VTimingRecord Record;
+  while( i_rTrace.read( reinterpret_cast< char * >( &Record ), sizeof( Record ) ) )
+  {
+    Records.push_back( Record );
+  }
+
+  // The columns are every channel named in the trace
+  std::vector< std::string > Names;
+  for( const auto & rRecord : Records )
+  {
+    if( rRecord.m_Type == VTimingRecord::EChannelName )
+    {
+      if( rRecord.m_Channel >= Names.size() )
+      {
+        Names.resize( rRecord.m_Channel + 1 );
+      }
+
+      char Characters[ s_NamePiece ];
+      std::memcpy( Characters, &rRecord.m_Value, s_NamePiece );
+      Names[ rRecord.m_Channel ].append( Characters, std::find( Characters, Characters + s_NamePiece, '\0' ) );
+    }
+  }
+
+  o_rCsv << "Frame Number, Receipt Time";
+  for( const auto & rName : Names )
+  {
+    o_rCsv << ", " << rName;
+  }
+  o_rCsv << std::endl;
+
+  o_rCsv << std::fixed;
+  bool bRow = false;
+  std::vector< double > Values( Names.size() );
+  std::vector< bool > bValues( Names.size() );
+  auto WriteRow = [&]()
+  {
+    for( std::size_t Index = 0; Index != Values.size(); ++Index )
+    {
+      o_rCsv << ", ";
+      if( bValues[ Index ] )
+      {
+        o_rCsv << Values[ Index ];
+      }
+    }
+    o_rCsv << std::endl;
+  };
+
+  for( const auto & rRecord : Records )
+  {
+    if( rRecord.m_Type == VTimingRecord::EFrame )
+    {
+      if( bRow )
+      {
+        WriteRow();
+      }
+
+      o_rCsv << rRecord.m_FrameID << ", " << rRecord.m_Value;
+      std::fill( bValues.begin(), bValues.end(), false );
+      bRow = true;
+    }
+    else if( rRecord.m_Type == VTimingRecord::ELatency && bRow && rRecord.m_Channel < Values.size() )
+    {
+      Values[ rRecord.m_Channel ] = rRecord.m_Value;
+      bValues[ rRecord.m_Channel ] = true;
+    }
+  }
+
+  if( bRow )
+  {
+    WriteRow();
+  }
+
+  return true;
+}
@@ -0,0 +1,127 @@
+
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <StreamCommon/Type.h>
+#include <ViconCGStream/LatencyInfoDetail.h>
+
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <atomic>
+#include <fstream>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Timing logs are binary traces of fixed size records, so that logging a frame costs a few stores into a ring buffer.
+// A background thread writes the ring to the file, and ConvertTimingTraceToCsv turns a trace into a table afterwards.
+//
+// File layout, in the byte order of the machine that wrote it:
+//   VTimingTraceHeader
+//   VTimingRecord...
+// Each frame is an EFrame record giving the frame ID and its receipt time in milliseconds, followed by an ELatency record
+// for each latency sample, in seconds. Latency channels are numbered; the first time a channel is used, its name is
+// written in 8 character pieces as EChannelName records, whose frame ID field is the index of the piece.
+
+class VTimingTraceHeader
+{
+public:
+  char m_Magic[ 8 ];
+  ViconCGStreamType::UInt32 m_Version;
+  ViconCGStreamType::UInt32 m_RecordSize;
+};
+
+class VTimingRecord
+{
+public:
+  enum EType
+  {
+    EFrame = 1,
+    ELatency = 2,
+    EChannelName = 3
+  };
+
+  ViconCGStreamType::UInt16 m_Type;
+  ViconCGStreamType::UInt16 m_Channel;
+  ViconCGStreamType::UInt32 m_FrameID;
+  double m_Value;
+};
+
+class VTimingTraceWriter
+{
+public:
+  // i_Capacity is the number of records buffered between flushes; records which do not fit are dropped
+  explicit VTimingTraceWriter( unsigned int i_Capacity = 64 * 1024 );
+  ~VTimingTraceWriter();
+
+  // Create the file and start the flusher
+  bool Open( const std::string & i_rFilename );
+
+  // Write out everything buffered and close the file
+  void Close();
+
+  bool IsOpen() const;
+
+  // Record a frame. Frames are written by one thread at a time, and never block; if the buffer is full the
+  // whole frame is dropped and counted.
+  void WriteFrame( ViconCGStreamType::UInt32 i_FrameID, double i_ReceiptTime );
+  void WriteFrame( ViconCGStreamType::UInt32 i_FrameID, double i_ReceiptTime, const std::vector< ViconCGStreamDetail::VLatencyInfo_Sample > & i_rLatencies );
+
+  // The number of frames dropped because the buffer was full
+  ViconCGStreamType::UInt64 Dropped() const;
+
+private:
+  VTimingTraceWriter( const VTimingTraceWriter & );
+  VTimingTraceWriter & operator=( const VTimingTraceWriter & );
+
+  ViconCGStreamType::UInt16 Channel( std::size_t i_Index, const std::string & i_rName );
+  void Commit();
+  void FlushThread();
+  void Flush();
+
+  // Ring buffer with a single producer and the flusher as the single consumer
+  const std::size_t m_Capacity;
+  std::unique_ptr< VTimingRecord[] > m_pRing;
+  std::atomic< std::size_t > m_WritePosition;
+  std::atomic< std::size_t > m_ReadPosition;
+  std::atomic< ViconCGStreamType::UInt64 > m_Dropped;
+
+  // Producer state: the channels named so far, the channel of each latency in the last frame, and the records for the frame being written
+  std::vector< std::string > m_Channels;
+  std::vector< ViconCGStreamType::UInt16 > m_FrameChannels;
+  std::vector< VTimingRecord > m_Pending;
+
+  std::ofstream m_File;
+  boost::thread m_FlushThread;
+  boost::mutex m_FlushMutex;
+  boost::condition_variable m_FlushCondition;
+  bool m_bStop;
+};
+
+// Write a timing trace as comma separated values, one row per frame. Returns false if the trace could not be read.
+bool ConvertTimingTraceToCsv( std::istream & i_rTrace, std::ostream & o_rCsv );
@@ -29,7 +29,8 @@
 #include "IViconCGStreamClientCallback.h"
 #include "ViconCGStreamClient.h"
 
-#include "CGStreamPostalService.h"
+#include "CGStreamExecutor.h"
+#include "TimingTrace.h"
 #include "CGStreamReaderWriter.h"
 #include "ViconCGStreamBayer.h"
 
@@ -43,9 +44,12 @@
 #include <ViconCGStream/StartMulticastSender.h>
 #include <ViconCGStream/StopMulticastSender.h>
 
+#include <StreamCommon/CGStreamAsyncReaderWriter.h>
+
 #include <boost/asio.hpp>
 #include <boost/chrono/include.hpp>
 #include <functional>
+#include <future>
 
 #include <iostream>
 #include <numeric>
@@ -69,98 +73,88 @@ typedef std::chrono::high_resolution_clock hrc;
 
 ViconCGStream::VCentroids& VDynamicObjects::AddCentroids()
 {
-  m_Centroids.push_back( ViconCGStream::VCentroids() );
-  return m_Centroids.back();
+  return AddRecycled( m_Centroids, m_SpareCentroids );
 }
 
 ViconCGStream::VCentroidTracks& VDynamicObjects::AddCentroidTracks()
 {
-  m_CentroidTracks.push_back( ViconCGStream::VCentroidTracks() );
-  return m_CentroidTracks.back();
+  return AddRecycled( m_CentroidTracks, m_SpareCentroidTracks );
 }
 
 ViconCGStream::VCentroidWeights& VDynamicObjects::AddCentroidWeights()
 {
-  m_CentroidWeights.push_back( ViconCGStream::VCentroidWeights() );
-  return m_CentroidWeights.back();
+  return AddRecycled( m_CentroidWeights, m_SpareCentroidWeights );
 }
 
 ViconCGStream::VLocalSegments& VDynamicObjects::AddLocalSegments()
 {
-  m_LocalSegments.push_back( ViconCGStream::VLocalSegments() );
-  return m_LocalSegments.back();
+  return AddRecycled( m_LocalSegments, m_SpareLocalSegments );
 }
 
 ViconCGStream::VGlobalSegments& VDynamicObjects::AddGlobalSegments()
 {
-  m_GlobalSegments.push_back( ViconCGStream::VGlobalSegments() );
-  return m_GlobalSegments.back();
+  return AddRecycled( m_GlobalSegments, m_SpareGlobalSegments );
 }
 
 ViconCGStream::VLightweightSegments& VDynamicObjects::AddLightweightSegments()
 {
-  m_LightweightSegments.push_back( ViconCGStream::VLightweightSegments() );
-  return m_LightweightSegments.back();
+  return AddRecycled( m_LightweightSegments, m_SpareLightweightSegments );
 }
 
 ViconCGStream::VGreyscaleBlobs& VDynamicObjects::AddGreyscaleBlobs()
 {
-  m_GreyscaleBlobs.push_back( ViconCGStream::VGreyscaleBlobs() );
-  return m_GreyscaleBlobs.back();
+  return AddRecycled( m_GreyscaleBlobs, m_SpareGreyscaleBlobs );
 }
 
 ViconCGStream::VGreyscaleSubsampledBlobs& VDynamicObjects::AddGreyscaleSubsampledBlobs()
 {
-  m_GreyscaleSubsampledBlobs.push_back(ViconCGStream::VGreyscaleSubsampledBlobs());
-  return m_GreyscaleSubsampledBlobs.back();
+  return AddRecycled( m_GreyscaleSubsampledBlobs, m_SpareGreyscaleSubsampledBlobs );
 }
 
 ViconCGStream::VEdgePairs& VDynamicObjects::AddEdgePairs()
 {
-  m_EdgePairs.push_back( ViconCGStream::VEdgePairs() );
-  return m_EdgePairs.back();
+  return AddRecycled( m_EdgePairs, m_SpareEdgePairs );
 }
 
 ViconCGStream::VForceFrame& VDynamicObjects::AddForceFrame()
 {
-  m_ForceFrames.push_back( ViconCGStream::VForceFrame() );
-  return m_ForceFrames.back();
+  return AddRecycled( m_ForceFrames, m_SpareForceFrames );
 }
 
 ViconCGStream::VMomentFrame& VDynamicObjects::AddMomentFrame()
 {
-  m_MomentFrames.push_back( ViconCGStream::VMomentFrame() );
-  return m_MomentFrames.back();
+  return AddRecycled( m_MomentFrames, m_SpareMomentFrames );
 }
 
 ViconCGStream::VCentreOfPressureFrame& VDynamicObjects::AddCentreOfPressureFrame()
 {
-  m_CentreOfPressureFrames.push_back( ViconCGStream::VCentreOfPressureFrame() );
-  return m_CentreOfPressureFrames.back();
+  return AddRecycled( m_CentreOfPressureFrames, m_SpareCentreOfPressureFrames );
 }
 
 ViconCGStream::VVoltageFrame& VDynamicObjects::AddVoltageFrame()
 {
-  m_VoltageFrames.push_back( ViconCGStream::VVoltageFrame() );
-  return m_VoltageFrames.back();
+  return AddRecycled( m_VoltageFrames, m_SpareVoltageFrames );
 }
 
 ViconCGStream::VCameraWand2d& VDynamicObjects::AddCameraWand2d()
 {
-  m_CameraWand2d.push_back( ViconCGStream::VCameraWand2d() );
-  return m_CameraWand2d.back();
+  return AddRecycled( m_CameraWand2d, m_SpareCameraWand2d );
 }
 
 ViconCGStream::VCameraWand3d& VDynamicObjects::AddCameraWand3d()
 {
-  m_CameraWand3d.push_back( ViconCGStream::VCameraWand3d() );
-  return m_CameraWand3d.back();
+  return AddRecycled( m_CameraWand3d, m_SpareCameraWand3d );
 }
 
 ViconCGStream::VEyeTrackerFrame& VDynamicObjects::AddEyeTrackerFrame()
 {
-  m_EyeTrackerFrames.push_back( ViconCGStream::VEyeTrackerFrame() );
-  return m_EyeTrackerFrames.back();
+  return AddRecycled( m_EyeTrackerFrames, m_SpareEyeTrackerFrames );
+}
+
+VDynamicObjects::VDynamicObjects()
+: m_DeferredTypes( 0 )
+, m_DecodedTypes( 0 )
+{
 }
 
 ViconCGStream::VVideoFrame& VDynamicObjects::AddVideoFrame()
@@ -177,24 +171,190 @@ void VDynamicObjects::AddNetworkLatencyInfo( double i_Value )
   m_LatencyInfo.m_Samples.push_back( NetworkLatencySample );
 }
 
+void VDynamicObjects::AddDeferred( ViconCGStreamType::Enum i_Enum, const unsigned char * i_pData, unsigned int i_Length )
+{
+  VDeferredObject Deferred;
+  Deferred.m_Enum = i_Enum;
+  Deferred.m_Offset = m_DeferredData.Length();
+  Deferred.m_Length = i_Length;
+  m_DeferredObjects.push_back( Deferred );
+  m_DeferredTypes |= DeferredBit( i_Enum );
+
+  m_DeferredData.SetLength( Deferred.m_Offset + i_Length );
+  if( i_Length != 0 )
+  {
+    memcpy( m_DeferredData.Raw() + Deferred.m_Offset, i_pData, i_Length );
+  }
+}
+
+bool VDynamicObjects::IsDeferred( ViconCGStreamType::Enum i_Enum ) const
+{
+  return ( m_DeferredTypes & DeferredBit( i_Enum ) ) != 0;
+}
+
+void VDynamicObjects::DecodeDeferred( ViconCGStreamType::Enum i_Enum ) const
+{
+  const unsigned int Bit = DeferredBit( i_Enum );
+  if( !( m_DeferredTypes & Bit ) || ( m_DecodedTypes.load( std::memory_order_acquire ) & Bit ) )
+  {
+    return;
+  }
+
+  boost::mutex::scoped_lock Lock( m_DecodeMutex );
+  if( m_DecodedTypes.load( std::memory_order_relaxed ) & Bit )
+  {
+    return;
+  }
+
+  // The decoded members are a cache of the deferred blocks, filled in once under the lock
+  // and not read by anyone until the type is marked as decoded below.
+  VDynamicObjects & rThis = const_cast< VDynamicObjects & >( *this );
+  for( const VDeferredObject& rDeferred : m_DeferredObjects )
+  {
+    if( rDeferred.m_Enum == i_Enum )
+    {
+      m_DeferredData.SetOffset( rDeferred.m_Offset );
+      if( !rThis.ReadDeferrable( i_Enum, m_DeferredData ) )
+      {
+        break;
+      }
+    }
+  }
+
+  m_DecodedTypes.fetch_or( Bit, std::memory_order_release );
+}
+
+unsigned int VDynamicObjects::DeferredBit( ViconCGStreamType::Enum i_Enum )
+{
+  switch( i_Enum )
+  {
+  case ViconCGStreamEnum::Centroids:                  return 1u << 0;
+  case ViconCGStreamEnum::CentroidTracks:             return 1u << 1;
+  case ViconCGStreamEnum::CentroidWeights:            return 1u << 2;
+  case ViconCGStreamEnum::LabeledRecons:              return 1u << 3;
+  case ViconCGStreamEnum::UnlabeledRecons:            return 1u << 4;
+  case ViconCGStreamEnum::LabeledReconRayAssignments: return 1u << 5;
+  case ViconCGStreamEnum::GlobalSegments:             return 1u << 6;
+  case ViconCGStreamEnum::LocalSegments:              return 1u << 7;
+  case ViconCGStreamEnum::LightweightSegments:        return 1u << 8;
+  case ViconCGStreamEnum::GreyscaleBlobs:             return 1u << 9;
+  case ViconCGStreamEnum::GreyscaleSubsampledBlobs:   return 1u << 10;
+  case ViconCGStreamEnum::EdgePairs:                  return 1u << 11;
+  case ViconCGStreamEnum::ForceFrame:                 return 1u << 12;
+  case ViconCGStreamEnum::MomentFrame:                return 1u << 13;
+  case ViconCGStreamEnum::CentreOfPressureFrame:      return 1u << 14;
+  case ViconCGStreamEnum::VoltageFrame:               return 1u << 15;
+  case ViconCGStreamEnum::CameraWand2d:               return 1u << 16;
+  case ViconCGStreamEnum::CameraWand3d:               return 1u << 17;
+  case ViconCGStreamEnum::EyeTrackerFrame:            return 1u << 18;
+  default:                                            return 0;
+  }
+}
+
+bool VDynamicObjects::IsDeferrable( ViconCGStreamType::Enum i_Enum )
+{
+  return DeferredBit( i_Enum ) != 0;
+}
+
+bool VDynamicObjects::ReadDeferrable( ViconCGStreamType::Enum i_Enum, const ViconCGStreamIO::VBuffer& i_rBuffer )
+{
+  switch( i_Enum )
+  {
+  case ViconCGStreamEnum::Centroids:
+    return i_rBuffer.Read( AddCentroids() );
+  case ViconCGStreamEnum::CentroidTracks:
+    return i_rBuffer.Read( AddCentroidTracks() );
+  case ViconCGStreamEnum::CentroidWeights:
+    return i_rBuffer.Read( AddCentroidWeights() );
+  case ViconCGStreamEnum::LabeledRecons:
+    return i_rBuffer.Read( m_LabeledRecons );
+  case ViconCGStreamEnum::UnlabeledRecons:
+    return i_rBuffer.Read( m_UnlabeledRecons );
+  case ViconCGStreamEnum::LabeledReconRayAssignments:
+    return i_rBuffer.Read( m_LabeledRayAssignments );
+  case ViconCGStreamEnum::GlobalSegments:
+    return i_rBuffer.Read( AddGlobalSegments() );
+  case ViconCGStreamEnum::LocalSegments:
+    return i_rBuffer.Read( AddLocalSegments() );
+  case ViconCGStreamEnum::LightweightSegments:
+    return i_rBuffer.Read( AddLightweightSegments() );
+  case ViconCGStreamEnum::GreyscaleBlobs:
+    return i_rBuffer.Read( AddGreyscaleBlobs() );
+  case ViconCGStreamEnum::GreyscaleSubsampledBlobs:
+    return i_rBuffer.Read( AddGreyscaleSubsampledBlobs() );
+  case ViconCGStreamEnum::EdgePairs:
+    return i_rBuffer.Read( AddEdgePairs() );
+  case ViconCGStreamEnum::ForceFrame:
+    return i_rBuffer.Read( AddForceFrame() );
+  case ViconCGStreamEnum::MomentFrame:
+    return i_rBuffer.Read( AddMomentFrame() );
+  case ViconCGStreamEnum::CentreOfPressureFrame:
+    return i_rBuffer.Read( AddCentreOfPressureFrame() );
+  case ViconCGStreamEnum::VoltageFrame:
+    return i_rBuffer.Read( AddVoltageFrame() );
+  case ViconCGStreamEnum::CameraWand2d:
+    return i_rBuffer.Read( AddCameraWand2d() );
+  case ViconCGStreamEnum::CameraWand3d:
+    return i_rBuffer.Read( AddCameraWand3d() );
+  case ViconCGStreamEnum::EyeTrackerFrame:
+    return i_rBuffer.Read( AddEyeTrackerFrame() );
+  default:
+    return false;
+  }
+}
+
+void VDynamicObjects::Clear()
+{
+  m_FrameInfo = ViconCGStream::VFrameInfo();
+  m_HardwareFrameInfo = ViconCGStream::VHardwareFrameInfo();
+  m_Timecode = ViconCGStream::VTimecode();
+  m_FrameRateInfo = ViconCGStream::VFrameRateInfo();
+
+  // These wrap a single vector, which is resized in place when the block is next read
+  m_LatencyInfo.m_Samples.clear();
+  m_LabeledRecons.m_LabeledRecons.clear();
+  m_UnlabeledRecons.m_UnlabeledRecons.clear();
+  m_LabeledRayAssignments.m_ReconRayAssignments.clear();
+
+  Recycle( m_Centroids, m_SpareCentroids );
+  Recycle( m_CentroidTracks, m_SpareCentroidTracks );
+  Recycle( m_CentroidWeights, m_SpareCentroidWeights );
+  Recycle( m_LocalSegments, m_SpareLocalSegments );
+  Recycle( m_GlobalSegments, m_SpareGlobalSegments );
+  Recycle( m_LightweightSegments, m_SpareLightweightSegments );
+  Recycle( m_GreyscaleBlobs, m_SpareGreyscaleBlobs );
+  Recycle( m_GreyscaleSubsampledBlobs, m_SpareGreyscaleSubsampledBlobs );
+  Recycle( m_EdgePairs, m_SpareEdgePairs );
+  Recycle( m_ForceFrames, m_SpareForceFrames );
+  Recycle( m_MomentFrames, m_SpareMomentFrames );
+  Recycle( m_CentreOfPressureFrames, m_SpareCentreOfPressureFrames );
+  Recycle( m_VoltageFrames, m_SpareVoltageFrames );
+  Recycle( m_CameraWand2d, m_SpareCameraWand2d );
+  Recycle( m_CameraWand3d, m_SpareCameraWand3d );
+  Recycle( m_EyeTrackerFrames, m_SpareEyeTrackerFrames );
+  m_VideoFrames.clear();
+
+  m_DeferredData.Clear();
+  m_DeferredObjects.clear();
+  m_DeferredTypes = 0;
+  m_DecodedTypes.store( 0, std::memory_order_relaxed );
+}
+
 //-------------------------------------------------------------------------------------------------
 
 ViconCGStream::VCameraInfo& VStaticObjects::AddCameraInfo()
 {
-  m_CameraInfo.resize( m_CameraInfo.size() + 1 );
-  return m_CameraInfo.back();
+  return AddRecycled( m_CameraInfo, m_SpareCameraInfo );
 }
 
 ViconCGStream::VCameraSensorInfo& VStaticObjects::AddCameraSensorInfo()
 {
-  m_CameraSensorInfo.resize(m_CameraSensorInfo.size() + 1);
-  return m_CameraSensorInfo.back();
+  return AddRecycled( m_CameraSensorInfo, m_SpareCameraSensorInfo );
 }
 
 ViconCGStream::VCameraCalibrationInfo& VStaticObjects::AddCameraCalibrationInfo()
 {
-  m_CameraCalibrationInfo.resize( m_CameraCalibrationInfo.size() + 1 );
-  return m_CameraCalibrationInfo.back();
+  return AddRecycled( m_CameraCalibrationInfo, m_SpareCameraCalibrationInfo );
 }
 
 ViconCGStream::VCameraCalibrationHealth& VStaticObjects::ResetCameraCalibrationHealth()
@@ -205,68 +365,57 @@ ViconCGStream::VCameraCalibrationHealth& VStaticObjects::ResetCameraCalibrationH
 
 ViconCGStream::VSubjectInfo& VStaticObjects::AddSubjectInfo()
 {
-  m_SubjectInfo.resize( m_SubjectInfo.size() + 1 );
-  return m_SubjectInfo.back();
+  return AddRecycled( m_SubjectInfo, m_SpareSubjectInfo );
 }
 
 ViconCGStream::VSubjectTopology& VStaticObjects::AddSubjectTopology()
 {
-  m_SubjectTopology.resize( m_SubjectTopology.size() + 1 );
-  return m_SubjectTopology.back();
+  return AddRecycled( m_SubjectTopology, m_SpareSubjectTopology );
 }
 
 ViconCGStream::VSubjectScale & VStaticObjects::AddSubjectScale()
 {
-  m_SubjectScale.resize(m_SubjectScale.size() + 1);
-  return m_SubjectScale.back();
+  return AddRecycled( m_SubjectScale, m_SpareSubjectScale );
 }
 
 ViconCGStream::VSubjectHealth& VStaticObjects::AddSubjectHealth()
 {
-  m_SubjectHealth.resize( m_SubjectHealth.size() + 1 );
-  return m_SubjectHealth.back();
+  return AddRecycled( m_SubjectHealth, m_SpareSubjectHealth );
 }
 
 ViconCGStream::VObjectQuality& VStaticObjects::AddObjectQuality()
 {
-  m_ObjectQuality.resize( m_ObjectQuality.size() + 1 );
-  return m_ObjectQuality.back();
+  return AddRecycled( m_ObjectQuality, m_SpareObjectQuality );
 }
 
 ViconCGStream::VDeviceInfo& VStaticObjects::AddDeviceInfo()
 {
-  m_DeviceInfo.resize( m_DeviceInfo.size() + 1 );
-  return m_DeviceInfo.back();
+  return AddRecycled( m_DeviceInfo, m_SpareDeviceInfo );
 }
 
 ViconCGStream::VDeviceInfoExtra& VStaticObjects::AddDeviceInfoExtra()
 {
-  m_DeviceInfoExtra.resize( m_DeviceInfoExtra.size() + 1 );
-  return m_DeviceInfoExtra.back();
+  return AddRecycled( m_DeviceInfoExtra, m_SpareDeviceInfoExtra );
 }
 
 ViconCGStream::VChannelInfo& VStaticObjects::AddChannelInfo()
 {
-  m_ChannelInfo.resize( m_ChannelInfo.size() + 1 );
-  return m_ChannelInfo.back();
+  return AddRecycled( m_ChannelInfo, m_SpareChannelInfo );
 }
 
 ViconCGStream::VChannelInfoExtra& VStaticObjects::AddChannelInfoExtra()
 {
-  m_ChannelInfoExtra.resize( m_ChannelInfoExtra.size() + 1 );
-  return m_ChannelInfoExtra.back();
+  return AddRecycled( m_ChannelInfoExtra, m_SpareChannelInfoExtra );
 }
 
 ViconCGStream::VForcePlateInfo& VStaticObjects::AddForcePlateInfo()
 {
-  m_ForcePlateInfo.resize( m_ForcePlateInfo.size() + 1 );
-  return m_ForcePlateInfo.back();
+  return AddRecycled( m_ForcePlateInfo, m_SpareForcePlateInfo );
 }
 
 ViconCGStream::VEyeTrackerInfo& VStaticObjects::AddEyeTrackerInfo()
 {
-  m_EyeTrackerInfo.resize( m_EyeTrackerInfo.size() + 1 );
-  return m_EyeTrackerInfo.back();
+  return AddRecycled( m_EyeTrackerInfo, m_SpareEyeTrackerInfo );
 }
 
 void VStaticObjects::BuildMaps()
@@ -319,16 +468,49 @@ void VStaticObjects::BuildMaps()
   }
 }
 
+void VStaticObjects::Clear()
+{
+  m_StreamInfo = ViconCGStream::VStreamInfo();
+  m_ApplicationInfo.reset();
+
+  Recycle( m_CameraInfo, m_SpareCameraInfo );
+  Recycle( m_CameraSensorInfo, m_SpareCameraSensorInfo );
+  Recycle( m_CameraCalibrationInfo, m_SpareCameraCalibrationInfo );
+  m_pCameraCalibrationHealth.reset();
+  Recycle( m_SubjectInfo, m_SpareSubjectInfo );
+  Recycle( m_SubjectTopology, m_SpareSubjectTopology );
+  Recycle( m_SubjectScale, m_SpareSubjectScale );
+  Recycle( m_SubjectHealth, m_SpareSubjectHealth );
+  Recycle( m_ObjectQuality, m_SpareObjectQuality );
+  Recycle( m_DeviceInfo, m_SpareDeviceInfo );
+  Recycle( m_DeviceInfoExtra, m_SpareDeviceInfoExtra );
+  Recycle( m_ChannelInfo, m_SpareChannelInfo );
+  Recycle( m_ChannelInfoExtra, m_SpareChannelInfoExtra );
+  Recycle( m_ForcePlateInfo, m_SpareForcePlateInfo );
+  Recycle( m_EyeTrackerInfo, m_SpareEyeTrackerInfo );
+
+  m_CameraMap.clear();
+  m_CameraCalibrationMap.clear();
+  m_SubjectMap.clear();
+  m_SegmentMap.clear();
+  m_DeviceMap.clear();
+  m_ChannelMap.clear();
+}
+
 //-------------------------------------------------------------------------------------------------
 
 VViconCGStreamClient::VViconCGStreamClient( std::weak_ptr< IViconCGStreamClientCallback > i_pCallback )
 : m_pCallback( i_pCallback )
+, m_bAsyncRunning( false )
+, m_StaticObjectsPool( 2 )
+, m_DynamicObjectsPool( 16 )
 , m_bEnumsChanged( false )
 , m_bStreaming( false )
 , m_bHapticChanged( false )
 , m_bFilterChanged( false )
 , m_bPingChanged( false )
 , m_VideoHint( EPassThrough )
+, m_bLazyDecoding( false )
 {
   m_pSocket.reset( new boost::asio::ip::tcp::socket( m_Service ) );
 }
@@ -346,6 +528,12 @@ void VViconCGStreamClient::Connect( const std::string& i_rHost, unsigned short i
     return;
   }
 
+  // Asynchronous connections need their socket on the shared service
+  if( m_pExecutor )
+  {
+    m_pSocket.reset( new boost::asio::ip::tcp::socket( m_pExecutor->Service() ) );
+  }
+
   const std::string::size_type AtPos = i_rHost.find_first_of('@');
   const std::string Host = i_rHost.substr(0, AtPos);
   const std::string Adapter = AtPos == std::string::npos ? "" : i_rHost.substr( AtPos + 1 );
@@ -413,6 +601,10 @@ void VViconCGStreamClient::Connect( const std::string& i_rHost, unsigned short i
     {
       m_pSocket->connect( EndPoint, Error );
     }
+    if( !Error )
+    {
+      VCGStreamReaderWriter::EnableQuickAck( *m_pSocket );
+    }
 
     if( Error )
     {
@@ -440,18 +632,20 @@ void VViconCGStreamClient::Connect( const std::string& i_rHost, unsigned short i
     return;
   }
 
-  m_pClientThread.reset( new boost::thread( std::bind( &VViconCGStreamClient::ClientThread, this ) ) );
+  StartClient();
 }
 
 void VViconCGStreamClient::Disconnect()
 {
+  StopAsync();
+
   boost::system::error_code DontCareError;
   m_pSocket->shutdown( boost::asio::ip::tcp::socket::shutdown_both, DontCareError );
   m_pSocket->close();
   if( m_pMulticastSocket )
   {
-    boost::system::error_code DontCareError2;
-    m_pMulticastSocket->shutdown( boost::asio::ip::tcp::socket::shutdown_both, DontCareError2 );
+    // The receiver shuts the socket down itself, so that it can tell the wake up from an empty datagram
+    m_pMulticastReceiver->Shutdown();
     m_pMulticastSocket->close();
   }
 
@@ -461,6 +655,10 @@ void VViconCGStreamClient::Disconnect()
     m_pClientThread.reset();
   }
   m_pMulticastSocket.reset();
+  {
+    boost::mutex::scoped_lock Lock( m_MulticastReceiverMutex );
+    m_pMulticastReceiver.reset();
+  }
 
   m_HostName.clear();
 }
@@ -485,7 +683,7 @@ void VViconCGStreamClient::ReceiveMulticastData( std::string i_MulticastIPAddres
   }
 
   std::shared_ptr< boost::asio::ip::udp::socket > pMulticastSocket(
-    new boost::asio::ip::udp::socket( m_Service, LocalEndpoint.protocol() ) );
+    new boost::asio::ip::udp::socket( m_pExecutor ? m_pExecutor->Service() : m_Service, LocalEndpoint.protocol() ) );
   if( Error )
   {
     OnDisconnect();
@@ -497,8 +695,12 @@ void VViconCGStreamClient::ReceiveMulticastData( std::string i_MulticastIPAddres
     OnDisconnect();
     return;
   }
-  pMulticastSocket->set_option( boost::asio::socket_base::receive_buffer_size( 128 * 1024 ), Error );
-  if( Error )
+  std::shared_ptr< VMulticastReceiver > pMulticastReceiver;
+  {
+    boost::recursive_mutex::scoped_lock Lock( m_Mutex );
+    pMulticastReceiver = std::make_shared< VMulticastReceiver >( pMulticastSocket, m_MulticastReceiveOptions );
+  }
+  if( !pMulticastReceiver->Configure( Error ) )
   {
     OnDisconnect();
     return;
@@ -533,8 +735,12 @@ void VViconCGStreamClient::ReceiveMulticastData( std::string i_MulticastIPAddres
   }
 
   m_pMulticastSocket = pMulticastSocket;
+  {
+    boost::mutex::scoped_lock Lock( m_MulticastReceiverMutex );
+    m_pMulticastReceiver = pMulticastReceiver;
+  }
 
-  m_pClientThread.reset( new boost::thread( std::bind( &VViconCGStreamClient::ClientThread, this ) ) );
+  StartClient();
 }
 
 void VViconCGStreamClient::StopReceivingMulticastData()
@@ -682,49 +888,55 @@ void VViconCGStreamClient::SetVideoHint( EVideoHint i_VideoHint )
   m_VideoHint = i_VideoHint;
 }
 
-bool VViconCGStreamClient::SetTimingLogFile(const std::string & i_rFilename)
+void VViconCGStreamClient::SetMulticastReceiveOptions( const VMulticastReceiveOptions & i_rOptions )
 {
-  boost::mutex::scoped_lock Lock( m_LogMutex );
+  boost::recursive_mutex::scoped_lock Lock( m_Mutex );
+  m_MulticastReceiveOptions = i_rOptions;
+}
 
-  if( m_TimingLog.is_open() )
+bool VViconCGStreamClient::GetMulticastReceiveStats( VMulticastReceiveStats & o_rStats ) const
+{
+  boost::mutex::scoped_lock Lock( m_MulticastReceiverMutex );
+  if( !m_pMulticastReceiver )
   {
-    m_TimingLog.close();
+    return false;
   }
 
-  if( !m_pPostalService )
-  {
-    m_pPostalService = std::make_shared< VCGStreamPostalService >();
-  }
+  o_rStats = m_pMulticastReceiver->Stats();
+  return true;
+}
 
-  if( !m_pPostalService->StartService() )
-  {
-    m_pPostalService.reset();
-    return false;
-  }
+void VViconCGStreamClient::SetLazyDecoding( bool i_bLazy )
+{
+  boost::recursive_mutex::scoped_lock Lock( m_Mutex );
+  m_bLazyDecoding = i_bLazy;
+}
 
-  m_TimingLog.open( i_rFilename );
+void VViconCGStreamClient::SetExecutor( std::shared_ptr< VCGStreamExecutor > i_pExecutor )
+{
+  boost::recursive_mutex::scoped_lock Lock( m_Mutex );
+  m_pExecutor = i_pExecutor;
+}
 
-  // Write log header
-  if( m_TimingLog.good() )
+bool VViconCGStreamClient::SetTimingLogFile(const std::string & i_rFilename)
+{
+  boost::mutex::scoped_lock Lock( m_LogMutex );
+
+  auto pTimingLog = std::make_shared< VTimingTraceWriter >();
+  if( !pTimingLog->Open( i_rFilename ) )
   {
-    m_TimingLog << std::fixed << "Frame Number, Timestamp" << std::endl;
+    return false;
   }
 
-  return m_TimingLog.good();
+  // The previous log is closed once the client thread has finished with it
+  std::atomic_store( &m_pTimingLog, pTimingLog );
+  return true;
 }
 
 void VViconCGStreamClient::CloseLog()
 {
-  boost::mutex::scoped_lock Lock(m_LogMutex);
-
-  if( m_pPostalService )
-  {
-    m_pPostalService->StopService();
-  }
-  if( m_TimingLog.is_open() )
-  {
-    m_TimingLog.close();
-  }
+  boost::mutex::scoped_lock Lock( m_LogMutex );
+  std::atomic_store( &m_pTimingLog, std::shared_ptr< VTimingTraceWriter >() );
 }
 
 
@@ -751,6 +963,35 @@ static void Intersect( ViconCGStream::VObjectEnums& i_rServer, ViconCGStream::VO
   }
 }
 
+void VViconCGStreamClient::StartClient()
+{
+  if( !m_pExecutor )
+  {
+    m_pClientThread.reset( new boost::thread( std::bind( &VViconCGStreamClient::ClientThread, this ) ) );
+    return;
+  }
+
+  m_pStaticObjects.reset();
+  m_pDynamicObjects.reset();
+
+  {
+    boost::mutex::scoped_lock Lock( m_AsyncMutex );
+    m_bAsyncRunning = true;
+  }
+
+  m_pAsyncStrand = std::make_shared< boost::asio::io_service::strand >( m_pExecutor->Service() );
+  if( m_pMulticastSocket )
+  {
+    m_pAsyncReaderWriter = std::make_shared< VCGStreamReaderWriter >( m_pMulticastReceiver );
+    m_pAsyncStrand->post( std::bind( &VViconCGStreamClient::AsyncReceive, this ) );
+  }
+  else
+  {
+    m_pAsyncReaderWriter = std::make_shared< VCGStreamReaderWriter >( m_pSocket );
+    m_pAsyncStrand->post( std::bind( &VViconCGStreamClient::AsyncRead, this, true ) );
+  }
+}
+
 void VViconCGStreamClient::ClientThread()
 {
   m_pStaticObjects.reset();
@@ -759,7 +1000,7 @@ void VViconCGStreamClient::ClientThread()
   if( m_pMulticastSocket )
   {
     // Multicast receive only
-    VCGStreamReaderWriter ReaderWriter( m_pMulticastSocket );
+    VCGStreamReaderWriter ReaderWriter( m_pMulticastReceiver );
 
     for( ;; )
     {
@@ -796,6 +1037,131 @@ void VViconCGStreamClient::ClientThread()
   }
 }
 
+void VViconCGStreamClient::AsyncRead( bool i_bObjectEnums )
+{
+  VCGStreamAsyncReaderWriter::ReadBuffer( *m_pSocket, *m_pAsyncStrand, *m_pAsyncReaderWriter,
+                                          []( ViconCGStreamType::Enum i_Enum, ViconCGStreamType::UInt32 ){ return i_Enum == ViconCGStreamEnum::Objects; },
+                                          std::bind( &VViconCGStreamClient::OnAsyncRead, this, i_bObjectEnums, std::placeholders::_1 ) );
+}
+
+void VViconCGStreamClient::OnAsyncRead( bool i_bObjectEnums, bool i_bOk )
+{
+  if( i_bOk )
+  {
+    VCGStreamReaderWriter::EnableQuickAck( *m_pSocket );
+  }
+
+  // The same sequence as ClientThread: the object enums, then alternately write any changes and read a frame
+  if( i_bOk && ( i_bObjectEnums ? ParseObjectEnums( *m_pAsyncReaderWriter ) : ParseObjects( *m_pAsyncReaderWriter ) ) )
+  {
+    if( BuildObjects() )
+    {
+      AsyncWrite();
+    }
+    else
+    {
+      AsyncRead( false );
+    }
+    return;
+  }
+
+  OnDisconnect();
+  OnAsyncStopped();
+}
+
+void VViconCGStreamClient::AsyncWrite()
+{
+  // m_WriteBuffer is only rebuilt by OnAsyncRead, which cannot run again until this write completes
+  boost::asio::async_write( *m_pSocket, boost::asio::buffer( m_WriteBuffer.Raw(), m_WriteBuffer.Length() ),
+                            m_pAsyncStrand->wrap( std::bind( &VViconCGStreamClient::OnAsyncWrite, this, std::placeholders::_1 ) ) );
+}
+
+void VViconCGStreamClient::OnAsyncWrite( const boost::system::error_code & i_rError )
+{
+  if( !i_rError )
+  {
+    AsyncRead( false );
+    return;
+  }
+
+  OnDisconnect();
+  OnAsyncStopped();
+}
+
+void VViconCGStreamClient::AsyncReceive()
+{
+  // Wait for the socket to become readable, then drain everything queued through the receiver
+  m_pMulticastSocket->async_receive( boost::asio::null_buffers(),
+                                     m_pAsyncStrand->wrap( std::bind( &VViconCGStreamClient::OnAsyncReceive, this, std::placeholders::_1 ) ) );
+}
+
+void VViconCGStreamClient::OnAsyncReceive( const boost::system::error_code & i_rError )
+{
+  if( !i_rError )
+  {
+    for( ;; )
+    {
+      const VMulticastReceiver::EResult Result = m_pMulticastReceiver->Poll( *m_pAsyncReaderWriter );
+      if( Result == VMulticastReceiver::EEmpty )
+      {
+        AsyncReceive();
+        return;
+      }
+
+      if( Result == VMulticastReceiver::EClosed || !ParseObjects( *m_pAsyncReaderWriter ) )
+      {
+        break;
+      }
+    }
+  }
+
+  // As in ClientThread, the end of multicast reception is not reported as a disconnection
+  OnAsyncStopped();
+}
+
+void VViconCGStreamClient::OnAsyncStopped()
+{
+  boost::mutex::scoped_lock Lock( m_AsyncMutex );
+  m_bAsyncRunning = false;
+  m_AsyncStopped.notify_all();
+}
+
+void VViconCGStreamClient::StopAsync()
+{
+  if( !m_pAsyncStrand )
+  {
+    return;
+  }
+
+  // Close the sockets on the strand so that they are never closed under a running handler;
+  // the outstanding operation then completes with an error and the handlers stop.
+  std::shared_ptr< boost::asio::ip::tcp::socket > pSocket = m_pSocket;
+  std::shared_ptr< boost::asio::ip::udp::socket > pMulticastSocket = m_pMulticastSocket;
+  std::shared_ptr< std::promise< void > > pClosed = std::make_shared< std::promise< void > >();
+  m_pAsyncStrand->post( [ pSocket, pMulticastSocket, pClosed ]()
+  {
+    boost::system::error_code DontCareError;
+    pSocket->close( DontCareError );
+    if( pMulticastSocket )
+    {
+      pMulticastSocket->close( DontCareError );
+    }
+    pClosed->set_value();
+  } );
+  pClosed->get_future().wait();
+
+  {
+    boost::mutex::scoped_lock Lock( m_AsyncMutex );
+    while( m_bAsyncRunning )
+    {
+      m_AsyncStopped.wait( Lock );
+    }
+  }
+
+  m_pAsyncStrand.reset();
+  m_pAsyncReaderWriter.reset();
+}
+
 bool VViconCGStreamClient::ReadObjectEnums( VCGStreamReaderWriter& i_rReaderWriter )
 {
   if( !i_rReaderWriter.Fill() )
@@ -803,7 +1169,12 @@ bool VViconCGStreamClient::ReadObjectEnums( VCGStreamReaderWriter& i_rReaderWrit
     return false;
   }
 
-  ViconCGStreamIO::VScopedReader Objects( i_rReaderWriter );
+  return ParseObjectEnums( i_rReaderWriter );
+}
+
+bool VViconCGStreamClient::ParseObjectEnums( ViconCGStreamIO::VBuffer& i_rBuffer )
+{
+  ViconCGStreamIO::VScopedReader Objects( i_rBuffer );
   if( Objects.Enum() != ViconCGStreamEnum::Objects )
   {
     return false;
@@ -811,7 +1182,7 @@ bool VViconCGStreamClient::ReadObjectEnums( VCGStreamReaderWriter& i_rReaderWrit
 
   while( Objects.Ok() )
   {
-    ViconCGStreamIO::VScopedReader Object( i_rReaderWriter );
+    ViconCGStreamIO::VScopedReader Object( i_rBuffer );
 
     if( Object.Enum() == ViconCGStreamEnum::ObjectEnums )
     {
@@ -829,14 +1200,25 @@ bool VViconCGStreamClient::ReadObjectEnums( VCGStreamReaderWriter& i_rReaderWrit
 }
 
 bool VViconCGStreamClient::WriteObjects( VCGStreamReaderWriter& i_rReaderWriter )
+{
+  boost::recursive_mutex::scoped_lock Lock( m_Mutex );
+  if( !BuildObjects() )
+  {
+    return true;
+  }
+
+  return i_rReaderWriter.Flush( m_WriteBuffer );
+}
+
+bool VViconCGStreamClient::BuildObjects()
 {
   boost::recursive_mutex::scoped_lock Lock( m_Mutex );
   bool bWriteObjects = m_bEnumsChanged || m_bHapticChanged || m_bPingChanged;
 
   if( bWriteObjects )
   {
-    i_rReaderWriter.Clear();
-    ViconCGStreamIO::VScopedWriter Objects( i_rReaderWriter );
+    m_WriteBuffer.Clear();
+    ViconCGStreamIO::VScopedWriter Objects( m_WriteBuffer );
 
     if( m_bEnumsChanged )
     {
@@ -873,12 +1255,12 @@ bool VViconCGStreamClient::WriteObjects( VCGStreamReaderWriter& i_rReaderWriter
   }
   else
   {
-    return true;
+    return false;
   }
 
   m_bEnumsChanged = false;
 
-  return i_rReaderWriter.Flush();
+  return true;
 }
 
 void VViconCGStreamClient::CopyObjects( const ViconCGStream::VContents& i_rContents, const VStaticObjects& i_rStaticObjects, VStaticObjects& o_rStaticObjects ) const
@@ -956,6 +1338,19 @@ void VViconCGStreamClient::CopyObjects( const ViconCGStream::VContents& i_rConte
 
   for( ; It != End; ++It )
   {
+    // Blocks which were never decoded are copied as they are; their members may be being decoded by a reader
+    if( i_rDynamicObjects.IsDeferred( *It ) )
+    {
+      for( const VDeferredObject& rDeferred : i_rDynamicObjects.m_DeferredObjects )
+      {
+        if( rDeferred.m_Enum == *It )
+        {
+          o_rDynamicObjects.AddDeferred( rDeferred.m_Enum, i_rDynamicObjects.m_DeferredData.Raw() + rDeferred.m_Offset, rDeferred.m_Length );
+        }
+      }
+      continue;
+    }
+
     switch( *It )
     {
     case ViconCGStreamEnum::FrameInfo:
@@ -1029,9 +1424,14 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
     return false;
   }
 
+  return ParseObjects( i_rReaderWriter );
+}
+
+bool VViconCGStreamClient::ParseObjects( ViconCGStreamIO::VBuffer& i_rBuffer )
+{
   const double PacketReceiptTime = std::chrono::duration< double, std::milli >( std::chrono::high_resolution_clock::now().time_since_epoch() ).count();
 
-  ViconCGStreamIO::VScopedReader Objects( i_rReaderWriter );
+  ViconCGStreamIO::VScopedReader Objects( i_rBuffer );
   if( Objects.Enum() != ViconCGStreamEnum::Objects )
   {
     return false;
@@ -1045,7 +1445,31 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
 
   while( Objects.Ok() )
   {
-    ViconCGStreamIO::VScopedReader Object( i_rReaderWriter );
+    ViconCGStreamIO::VScopedReader Object( i_rBuffer );
+
+    if( VDynamicObjects::IsDeferrable( Object.Enum() ) )
+    {
+      if( !pDynamicObjects )
+        pDynamicObjects = m_DynamicObjectsPool.Acquire();
+
+      if( m_bLazyDecoding )
+      {
+        // Keep the raw block; it is decoded when the frame is read
+        const unsigned int Offset = i_rBuffer.Offset();
+        if( Offset + Object.Length() > i_rBuffer.Length() )
+        {
+          return false;
+        }
+
+        pDynamicObjects->AddDeferred( Object.Enum(), i_rBuffer.Raw() + Offset, Object.Length() );
+      }
+      else if( !pDynamicObjects->ReadDeferrable( Object.Enum(), i_rBuffer ) )
+      {
+        return false;
+      }
+
+      continue;
+    }
 
     switch( Object.Enum() )
     {
@@ -1060,7 +1484,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::StreamInfo:
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read( pStaticObjects->m_StreamInfo ) )
       {
         return false;
@@ -1075,13 +1499,13 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       }
 
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       pStaticObjects->m_ApplicationInfo = AppInfo;
       break;
     }
     case ViconCGStreamEnum::SubjectInfo:
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read( pStaticObjects->AddSubjectInfo() ) )
       {
         return false;
@@ -1090,7 +1514,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::SubjectTopology:
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read( pStaticObjects->AddSubjectTopology() ) )
       {
         return false;
@@ -1098,7 +1522,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
 
       break;
     case ViconCGStreamEnum::SubjectScale:
-      if( !pStaticObjects ) pStaticObjects.reset(new VStaticObjects());
+      if( !pStaticObjects ) pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read(pStaticObjects->AddSubjectScale()) )
       {
         return false;
@@ -1107,7 +1531,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::SubjectHealth:
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read( pStaticObjects->AddSubjectHealth() ) )
       {
         return false;
@@ -1116,7 +1540,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::ObjectQuality:
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read( pStaticObjects->AddObjectQuality() ) )
       {
         return false;
@@ -1125,7 +1549,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::CameraInfo:
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read( pStaticObjects->AddCameraInfo() ) )
       {
         return false;
@@ -1134,7 +1558,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::CameraSensorInfo:
       if (!pStaticObjects)
-        pStaticObjects.reset(new VStaticObjects());
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if (!Object.Read(pStaticObjects->AddCameraSensorInfo()))
       {
         return false;
@@ -1143,7 +1567,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::CameraCalibrationInfo:
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read( pStaticObjects->AddCameraCalibrationInfo() ) )
       {
         return false;
@@ -1152,7 +1576,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::CameraCalibrationHealth:
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read( pStaticObjects->ResetCameraCalibrationHealth() ) )
       {
         return false;
@@ -1161,7 +1585,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::DeviceInfo:
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read( pStaticObjects->AddDeviceInfo() ) )
       {
         return false;
@@ -1170,7 +1594,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::DeviceInfoExtra:
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read( pStaticObjects->AddDeviceInfoExtra() ) )
       {
         return false;
@@ -1179,7 +1603,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::ChannelInfo:
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read( pStaticObjects->AddChannelInfo() ) )
       {
         return false;
@@ -1188,7 +1612,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::ChannelInfoExtra:
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read( pStaticObjects->AddChannelInfoExtra() ) )
       {
         return false;
@@ -1197,7 +1621,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::ForcePlateInfo:
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read( pStaticObjects->AddForcePlateInfo() ) )
       {
         return false;
@@ -1206,7 +1630,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::EyeTrackerInfo:
       if( !pStaticObjects )
-        pStaticObjects.reset( new VStaticObjects() );
+        pStaticObjects = m_StaticObjectsPool.Acquire();
       if( !Object.Read( pStaticObjects->AddEyeTrackerInfo() ) )
       {
         return false;
@@ -1215,20 +1639,20 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::FrameInfo:
       if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
+        pDynamicObjects = m_DynamicObjectsPool.Acquire();
       if( !Object.Read( pDynamicObjects->m_FrameInfo ) )
       {
         return false;
       }
 
-      if( m_pPostalService )
+      if( auto pTimingLog = std::atomic_load( &m_pTimingLog ) )
       {
-        m_pPostalService->Post( std::bind( &VViconCGStreamClient::TimingLogFunction, this, pDynamicObjects->m_FrameInfo.m_FrameID, PacketReceiptTime ) );
+        pTimingLog->WriteFrame( pDynamicObjects->m_FrameInfo.m_FrameID, PacketReceiptTime );
       }
       break;
     case ViconCGStreamEnum::HardwareFrameInfo:
       if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
+        pDynamicObjects = m_DynamicObjectsPool.Acquire();
       if( !Object.Read( pDynamicObjects->m_HardwareFrameInfo ) )
       {
         return false;
@@ -1237,7 +1661,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       break;
     case ViconCGStreamEnum::Timecode:
       if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
+        pDynamicObjects = m_DynamicObjectsPool.Acquire();
       if( !Object.Read( pDynamicObjects->m_Timecode ) )
       {
         return false;
@@ -1247,7 +1671,7 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
     case ViconCGStreamEnum::LatencyInfo:
     {
       if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
+        pDynamicObjects = m_DynamicObjectsPool.Acquire();
 
       if( !Object.Read( pDynamicObjects->m_LatencyInfo ) )
       {
@@ -1262,37 +1686,10 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
 
       break;
     }
-    case ViconCGStreamEnum::Centroids:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddCentroids() ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::CentroidTracks:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddCentroidTracks() ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::CentroidWeights:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddCentroidWeights() ) )
-      {
-        return false;
-      }
-
-      break;
     case ViconCGStreamEnum::VideoFrame:
     {
       if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
+        pDynamicObjects = m_DynamicObjectsPool.Acquire();
       ViconCGStream::VVideoFrame& rVideoFrame = pDynamicObjects->AddVideoFrame();
       if( !Object.Read( rVideoFrame ) )
       {
@@ -1305,154 +1702,10 @@ bool VViconCGStreamClient::ReadObjects( VCGStreamReaderWriter& i_rReaderWriter )
       }
     }
     break;
-    case ViconCGStreamEnum::LabeledRecons:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->m_LabeledRecons ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::UnlabeledRecons:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->m_UnlabeledRecons ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::LabeledReconRayAssignments:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->m_LabeledRayAssignments ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::GlobalSegments:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddGlobalSegments() ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::LocalSegments:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddLocalSegments() ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::LightweightSegments:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddLightweightSegments() ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::GreyscaleBlobs:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddGreyscaleBlobs() ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::GreyscaleSubsampledBlobs:
-      if (!pDynamicObjects)
-        pDynamicObjects.reset(new VDynamicObjects());
-      if (!Object.Read(pDynamicObjects->AddGreyscaleSubsampledBlobs()))
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::EdgePairs:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddEdgePairs() ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::ForceFrame:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddForceFrame() ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::MomentFrame:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddMomentFrame() ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::CentreOfPressureFrame:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddCentreOfPressureFrame() ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::VoltageFrame:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddVoltageFrame() ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::CameraWand2d:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddCameraWand2d() ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::CameraWand3d:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddCameraWand3d() ) )
-      {
-        return false;
-      }
-
-      break;
-    case ViconCGStreamEnum::EyeTrackerFrame:
-      if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
-      if( !Object.Read( pDynamicObjects->AddEyeTrackerFrame() ) )
-      {
-        return false;
-      }
-
-      break;
 
     case ViconCGStreamEnum::FrameRateInfo:
       if( !pDynamicObjects )
-        pDynamicObjects.reset( new VDynamicObjects() );
+        pDynamicObjects = m_DynamicObjectsPool.Acquire();
       if( !Object.Read( pDynamicObjects->m_FrameRateInfo ) )
       {
         return false;
@@ -1590,16 +1843,6 @@ bool VViconCGStreamClient::CalculateNetworkLatency( double& o_rValue )
   return false;
 }
 
-void VViconCGStreamClient::TimingLogFunction( const unsigned int i_FrameNumber, const double i_rTimestamp )
-{
-  boost::mutex::scoped_lock Lock( m_LogMutex );
-
-  if( m_TimingLog.good() )
-  {
-    m_TimingLog << i_FrameNumber << ", " << i_rTimestamp << std::endl;
-  }
-}
-
 boost::asio::ip::address_v4 VViconCGStreamClient::FirstV4AddressFromString( const std::string& i_rAddress )
 {
   boost::system::error_code Error;
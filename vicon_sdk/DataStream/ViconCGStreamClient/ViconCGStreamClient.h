@@ -25,6 +25,8 @@
 #pragma once
 
 #include "IViconCGStreamClientCallback.h"
+#include "MulticastReceiver.h"
+#include "ObjectPool.h"
 
 #include <boost/asio.hpp>
 
@@ -76,18 +78,24 @@
 #include <ViconCGStream/VideoFrame.h>
 #include <ViconCGStream/VoltageFrame.h>
 
+#include <StreamCommon/Buffer.h>
+
 #include <boost/optional.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
 #include <boost/thread/recursive_mutex.hpp>
 #include <boost/thread/thread.hpp>
+#include <atomic>
 #include <deque>
 #include <memory>
 #include <string>
 #include <chrono>
 #include <fstream>
 
+class VCGStreamExecutor;
 class VCGStreamReaderWriter;
 class VCGStreamPing;
-class VCGStreamPostalService;
+class VTimingTraceWriter;
 
 //-------------------------------------------------------------------------------------------------
 
@@ -155,6 +163,37 @@ public:
   ViconCGStream::VEyeTrackerInfo& AddEyeTrackerInfo();
 
   void BuildMaps();
+
+  // Reset to the default state, keeping the capacity of the containers for reuse by VObjectPool.
+  void Clear();
+
+private:
+  // Elements kept by Clear() for reuse by the Add functions
+  TCameraInfo m_SpareCameraInfo;
+  TCameraSensorInfo m_SpareCameraSensorInfo;
+  TCameraCalibrationInfo m_SpareCameraCalibrationInfo;
+  TSubjectInfo m_SpareSubjectInfo;
+  TSubjectTopology m_SpareSubjectTopology;
+  TSubjectScale m_SpareSubjectScale;
+  TSubjectHealth m_SpareSubjectHealth;
+  TObjectQuality m_SpareObjectQuality;
+  TDeviceInfo m_SpareDeviceInfo;
+  TDeviceInfoExtra m_SpareDeviceInfoExtra;
+  TChannelInfo m_SpareChannelInfo;
+  TChannelInfoExtra m_SpareChannelInfoExtra;
+  TForcePlateInfo m_SpareForcePlateInfo;
+  TEyeTrackerInfo m_SpareEyeTrackerInfo;
+};
+
+//-------------------------------------------------------------------------------------------------
+
+// An object block which has been received but not yet decoded, held in VDynamicObjects::m_DeferredData.
+class VDeferredObject
+{
+public:
+  ViconCGStreamType::Enum m_Enum;
+  unsigned int m_Offset;
+  unsigned int m_Length;
 };
 
 //-------------------------------------------------------------------------------------------------
@@ -162,6 +201,8 @@ public:
 class VDynamicObjects
 {
 public:
+  VDynamicObjects();
+
   ViconCGStream::VFrameInfo m_FrameInfo;
   ViconCGStream::VHardwareFrameInfo m_HardwareFrameInfo;
   ViconCGStream::VTimecode m_Timecode;
@@ -208,6 +249,57 @@ public:
   ViconCGStream::VVideoFrame& AddVideoFrame();
 
   void AddNetworkLatencyInfo( double i_Value );
+
+  // Blocks left encoded when lazy decoding is enabled; see VViconCGStreamClient::SetLazyDecoding.
+  // The raw blocks of a frame are kept together in m_DeferredData, indexed by m_DeferredObjects.
+  // Neither changes once the frame has been handed on.
+  ViconCGStreamIO::VBuffer m_DeferredData;
+  std::vector< VDeferredObject > m_DeferredObjects;
+
+  // Keep the raw block of a deferrable type.
+  void AddDeferred( ViconCGStreamType::Enum i_Enum, const unsigned char * i_pData, unsigned int i_Length );
+
+  // Whether blocks of this type were left encoded.
+  bool IsDeferred( ViconCGStreamType::Enum i_Enum ) const;
+
+  // Decode the blocks of one deferred type into their member, the first time it is called for that type.
+  // May be called on a shared, const frame from any thread; frames which are dropped are never decoded.
+  void DecodeDeferred( ViconCGStreamType::Enum i_Enum ) const;
+
+  // Types whose decoding does not depend on client state, and so may be deferred.
+  static bool IsDeferrable( ViconCGStreamType::Enum i_Enum );
+
+  // Read an object of a deferrable type from the buffer.
+  bool ReadDeferrable( ViconCGStreamType::Enum i_Enum, const ViconCGStreamIO::VBuffer& i_rBuffer );
+
+  // Reset to the default state, keeping the capacity of the containers for reuse by VObjectPool.
+  void Clear();
+
+private:
+  // Elements kept by Clear() for reuse by the Add functions
+  std::vector< ViconCGStream::VCentroids > m_SpareCentroids;
+  std::vector< ViconCGStream::VCentroidTracks > m_SpareCentroidTracks;
+  std::vector< ViconCGStream::VCentroidWeights > m_SpareCentroidWeights;
+  std::vector< ViconCGStream::VLocalSegments > m_SpareLocalSegments;
+  std::vector< ViconCGStream::VGlobalSegments > m_SpareGlobalSegments;
+  std::vector< ViconCGStream::VLightweightSegments > m_SpareLightweightSegments;
+  std::vector< ViconCGStream::VGreyscaleBlobs > m_SpareGreyscaleBlobs;
+  std::vector< ViconCGStream::VGreyscaleSubsampledBlobs > m_SpareGreyscaleSubsampledBlobs;
+  std::vector< ViconCGStream::VEdgePairs > m_SpareEdgePairs;
+  std::vector< ViconCGStream::VForceFrame > m_SpareForceFrames;
+  std::vector< ViconCGStream::VMomentFrame > m_SpareMomentFrames;
+  std::vector< ViconCGStream::VCentreOfPressureFrame > m_SpareCentreOfPressureFrames;
+  std::vector< ViconCGStream::VVoltageFrame > m_SpareVoltageFrames;
+  std::vector< ViconCGStream::VCameraWand2d > m_SpareCameraWand2d;
+  std::vector< ViconCGStream::VCameraWand3d > m_SpareCameraWand3d;
+  std::vector< ViconCGStream::VEyeTrackerFrame > m_SpareEyeTrackerFrames;
+
+  // One bit for each deferrable type
+  static unsigned int DeferredBit( ViconCGStreamType::Enum i_Enum );
+
+  unsigned int m_DeferredTypes;
+  mutable std::atomic< unsigned int > m_DecodedTypes;
+  mutable boost::mutex m_DecodeMutex;
 };
 
 //-------------------------------------------------------------------------------------------------
@@ -242,16 +334,48 @@ public:
     EDecode
   };
   void SetVideoHint( EVideoHint i_VideoHint );
+
+  // When enabled, deferrable dynamic objects are indexed by type and kept as raw blocks
+  // rather than being decoded on the network thread.
+  void SetLazyDecoding( bool i_bLazy );
+
+  // Tuning for the multicast receive path; applies from the next call to ReceiveMulticastData
+  void SetMulticastReceiveOptions( const VMulticastReceiveOptions & i_rOptions );
+
+  // Counters for the current multicast receiver; returns false if not receiving multicast data
+  bool GetMulticastReceiveStats( VMulticastReceiveStats & o_rStats ) const;
+
+  // Run the connection as asynchronous operations on a shared executor rather than on a thread of its own.
+  // Pass null to return to a dedicated thread. Applies from the next call to Connect or ReceiveMulticastData.
+  void SetExecutor( std::shared_ptr< VCGStreamExecutor > i_pExecutor );
+
   bool SetTimingLogFile( const std::string & i_rFilename );
   std::string HostName() const;
 
 protected:
+  void StartClient();
   void ClientThread();
 
+  // Asynchronous mode; every handler runs on m_pAsyncStrand
+  void AsyncRead( bool i_bObjectEnums );
+  void OnAsyncRead( bool i_bObjectEnums, bool i_bOk );
+  void AsyncWrite();
+  void OnAsyncWrite( const boost::system::error_code & i_rError );
+  void AsyncReceive();
+  void OnAsyncReceive( const boost::system::error_code & i_rError );
+  void OnAsyncStopped();
+  void StopAsync();
+
   bool ReadObjectEnums( VCGStreamReaderWriter& i_rReaderWriter );
   bool WriteObjects( VCGStreamReaderWriter& i_rReaderWriter );
   bool ReadObjects( VCGStreamReaderWriter& i_rReaderWriter );
 
+  // Write any objects which have changed into m_WriteBuffer; returns false if there is nothing to send
+  bool BuildObjects();
+
+  bool ParseObjectEnums( ViconCGStreamIO::VBuffer& i_rBuffer );
+  bool ParseObjects( ViconCGStreamIO::VBuffer& i_rBuffer );
+
   void CopyObjects( const ViconCGStream::VContents& i_rContents, const VStaticObjects& i_rStaticObjects, VStaticObjects& o_rStaticObjects ) const;
   void CopyObjects( const ViconCGStream::VContents& i_rContents, const VDynamicObjects& i_rDynamicObjects, VDynamicObjects& o_rDynamicObjects ) const;
 
@@ -263,7 +387,6 @@ protected:
   void OnDisconnect() const;
 
   bool CalculateNetworkLatency( double& o_rValue );
-  void TimingLogFunction( const unsigned int i_FrameNumber, const double i_rTimestamp );
   void CloseLog();
 
   boost::asio::ip::address_v4 FirstV4AddressFromString( const std::string& i_rAddress );
@@ -272,16 +395,36 @@ protected:
 
   std::weak_ptr< IViconCGStreamClientCallback > m_pCallback;
 
+  // Declared ahead of the sockets, which may belong to its service
+  std::shared_ptr< VCGStreamExecutor > m_pExecutor;
+
   boost::asio::io_service m_Service;
   std::shared_ptr< boost::asio::ip::tcp::socket > m_pSocket;
   std::shared_ptr< boost::asio::ip::udp::socket > m_pMulticastSocket;
+  std::shared_ptr< VMulticastReceiver > m_pMulticastReceiver;
+  VMulticastReceiveOptions m_MulticastReceiveOptions;
+  mutable boost::mutex m_MulticastReceiverMutex;
 
   std::shared_ptr< boost::thread > m_pClientThread;
 
+  std::shared_ptr< boost::asio::io_service::strand > m_pAsyncStrand;
+  std::shared_ptr< VCGStreamReaderWriter > m_pAsyncReaderWriter;
+  bool m_bAsyncRunning;
+  boost::mutex m_AsyncMutex;
+  boost::condition_variable m_AsyncStopped;
+
   boost::recursive_mutex m_Mutex;
+
+  // Objects to send to the server; kept apart from the read buffer, which may hold staged blocks
+  ViconCGStreamIO::VBuffer m_WriteBuffer;
+
   std::shared_ptr< const VStaticObjects > m_pStaticObjects;
   std::shared_ptr< const VDynamicObjects > m_pDynamicObjects;
 
+  // Recycled frame objects; released frames return here so their vectors keep their capacity
+  VObjectPool< VStaticObjects > m_StaticObjectsPool;
+  VObjectPool< VDynamicObjects > m_DynamicObjectsPool;
+
   ViconCGStream::VObjectEnums m_ServerObjects;
   ViconCGStream::VObjectEnums m_RequiredObjects;
   ViconCGStream::VFilter m_Filter;
@@ -297,11 +440,12 @@ protected:
   std::deque< double > m_PingRoundTrips;
 
   EVideoHint m_VideoHint;
+  bool m_bLazyDecoding;
   std::vector< unsigned char > m_ScratchVideo;
   std::set< unsigned int > m_OnDeviceList;
 
-  std::shared_ptr< VCGStreamPostalService > m_pPostalService;
-  std::ofstream m_TimingLog;
+  // Read by the client thread without locking; replaced under m_LogMutex
+  std::shared_ptr< VTimingTraceWriter > m_pTimingLog;
   boost::mutex m_LogMutex;
   std::string m_HostName;
 };
@@ -26,6 +26,8 @@
 
 #include "ICGFrameState.h"
 
+#include <ViconCGStreamClient/CGStreamExecutor.h>
+
 #include <functional>
 #include <boost/thread/xtime.hpp>
 
@@ -81,10 +83,31 @@ public:
 
 /*********************************************************************/
 
+namespace
+{
+  // Blocks left encoded by lazy decoding are decoded by the dynamic objects when first accessed
+  template< typename T >
+  void ShareDynamic( VCopyOnWrite< T > & o_rTarget, const std::shared_ptr< const VDynamicObjects > & i_rpDynamicState, const T & i_rMember, ViconCGStreamType::Enum i_Enum )
+  {
+    if( i_rpDynamicState->IsDeferred( i_Enum ) )
+    {
+      o_rTarget.ShareDeferred( i_rpDynamicState, i_rMember, i_Enum );
+    }
+    else
+    {
+      o_rTarget.Share( i_rpDynamicState, i_rMember );
+    }
+  }
+}
+
+/*********************************************************************/
+
 VCGClient::VCGClient()
 : m_bMulticastReceiving( false )
 , m_bMulticastController( false )
-, m_MaxBufferSize( 1 )
+, m_pFrameQueue( std::make_shared< TFrameQueue >( 1 ) )
+, m_DropPolicy( EDropOldest )
+, m_bLazyDecoding( false )
 {
 }
 
@@ -97,43 +120,36 @@ void VCGClient::Destroy()
   delete this;
 }
 
+std::shared_ptr< VCGClient::TFrameQueue > VCGClient::FrameQueue() const
+{
+  return std::atomic_load( &m_pFrameQueue );
+}
+
 bool VCGClient::PollFrames( std::vector< ICGFrameState > & o_rFrames )
 {
-  TFrameDeque FrameDeque;
+  std::shared_ptr< TFrameQueue > pFrameQueue = FrameQueue();
 
-  {
-    boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
-    std::swap( m_FrameDeque, FrameDeque );
-  }
-  
-  o_rFrames.resize( FrameDeque.size() );
-  if( FrameDeque.empty() )
-  {
-    return false;
-  }
+  // Only take the frames which are already buffered, so that a fast producer cannot keep us here
+  const std::size_t Count = pFrameQueue->Size();
+  o_rFrames.resize( Count );
 
-  TFrameDeque::iterator It = FrameDeque.begin();
-  TFrameDeque::iterator End = FrameDeque.end();
-  unsigned int Index = 0;
-  for( ; It != End; ++It, ++Index )
+  std::size_t Index = 0;
+  TFramePair FramePair;
+  while( Index != Count && pFrameQueue->Pop( FramePair ) )
   {
-    ICGFrameState & rCGFrameState = o_rFrames[ Index ];
-    ReadFramePair( *It, rCGFrameState );
+    ReadFramePair( FramePair, o_rFrames[ Index++ ] );
   }
-  return true;
+
+  o_rFrames.resize( Index );
+  return Index != 0;
 }
 
 bool VCGClient::PollFrame( ICGFrameState & o_rFrame )
 {
   TFramePair FramePair;
+  if( !FrameQueue()->Pop( FramePair ) )
   {
-    boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
-    if( m_FrameDeque.empty() )
-    {
-      return false;
-    }
-    FramePair = m_FrameDeque.front();
-    m_FrameDeque.pop_front();
+    return false;
   }
   
   ReadFramePair( FramePair, o_rFrame );
@@ -143,27 +159,28 @@ bool VCGClient::PollFrame( ICGFrameState & o_rFrame )
 void VCGClient::ReadFramePair( const TFramePair& i_rPair, ICGFrameState& o_rFrameState )
 {
   const std::shared_ptr< const VStaticObjects > & rpStaticState = i_rPair.first;
+  o_rFrameState.m_pStaticObjects = rpStaticState;
   if ( rpStaticState )
   {
     o_rFrameState.m_Stream = rpStaticState->m_StreamInfo;
     if( rpStaticState->m_pCameraCalibrationHealth )
     {
-      o_rFrameState.m_CameraCalibrationHealth = *(rpStaticState->m_pCameraCalibrationHealth);
+      o_rFrameState.m_CameraCalibrationHealth.Share( rpStaticState->m_pCameraCalibrationHealth );
     }
-    o_rFrameState.m_CameraCalibrations = rpStaticState->m_CameraCalibrationInfo;
-    o_rFrameState.m_Cameras = rpStaticState->m_CameraInfo;
-    o_rFrameState.m_CamerasSensorInfo = rpStaticState->m_CameraSensorInfo;
-    o_rFrameState.m_Subjects = rpStaticState->m_SubjectInfo;
-    o_rFrameState.m_SubjectTopologies = rpStaticState->m_SubjectTopology;
-    o_rFrameState.m_SubjectScales = rpStaticState->m_SubjectScale;
-    o_rFrameState.m_SubjectHealths = rpStaticState->m_SubjectHealth;
-    o_rFrameState.m_ObjectQualities = rpStaticState->m_ObjectQuality;
-    o_rFrameState.m_Devices = rpStaticState->m_DeviceInfo;
-    o_rFrameState.m_DevicesExtra = rpStaticState->m_DeviceInfoExtra;
-    o_rFrameState.m_Channels = rpStaticState->m_ChannelInfo;
-    o_rFrameState.m_ChannelUnits = rpStaticState->m_ChannelInfoExtra;
-    o_rFrameState.m_ForcePlates = rpStaticState->m_ForcePlateInfo;
-    o_rFrameState.m_EyeTrackers = rpStaticState->m_EyeTrackerInfo;
+    o_rFrameState.m_CameraCalibrations.Share( rpStaticState, rpStaticState->m_CameraCalibrationInfo );
+    o_rFrameState.m_Cameras.Share( rpStaticState, rpStaticState->m_CameraInfo );
+    o_rFrameState.m_CamerasSensorInfo.Share( rpStaticState, rpStaticState->m_CameraSensorInfo );
+    o_rFrameState.m_Subjects.Share( rpStaticState, rpStaticState->m_SubjectInfo );
+    o_rFrameState.m_SubjectTopologies.Share( rpStaticState, rpStaticState->m_SubjectTopology );
+    o_rFrameState.m_SubjectScales.Share( rpStaticState, rpStaticState->m_SubjectScale );
+    o_rFrameState.m_SubjectHealths.Share( rpStaticState, rpStaticState->m_SubjectHealth );
+    o_rFrameState.m_ObjectQualities.Share( rpStaticState, rpStaticState->m_ObjectQuality );
+    o_rFrameState.m_Devices.Share( rpStaticState, rpStaticState->m_DeviceInfo );
+    o_rFrameState.m_DevicesExtra.Share( rpStaticState, rpStaticState->m_DeviceInfoExtra );
+    o_rFrameState.m_Channels.Share( rpStaticState, rpStaticState->m_ChannelInfo );
+    o_rFrameState.m_ChannelUnits.Share( rpStaticState, rpStaticState->m_ChannelInfoExtra );
+    o_rFrameState.m_ForcePlates.Share( rpStaticState, rpStaticState->m_ForcePlateInfo );
+    o_rFrameState.m_EyeTrackers.Share( rpStaticState, rpStaticState->m_EyeTrackerInfo );
     o_rFrameState.m_ApplicationInfo = rpStaticState->m_ApplicationInfo;
   }
 
@@ -173,27 +190,27 @@ void VCGClient::ReadFramePair( const TFramePair& i_rPair, ICGFrameState& o_rFram
     o_rFrameState.m_Frame = rpDynamicState->m_FrameInfo;
     o_rFrameState.m_HardwareFrame = rpDynamicState->m_HardwareFrameInfo;
     o_rFrameState.m_Timecode = rpDynamicState->m_Timecode;
-    o_rFrameState.m_Latency = rpDynamicState->m_LatencyInfo;
-    o_rFrameState.m_FrameRateInfo = rpDynamicState->m_FrameRateInfo;
-    o_rFrameState.m_EdgePairs = rpDynamicState->m_EdgePairs;
-    o_rFrameState.m_GreyscaleBlobs = rpDynamicState->m_GreyscaleBlobs;
-    o_rFrameState.m_GreyscaleSubsampledBlobs = rpDynamicState->m_GreyscaleSubsampledBlobs;
-    o_rFrameState.m_Centroids = rpDynamicState->m_Centroids;
-    o_rFrameState.m_CentroidTracks = rpDynamicState->m_CentroidTracks;
-    o_rFrameState.m_CentroidWeights = rpDynamicState->m_CentroidWeights;
-    o_rFrameState.m_UnlabeledRecons.m_UnlabeledRecons = rpDynamicState->m_UnlabeledRecons.m_UnlabeledRecons;
-    o_rFrameState.m_LabeledRecons.m_LabeledRecons = rpDynamicState->m_LabeledRecons.m_LabeledRecons;
-    o_rFrameState.m_LabeledReconRayAssignments.m_ReconRayAssignments = rpDynamicState->m_LabeledRayAssignments.m_ReconRayAssignments;
-    o_rFrameState.m_Voltages = rpDynamicState->m_VoltageFrames;
-    o_rFrameState.m_Forces = rpDynamicState->m_ForceFrames;
-    o_rFrameState.m_Moments = rpDynamicState->m_MomentFrames;
-    o_rFrameState.m_CentresOfPressure = rpDynamicState->m_CentreOfPressureFrames;
-    o_rFrameState.m_GlobalSegments = rpDynamicState->m_GlobalSegments;
-    o_rFrameState.m_LocalSegments = rpDynamicState->m_LocalSegments;
-    o_rFrameState.m_LightweightSegments = rpDynamicState->m_LightweightSegments;
-    o_rFrameState.m_CameraWand2d = rpDynamicState->m_CameraWand2d;
-    o_rFrameState.m_CameraWand3d = rpDynamicState->m_CameraWand3d;
-    o_rFrameState.m_EyeTracks = rpDynamicState->m_EyeTrackerFrames;
+    o_rFrameState.m_Latency.Share( rpDynamicState, rpDynamicState->m_LatencyInfo );
+    o_rFrameState.m_FrameRateInfo.Share( rpDynamicState, rpDynamicState->m_FrameRateInfo );
+    ShareDynamic( o_rFrameState.m_EdgePairs, rpDynamicState, rpDynamicState->m_EdgePairs, ViconCGStreamEnum::EdgePairs );
+    ShareDynamic( o_rFrameState.m_GreyscaleBlobs, rpDynamicState, rpDynamicState->m_GreyscaleBlobs, ViconCGStreamEnum::GreyscaleBlobs );
+    ShareDynamic( o_rFrameState.m_GreyscaleSubsampledBlobs, rpDynamicState, rpDynamicState->m_GreyscaleSubsampledBlobs, ViconCGStreamEnum::GreyscaleSubsampledBlobs );
+    ShareDynamic( o_rFrameState.m_Centroids, rpDynamicState, rpDynamicState->m_Centroids, ViconCGStreamEnum::Centroids );
+    ShareDynamic( o_rFrameState.m_CentroidTracks, rpDynamicState, rpDynamicState->m_CentroidTracks, ViconCGStreamEnum::CentroidTracks );
+    ShareDynamic( o_rFrameState.m_CentroidWeights, rpDynamicState, rpDynamicState->m_CentroidWeights, ViconCGStreamEnum::CentroidWeights );
+    ShareDynamic( o_rFrameState.m_UnlabeledRecons, rpDynamicState, rpDynamicState->m_UnlabeledRecons, ViconCGStreamEnum::UnlabeledRecons );
+    ShareDynamic( o_rFrameState.m_LabeledRecons, rpDynamicState, rpDynamicState->m_LabeledRecons, ViconCGStreamEnum::LabeledRecons );
+    ShareDynamic( o_rFrameState.m_LabeledReconRayAssignments, rpDynamicState, rpDynamicState->m_LabeledRayAssignments, ViconCGStreamEnum::LabeledReconRayAssignments );
+    ShareDynamic( o_rFrameState.m_Voltages, rpDynamicState, rpDynamicState->m_VoltageFrames, ViconCGStreamEnum::VoltageFrame );
+    ShareDynamic( o_rFrameState.m_Forces, rpDynamicState, rpDynamicState->m_ForceFrames, ViconCGStreamEnum::ForceFrame );
+    ShareDynamic( o_rFrameState.m_Moments, rpDynamicState, rpDynamicState->m_MomentFrames, ViconCGStreamEnum::MomentFrame );
+    ShareDynamic( o_rFrameState.m_CentresOfPressure, rpDynamicState, rpDynamicState->m_CentreOfPressureFrames, ViconCGStreamEnum::CentreOfPressureFrame );
+    ShareDynamic( o_rFrameState.m_GlobalSegments, rpDynamicState, rpDynamicState->m_GlobalSegments, ViconCGStreamEnum::GlobalSegments );
+    ShareDynamic( o_rFrameState.m_LocalSegments, rpDynamicState, rpDynamicState->m_LocalSegments, ViconCGStreamEnum::LocalSegments );
+    ShareDynamic( o_rFrameState.m_LightweightSegments, rpDynamicState, rpDynamicState->m_LightweightSegments, ViconCGStreamEnum::LightweightSegments );
+    ShareDynamic( o_rFrameState.m_CameraWand2d, rpDynamicState, rpDynamicState->m_CameraWand2d, ViconCGStreamEnum::CameraWand2d );
+    ShareDynamic( o_rFrameState.m_CameraWand3d, rpDynamicState, rpDynamicState->m_CameraWand3d, ViconCGStreamEnum::CameraWand3d );
+    ShareDynamic( o_rFrameState.m_EyeTracks, rpDynamicState, rpDynamicState->m_EyeTrackerFrames, ViconCGStreamEnum::EyeTrackerFrame );
   }
 
   o_rFrameState.m_VideoFrames.clear();
@@ -205,37 +222,27 @@ void VCGClient::ReadFramePair( const TFramePair& i_rPair, ICGFrameState& o_rFram
 
 bool VCGClient::WaitFrames( std::vector< ICGFrameState > & o_rFrames, unsigned int i_TimeoutMs )
 {
-  boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
-
-  boost::xtime WaitDeadline;
-
-  // boost::TIME_UTC has been renamed to boost::TIME_UTC_ in Boost 1.50:
-  // https://svn.boost.org/trac/boost/ticket/6940
-#if BOOST_VERSION >= 105000
-  boost::xtime_get( &WaitDeadline, boost::TIME_UTC_ );
-#else
-  boost::xtime_get( &WaitDeadline, boost::TIME_UTC );
-#endif
-  boost::xtime::xtime_sec_t  AdditionalSeconds     = static_cast< boost::xtime::xtime_sec_t  >( static_cast< double >( i_TimeoutMs ) / 1000.0 );
-  boost::xtime::xtime_nsec_t AdditionalNanoSeconds = static_cast< boost::xtime::xtime_nsec_t >( ( i_TimeoutMs - ( 1000 * AdditionalSeconds ) ) * 1000000 );
- 
-  WaitDeadline.sec += AdditionalSeconds;
-  WaitDeadline.nsec += AdditionalNanoSeconds;
-
-  while( m_FrameDeque.empty() )
+  if( !WaitForFrames( i_TimeoutMs ) )
   {
-    if( !m_NewFramesCondition.timed_wait( Lock, WaitDeadline ) )
-    {
-      return false;
-    }
+    return false;
   }
-  
+
   return PollFrames( o_rFrames );
 }
 
 bool VCGClient::WaitFrame( ICGFrameState& o_rFrame, unsigned int i_TimeoutMs )
 {
-  boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
+  if( !WaitForFrames( i_TimeoutMs ) )
+  {
+    return false;
+  }
+
+  return PollFrame( o_rFrame );
+}
+
+bool VCGClient::WaitForFrames( unsigned int i_TimeoutMs )
+{
+  boost::mutex::scoped_lock Lock( m_NewFramesMutex );
 
   boost::xtime WaitDeadline;
 
@@ -252,15 +259,21 @@ bool VCGClient::WaitFrame( ICGFrameState& o_rFrame, unsigned int i_TimeoutMs )
   WaitDeadline.sec += AdditionalSeconds;
   WaitDeadline.nsec += AdditionalNanoSeconds;
 
-  while( m_FrameDeque.empty() )
+  while( FrameQueue()->Empty() )
   {
     if( !m_NewFramesCondition.timed_wait( Lock, WaitDeadline ) )
     {
       return false;
     }
   }
-  
-  return PollFrame( o_rFrame );
+
+  return true;
+}
+
+void VCGClient::SetNewFrameCallback( std::function< void( unsigned int ) > i_Callback )
+{
+  boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
+  m_NewFrameCallback = i_Callback;
 }
 
 void VCGClient::Connect( std::string i_IPAddress, unsigned short i_Port )
@@ -277,13 +290,16 @@ void VCGClient::Connect( const std::vector< std::pair< std::string, unsigned sho
     std::shared_ptr< VCGClientCallback > pCallback(new VCGClientCallback(*this, m_pCallbacks.size()) );
     std::shared_ptr< VViconCGStreamClient > pClient( new VViconCGStreamClient( pCallback ) );
 
+    pClient->SetExecutor( m_pExecutor );
     pClient->Connect( rHost.first, rHost.second );
 
     pClient->SetRequiredObjects(m_RequestedObjects.m_Enums);
+    pClient->SetLazyDecoding( m_bLazyDecoding );
+    pClient->SetMulticastReceiveOptions( m_MulticastReceiveOptions );
 
     m_pCallbacks.push_back( pCallback );
     m_pClients.push_back( pClient );
-    m_LastFrameIDs.push_back(-1);
+    m_FrameMerger.AddLink();
   }
 }
 
@@ -293,12 +309,84 @@ void VCGClient::ReceiveMulticastData( std::string i_MulticastIPAddress, std::str
 
   for (auto pClient : m_pClients)
   {
+    pClient->SetExecutor( m_pExecutor );
     pClient->ReceiveMulticastData(i_MulticastIPAddress, i_LocalIPAddress, i_Port);
   }
 
   m_bMulticastReceiving = !m_pClients.empty();
 }
 
+void VCGClient::SetMulticastReceiveOptions( const VMulticastReceiveOptions & i_rOptions )
+{
+  boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
+
+  m_MulticastReceiveOptions = i_rOptions;
+  for (auto pClient : m_pClients)
+  {
+    pClient->SetMulticastReceiveOptions( i_rOptions );
+  }
+}
+
+void VCGClient::SetExecutorThreads( unsigned int i_ThreadCount )
+{
+  boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
+
+  if( i_ThreadCount == 0 )
+  {
+    m_pExecutor.reset();
+  }
+  else
+  {
+    m_pExecutor = VCGStreamExecutor::Shared( i_ThreadCount );
+  }
+}
+
+bool VCGClient::GetMulticastReceiveStats( VMulticastReceiveStats & o_rStats ) const
+{
+  boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
+
+  o_rStats = VMulticastReceiveStats();
+  bool bReceiving = false;
+  for (auto pClient : m_pClients)
+  {
+    VMulticastReceiveStats ClientStats;
+    if( pClient->GetMulticastReceiveStats( ClientStats ) )
+    {
+      o_rStats.Accumulate( ClientStats );
+      bReceiving = true;
+    }
+  }
+
+  return bReceiving;
+}
+
+void VCGClient::SetBufferDropPolicy( EFrameDropPolicy i_DropPolicy )
+{
+  boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
+
+  m_DropPolicy = i_DropPolicy;
+  m_pFrameQueue->SetDropPolicy( i_DropPolicy );
+}
+
+VFrameQueueStats VCGClient::GetBufferStats() const
+{
+  return FrameQueue()->Stats();
+}
+
+void VCGClient::GetLinkStats( std::vector< VLinkStats > & o_rStats ) const
+{
+  boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
+
+  o_rStats.resize( m_FrameMerger.LinkCount() );
+  for( std::size_t Link = 0; Link != o_rStats.size(); ++Link )
+  {
+    o_rStats[ Link ] = m_FrameMerger.Stats( Link );
+
+    const auto ConnectedIt = m_Connected.find( Link );
+    o_rStats[ Link ].m_bConnected = ConnectedIt != m_Connected.end() && ConnectedIt->second;
+  }
+}
+
 void VCGClient::StopReceivingMulticastData()
 {
   boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
@@ -348,11 +436,23 @@ void VCGClient::SetBufferSize( unsigned int i_MaxFrames )
 {
   boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
 
-  m_MaxBufferSize = i_MaxFrames;
-  while( m_FrameDeque.size() > i_MaxFrames )
+  if( i_MaxFrames == m_pFrameQueue->Capacity() )
+  {
+    return;
+  }
+
+  // Move the newest frames that fit across; producers are held off by the lock, but the reader may still
+  // be popping from the old queue, which is safe as each frame can only be popped once.
+  std::shared_ptr< TFrameQueue > pFrameQueue = std::make_shared< TFrameQueue >( i_MaxFrames, m_DropPolicy );
+
+  TFramePair FramePair;
+  while( m_pFrameQueue->Pop( FramePair ) )
   {
-    m_FrameDeque.pop_front();
+    pFrameQueue->Push( std::move( FramePair ) );
   }
+
+  pFrameQueue->AddStats( m_pFrameQueue->Stats() );
+  std::atomic_store( &m_pFrameQueue, pFrameQueue );
 }
 
 void VCGClient::SetDecodeVideo( bool i_bDecode )
@@ -365,6 +465,17 @@ void VCGClient::SetDecodeVideo( bool i_bDecode )
   }
 }
 
+void VCGClient::SetLazyDecoding( bool i_bLazy )
+{
+  boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
+
+  m_bLazyDecoding = i_bLazy;
+  for (auto pClient : m_pClients)
+  {
+    pClient->SetLazyDecoding( i_bLazy );
+  }
+}
+
 void VCGClient::SetStreamMode( bool i_bStream )
 {
   boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
@@ -417,9 +528,7 @@ void VCGClient::RequestNextFrame()
 
 void VCGClient::ClearBuffer()
 {
-  boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
-  TFrameDeque FrameDeque;
-  std::swap( m_FrameDeque, FrameDeque );
+  FrameQueue()->Clear();
 }
 
 bool VCGClient::SetLogFile(const std::string& i_rLog)
@@ -525,45 +634,45 @@ void VCGClient::OnStaticObjects( std::shared_ptr< const VStaticObjects > i_pStat
 
 void VCGClient::OnDynamicObjects( std::shared_ptr< const VDynamicObjects > i_pDynamicObjects, size_t i_ClientID)
 {
-  boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
-
-
   const ViconCGStreamType::UInt32 ThisFrame = i_pDynamicObjects->m_FrameInfo.m_FrameID;
 
-  m_LastFrameIDs[i_ClientID] = ThisFrame;
-
-  // If we only have one client we always accept the frame.
-  if( m_LastFrameIDs.size() > 1 )
+  std::function< void( unsigned int ) > NewFrameCallback;
+  std::shared_ptr< TFrameQueue > pFrameQueue;
+  TFramePair FramePair;
   {
-    // Check to see if the fame has already been received.
-    const ViconCGStreamType::UInt32 LastFrame = [&]() {
-      // The last frame received by connections other than this one.
-      // Note that the FrameID can get reset by a system reboot.
-      ViconCGStreamType::UInt32 MaxFrame = 0;
-      for (unsigned int Index = 0; Index < m_LastFrameIDs.size(); ++Index)
-      {
-        if (Index == i_ClientID)
-        {
-          continue;
-        }
-        MaxFrame = std::max(m_LastFrameIDs[Index], MaxFrame);
-      }
-      return MaxFrame;
-    }();
+    boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
 
-    if (ThisFrame <= LastFrame)
+    // Only pass on the first copy of each frame from redundant connections
+    if( !m_FrameMerger.Accept( i_ClientID, ThisFrame ) )
     {
       return;
     }
+
+    pFrameQueue = m_pFrameQueue;
+    FramePair = TFramePair( m_pLastStaticObjects, i_pDynamicObjects );
+    NewFrameCallback = m_NewFrameCallback;
   }
 
-  m_FrameDeque.push_back( TFramePair( m_pLastStaticObjects, i_pDynamicObjects ) );
-  while( m_FrameDeque.size() > m_MaxBufferSize )
+  // The queue takes concurrent pushes, so connections only share the lock for the bookkeeping above
+  pFrameQueue->Push( std::move( FramePair ) );
+
+  // If the buffer was resized meanwhile, the old queue may have been drained before our push; carry it across
+  std::shared_ptr< TFrameQueue > pCurrentQueue = FrameQueue();
+  if( pCurrentQueue != pFrameQueue )
   {
-    m_FrameDeque.pop_front();
+    while( pFrameQueue->Pop( FramePair ) )
+    {
+      pCurrentQueue->Push( std::move( FramePair ) );
+    }
   }
 
-  m_NewFramesCondition.notify_all();
+  NotifyNewFrames();
+
+  // Call out without the lock held, so that the callback is free to fetch the frame.
+  if( NewFrameCallback )
+  {
+    NewFrameCallback( ThisFrame );
+  }
 }
 
 void VCGClient::OnDisconnect( size_t i_ClientID )
@@ -571,6 +680,15 @@ void VCGClient::OnDisconnect( size_t i_ClientID )
   boost::recursive_mutex::scoped_lock Lock( m_ClientMutex );
 
   m_Connected[i_ClientID] = false;
+  NotifyNewFrames();
+}
+
+void VCGClient::NotifyNewFrames()
+{
+  // Waiters check the queue with m_NewFramesMutex held, so taking it here means none can miss the notification
+  {
+    boost::mutex::scoped_lock Lock( m_NewFramesMutex );
+  }
   m_NewFramesCondition.notify_all();
 }
 
@@ -24,12 +24,14 @@
 //////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include "FrameMerger.h"
+#include "FrameQueue.h"
 #include "ICGClient.h"
 #include "ICGFrameState.h"
 #include <ViconCGStreamClient/IViconCGStreamClientCallback.h>
 #include <ViconCGStreamClient/ViconCGStreamClient.h>
 #include <boost/thread/condition.hpp>
-#include <deque>
+#include <boost/thread/mutex.hpp>
 
 namespace ViconCGStreamClientSDK
 {
@@ -54,10 +56,17 @@ public:
 
   virtual bool IsConnected() const override;
   virtual bool IsMulticastReceiving() const override;
+  virtual void SetMulticastReceiveOptions( const VMulticastReceiveOptions & i_rOptions ) override;
+  virtual bool GetMulticastReceiveStats( VMulticastReceiveStats & o_rStats ) const override;
+  virtual void SetExecutorThreads( unsigned int i_ThreadCount ) override;
+  virtual void SetBufferDropPolicy( EFrameDropPolicy i_DropPolicy ) override;
+  virtual VFrameQueueStats GetBufferStats() const override;
+  virtual void GetLinkStats( std::vector< VLinkStats > & o_rStats ) const override;
 
   virtual bool SetRequestTypes( ViconCGStreamType::Enum i_RequestedType, bool i_bEnable = true) override;
   virtual void SetBufferSize( unsigned int i_MaxFrames ) override;
   virtual void SetDecodeVideo( bool i_bDecode ) override;
+  virtual void SetLazyDecoding( bool i_bLazy ) override;
   virtual void SetStreamMode( bool i_bStream ) override;
   virtual void SetServerToTransmitMulticast( std::string i_MulticastIPAddress, std::string i_ServerIPAddress, unsigned short i_Port ) override;
   virtual void StopMulticastTransmission() override;
@@ -69,6 +78,8 @@ public:
   virtual bool WaitFrames( std::vector< ICGFrameState > & o_rFrames, unsigned int i_TimeoutMs ) override;
   virtual bool WaitFrame( ICGFrameState& o_rFrame, unsigned int i_TimeoutMs ) override;
 
+  virtual void SetNewFrameCallback( std::function< void( unsigned int ) > i_Callback ) override;
+
   // maintains a list of devices with haptic feedback on. 
   // if on add to the list,
   // if off delete from the list if existed in the list.
@@ -95,14 +106,20 @@ protected:
 
   // Buffer
   typedef std::pair< std::shared_ptr< const VStaticObjects >, std::shared_ptr< const VDynamicObjects > > TFramePair;
-  typedef std::deque< TFramePair > TFrameDeque;
+  typedef VFrameQueue< TFramePair > TFrameQueue;
+
+  std::shared_ptr< TFrameQueue > FrameQueue() const;
 
   void ReadFramePair( const TFramePair& i_rPair, ICGFrameState& o_rFrameState );
 
+  // Sleep until the frame queue is not empty; frames are then popped and read without any lock held
+  bool WaitForFrames( unsigned int i_TimeoutMs );
+  void NotifyNewFrames();
+
   // The C++ client which does all of the work for us
   std::vector< std::shared_ptr< VViconCGStreamClient > > m_pClients;
   std::vector< std::shared_ptr< VCGClientCallback > >    m_pCallbacks;
-  std::vector< ViconCGStreamType::UInt32 >               m_LastFrameIDs;
+  VFrameMerger                                           m_FrameMerger;
   std::map< size_t, bool >                               m_Connected;
   bool                                      m_bMulticastReceiving;
   bool                                      m_bMulticastController;
@@ -113,10 +130,19 @@ protected:
           ViconCGStream::VObjectEnums m_RequestedObjects;
 
   std::shared_ptr< const VStaticObjects >   m_pLastStaticObjects;
-  TFrameDeque                               m_FrameDeque;
-  unsigned int                              m_MaxBufferSize;
 
+  // Read without m_ClientMutex, using the atomic shared_ptr functions; only replaced by SetBufferSize,
+  // with m_ClientMutex held so that producers, which push under it, never push into a retired queue.
+  std::shared_ptr< TFrameQueue >            m_pFrameQueue;
+  EFrameDropPolicy                          m_DropPolicy;
+  bool                                      m_bLazyDecoding;
+  VMulticastReceiveOptions                  m_MulticastReceiveOptions;
+  std::shared_ptr< VCGStreamExecutor >      m_pExecutor;
+
+  // Only used to sleep while the frame queue is empty, so that waiting never holds m_ClientMutex
+  boost::mutex                              m_NewFramesMutex;
   boost::condition                          m_NewFramesCondition; 
+  std::function< void( unsigned int ) >     m_NewFrameCallback;
 };
 
 } // End of namespace ViconCGStreamClientSDK
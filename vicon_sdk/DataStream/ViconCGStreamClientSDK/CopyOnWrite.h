@@ -0,0 +1,136 @@
+
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <memory>
+
+namespace ViconCGStreamClientSDK
+{
+
+// A read-only reference to an object which is usually part of another shared object, such as a member
+// of the VStaticObjects or VDynamicObjects a frame was read from, which it keeps alive.
+// Copying the reference never copies the object. Mutable() makes a private copy unless this reference
+// already holds the only reference to a copy of its own, so consumers that modify a frame do not affect
+// anyone else sharing it.
+// A member may also be shared before it has been decoded; the owner then decodes it on first access.
+template< typename T >
+class VCopyOnWrite
+{
+public:
+  VCopyOnWrite()
+  : m_pObject( Empty() )
+  , m_bOwned( false )
+  , m_pDecode( nullptr )
+  , m_pOwner( nullptr )
+  , m_Key( 0 )
+  {
+  }
+
+  // Refer to a member of a shared object, which is kept alive for as long as this reference
+  template< typename TOwner >
+  void Share( const std::shared_ptr< TOwner > & i_rpOwner, const T & i_rMember )
+  {
+    m_pObject = std::shared_ptr< const T >( i_rpOwner, &i_rMember );
+    m_bOwned = false;
+    m_pDecode = nullptr;
+  }
+
+  // Refer to a member of a shared object which is filled in by i_rpOwner->DecodeDeferred( i_Key ) when first accessed.
+  // DecodeDeferred must be safe to call concurrently and return quickly once the member has been decoded.
+  template< typename TOwner, typename TKey >
+  void ShareDeferred( const std::shared_ptr< TOwner > & i_rpOwner, const T & i_rMember, TKey i_Key )
+  {
+    Share( i_rpOwner, i_rMember );
+    m_pDecode = &DecodeOwner< TOwner, TKey >;
+    m_pOwner = i_rpOwner.get();
+    m_Key = static_cast< unsigned int >( i_Key );
+  }
+
+  // Refer to a shared object; null refers to a default constructed object
+  void Share( const std::shared_ptr< const T > & i_rpObject )
+  {
+    m_pObject = i_rpObject ? i_rpObject : Empty();
+    m_bOwned = false;
+    m_pDecode = nullptr;
+  }
+
+  const T & operator*() const
+  {
+    Decode();
+    return *m_pObject;
+  }
+
+  const T * operator->() const
+  {
+    Decode();
+    return m_pObject.get();
+  }
+
+  // Get a modifiable object, copying it first if it is shared
+  T & Mutable()
+  {
+    if( !m_bOwned || m_pObject.use_count() != 1 )
+    {
+      Decode();
+      m_pObject = std::make_shared< T >( *m_pObject );
+      m_bOwned = true;
+      m_pDecode = nullptr;
+    }
+
+    // Objects we own were created non-const above
+    return const_cast< T & >( *m_pObject );
+  }
+
+private:
+  template< typename TOwner, typename TKey >
+  static void DecodeOwner( const void * i_pOwner, unsigned int i_Key )
+  {
+    static_cast< const TOwner * >( i_pOwner )->DecodeDeferred( static_cast< TKey >( i_Key ) );
+  }
+
+  void Decode() const
+  {
+    if( m_pDecode )
+    {
+      m_pDecode( m_pOwner, m_Key );
+    }
+  }
+
+  static const std::shared_ptr< const T > & Empty()
+  {
+    static const std::shared_ptr< const T > s_pEmpty = std::make_shared< const T >();
+    return s_pEmpty;
+  }
+
+  std::shared_ptr< const T > m_pObject;
+  bool m_bOwned;
+
+  // Set while the object is shared from an owner which may not have decoded it yet
+  void ( *m_pDecode )( const void *, unsigned int );
+  const void * m_pOwner;
+  unsigned int m_Key;
+};
+
+} // End of namespace ViconCGStreamClientSDK
@@ -0,0 +1,193 @@
+
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+#include "FrameMerger.h"
+
+#include <algorithm>
+
+namespace ViconCGStreamClientSDK
+{
+
+const std::chrono::seconds VFrameMerger::s_LinkTimeout( 1 );
+
+VFrameMerger::VFrameMerger()
+: m_Window( s_WindowSize )
+, m_NewestFrameID( 0 )
+, m_bReceived( false )
+, m_Restarts( 0 )
+{
+}
+
+std::size_t VFrameMerger::AddLink()
+{
+  m_Links.push_back( VLink() );
+  return m_Links.size() - 1;
+}
+
+std::size_t VFrameMerger::LinkCount() const
+{
+  return m_Links.size();
+}
+
+const VLinkStats & VFrameMerger::Stats( std::size_t i_Link ) const
+{
+  return m_Links[ i_Link ].m_Stats;
+}
+
+bool VFrameMerger::Accept( std::size_t i_Link, ViconCGStreamType::UInt32 i_FrameID )
+{
+  const TClock::time_point Now = TClock::now();
+
+  VLink & rLink = m_Links[ i_Link ];
+  VLinkStats & rStats = rLink.m_Stats;
+  ++rStats.m_FramesReceived;
+
+  bool bInOrder = true;
+  if( !rLink.m_bReceived )
+  {
+    // A link joining now is taken to be on the current sequence
+    rLink.m_Restarts = m_Restarts;
+  }
+  else if( i_FrameID < rLink.m_LastFrameID )
+  {
+    if( rLink.m_LastFrameID - i_FrameID >= s_WindowSize )
+    {
+      // Too far back for a reordered frame, so the server restarted
+      ++rLink.m_Restarts;
+    }
+    else
+    {
+      // Either a reordered frame, or a restart close to the old sequence, which every link would see
+      bInOrder = false;
+      rLink.m_bBehind = true;
+      rLink.m_BehindFrameID = i_FrameID;
+    }
+  }
+  else if( i_FrameID > rLink.m_LastFrameID + 1 )
+  {
+    rStats.m_FramesLost += i_FrameID - rLink.m_LastFrameID - 1;
+  }
+
+  if( bInOrder )
+  {
+    rLink.m_LastFrameID = i_FrameID;
+    rLink.m_bBehind = false;
+  }
+  rLink.m_bReceived = true;
+  rLink.m_LastArrival = Now;
+
+  if( !bInOrder )
+  {
+    if( !AllLinksBehind( Now ) )
+    {
+      ++rStats.m_FramesStale;
+      return false;
+    }
+
+    // Every live link went back, so the server restarted; each link carries on from where it went back to
+    ++m_Restarts;
+    for( VLink & rOther : m_Links )
+    {
+      if( rOther.m_bBehind )
+      {
+        rOther.m_LastFrameID = rOther.m_BehindFrameID;
+        rOther.m_bBehind = false;
+      }
+      rOther.m_Restarts = m_Restarts;
+    }
+    Restart();
+  }
+
+  // With a single link there is nothing to merge. Repeated frames are passed on, as they are answers to frame requests.
+  if( m_Links.size() == 1 )
+  {
+    ++rStats.m_FramesFirst;
+    return true;
+  }
+
+  if( rLink.m_Restarts > m_Restarts )
+  {
+    // The first link to see a restarted server; the other links will follow with frames in the new sequence
+    m_Restarts = rLink.m_Restarts;
+    Restart();
+  }
+  else if( rLink.m_Restarts < m_Restarts )
+  {
+    // Still on the sequence from before the restart
+    ++rStats.m_FramesStale;
+    return false;
+  }
+
+  if( m_bReceived && i_FrameID <= m_NewestFrameID )
+  {
+    const VSlot & rSlot = m_Window[ i_FrameID % s_WindowSize ];
+    if( i_FrameID + s_WindowSize > m_NewestFrameID && rSlot.m_bValid && rSlot.m_FrameID == i_FrameID )
+    {
+      ++rStats.m_FramesLate;
+
+      const ViconCGStreamType::UInt64 Lag = static_cast< ViconCGStreamType::UInt64 >( 
+        std::chrono::duration_cast< std::chrono::microseconds >( Now - rSlot.m_FirstArrival ).count() );
+      rStats.m_TotalLagMicroseconds += Lag;
+      rStats.m_MaxLagMicroseconds = std::max( rStats.m_MaxLagMicroseconds, Lag );
+    }
+    else
+    {
+      // Either never delivered by the link that is ahead, or too old to match; passing it on would go backwards
+      ++rStats.m_FramesStale;
+    }
+    return false;
+  }
+
+  VSlot & rSlot = m_Window[ i_FrameID % s_WindowSize ];
+  rSlot.m_FrameID = i_FrameID;
+  rSlot.m_bValid = true;
+  rSlot.m_FirstArrival = Now;
+
+  m_NewestFrameID = i_FrameID;
+  m_bReceived = true;
+
+  ++rStats.m_FramesFirst;
+  return true;
+}
+
+bool VFrameMerger::AllLinksBehind( TClock::time_point i_Now ) const
+{
+  for( const VLink & rLink : m_Links )
+  {
+    // Links which have gone quiet cannot be asked
+    if( rLink.m_bReceived && !rLink.m_bBehind && i_Now - rLink.m_LastArrival < s_LinkTimeout )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void VFrameMerger::Restart()
+{
+  std::fill( m_Window.begin(), m_Window.end(), VSlot() );
+  m_bReceived = false;
+}
+
+} // End of namespace ViconCGStreamClientSDK
@@ -0,0 +1,154 @@
+
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <StreamCommon/Type.h>
+
+#include <chrono>
+#include <vector>
+
+namespace ViconCGStreamClientSDK
+{
+
+// Counters for one connection of a client connected to several redundant hosts
+class VLinkStats
+{
+public:
+  VLinkStats()
+  : m_bConnected( false )
+  , m_FramesReceived( 0 )
+  , m_FramesFirst( 0 )
+  , m_FramesLate( 0 )
+  , m_FramesStale( 0 )
+  , m_FramesLost( 0 )
+  , m_TotalLagMicroseconds( 0 )
+  , m_MaxLagMicroseconds( 0 )
+  {
+  }
+
+  bool m_bConnected;
+
+  // Frames delivered by this link
+  ViconCGStreamType::UInt64 m_FramesReceived;
+
+  // Frames this link delivered before any other, which were passed on
+  ViconCGStreamType::UInt64 m_FramesFirst;
+
+  // Frames another link had already delivered, which were dropped
+  ViconCGStreamType::UInt64 m_FramesLate;
+
+  // Frames older than the newest frame already passed on, with no earlier copy to match them against,
+  // including frames from before a server restart; dropped so that the merged stream never goes backwards
+  ViconCGStreamType::UInt64 m_FramesStale;
+
+  // Frames missing from this link's own sequence
+  ViconCGStreamType::UInt64 m_FramesLost;
+
+  // How far behind the first link this link delivered its late frames
+  ViconCGStreamType::UInt64 m_TotalLagMicroseconds;
+  ViconCGStreamType::UInt64 m_MaxLagMicroseconds;
+};
+
+// Merges the frames received over several connections to redundant hosts into one stream.
+// Each frame is passed on by whichever link delivers it first, as long as it is newer than every frame passed on so far.
+// Later copies are recognised in constant time from a window of recently seen frame IDs, and timed against the first copy
+// to measure each link's lag. A frame ID going back by more than the window on a link means the server restarted; the first
+// link to do so starts a new merged sequence, and frames from links which have not yet restarted are dropped. A smaller step
+// back is a reordered frame, which is dropped, unless every live link steps back, which is also a restart.
+// Not thread safe; the caller serialises calls.
+class VFrameMerger
+{
+public:
+  VFrameMerger();
+
+  // Add a link, returning its index
+  std::size_t AddLink();
+
+  std::size_t LinkCount() const;
+
+  // Record the arrival of a frame on a link. Returns true if this is the first copy, which should be passed on.
+  bool Accept( std::size_t i_Link, ViconCGStreamType::UInt32 i_FrameID );
+
+  const VLinkStats & Stats( std::size_t i_Link ) const;
+
+private:
+  typedef std::chrono::steady_clock TClock;
+
+  class VSlot
+  {
+  public:
+    VSlot()
+    : m_FrameID( 0 )
+    , m_bValid( false )
+    {
+    }
+
+    ViconCGStreamType::UInt32 m_FrameID;
+    bool m_bValid;
+    TClock::time_point m_FirstArrival;
+  };
+
+  class VLink
+  {
+  public:
+    VLink()
+    : m_LastFrameID( 0 )
+    , m_bReceived( false )
+    , m_bBehind( false )
+    , m_BehindFrameID( 0 )
+    , m_Restarts( 0 )
+    {
+    }
+
+    ViconCGStreamType::UInt32 m_LastFrameID;
+    bool m_bReceived;
+    TClock::time_point m_LastArrival;
+
+    // Set while the latest frame on this link was behind m_LastFrameID, by less than the window
+    bool m_bBehind;
+    ViconCGStreamType::UInt32 m_BehindFrameID;
+
+    // Server restarts seen on this link, which is in step with the merged sequence when it equals m_Restarts
+    unsigned int m_Restarts;
+    VLinkStats m_Stats;
+  };
+
+  bool AllLinksBehind( TClock::time_point i_Now ) const;
+  void Restart();
+
+  // Links which have delivered nothing for this long are left out when deciding whether every link has restarted
+  static const std::chrono::seconds s_LinkTimeout;
+
+  // Copies of frames older than this, relative to the newest frame passed on, are not timed
+  static const ViconCGStreamType::UInt32 s_WindowSize = 1024;
+
+  std::vector< VSlot > m_Window;
+  std::vector< VLink > m_Links;
+  ViconCGStreamType::UInt32 m_NewestFrameID;
+  bool m_bReceived;
+  unsigned int m_Restarts;
+};
+
+} // End of namespace ViconCGStreamClientSDK
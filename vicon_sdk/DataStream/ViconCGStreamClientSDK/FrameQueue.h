@@ -0,0 +1,279 @@
+
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <StreamCommon/Type.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace ViconCGStreamClientSDK
+{
+
+// What to do with a new frame when the buffer is full
+enum EFrameDropPolicy
+{
+  EDropOldest, // Discard the oldest buffered frame to make room, so the buffer always holds the latest frames
+  EDropNewest  // Discard the new frame, so frames already buffered are never lost
+};
+
+class VFrameQueueStats
+{
+public:
+  VFrameQueueStats()
+  : m_Dropped( 0 )
+  , m_HighWaterMark( 0 )
+  , m_Capacity( 0 )
+  {
+  }
+
+  // Frames discarded by the drop policy before they were read
+  ViconCGStreamType::UInt64 m_Dropped;
+
+  // The largest number of frames that have been buffered at once
+  ViconCGStreamType::UInt32 m_HighWaterMark;
+
+  // The maximum number of frames that can be buffered
+  ViconCGStreamType::UInt32 m_Capacity;
+};
+
+// A bounded lock-free queue for passing frames from the network threads to the reader.
+// Any number of threads may push and pop concurrently; each slot carries a sequence number which
+// tells a thread whether the slot is ready for it, so neither side ever waits on the other.
+// Pushing into a full queue applies the drop policy; dropping the oldest frame pops it from the producer.
+template< typename T >
+class VFrameQueue
+{
+public:
+  explicit VFrameQueue( unsigned int i_Capacity, EFrameDropPolicy i_DropPolicy = EDropOldest )
+  : m_Capacity( i_Capacity ? i_Capacity : 1 )
+  , m_SlotCount( m_Capacity + 1 )
+  , m_pSlots( new VSlot[ m_SlotCount ] )
+  , m_DropPolicy( i_DropPolicy )
+  , m_PushPosition( 0 )
+  , m_PopPosition( 0 )
+  , m_Dropped( 0 )
+  , m_HighWaterMark( 0 )
+  {
+    for( std::size_t Index = 0; Index != m_SlotCount; ++Index )
+    {
+      m_pSlots[ Index ].m_Sequence.store( Index, std::memory_order_relaxed );
+    }
+  }
+
+  // Add a frame, applying the drop policy if the queue is full.
+  // Returns false if the new frame itself was dropped.
+  bool Push( T i_Value )
+  {
+    for( ;; )
+    {
+      if( TryPush( i_Value ) )
+      {
+        UpdateHighWaterMark();
+        return true;
+      }
+
+      if( m_DropPolicy.load( std::memory_order_relaxed ) == EDropNewest )
+      {
+        m_Dropped.fetch_add( 1, std::memory_order_relaxed );
+        return false;
+      }
+
+      // Another thread may empty the slot first, in which case there is nothing to drop
+      T Oldest;
+      if( TryPop( Oldest ) )
+      {
+        m_Dropped.fetch_add( 1, std::memory_order_relaxed );
+      }
+    }
+  }
+
+  // Remove the oldest frame. Returns false if the queue is empty.
+  bool Pop( T & o_rValue )
+  {
+    return TryPop( o_rValue );
+  }
+
+  // Discard all buffered frames. These are not counted as dropped.
+  void Clear()
+  {
+    T Discard;
+    while( TryPop( Discard ) )
+    {
+    }
+  }
+
+  bool Empty() const
+  {
+    return Size() == 0;
+  }
+
+  // The number of buffered frames; only a snapshot while other threads are pushing or popping
+  std::size_t Size() const
+  {
+    const std::size_t PopPosition = m_PopPosition.load( std::memory_order_acquire );
+    const std::size_t PushPosition = m_PushPosition.load( std::memory_order_acquire );
+    return PushPosition > PopPosition ? PushPosition - PopPosition : 0;
+  }
+
+  std::size_t Capacity() const
+  {
+    return m_Capacity;
+  }
+
+  void SetDropPolicy( EFrameDropPolicy i_DropPolicy )
+  {
+    m_DropPolicy.store( i_DropPolicy, std::memory_order_relaxed );
+  }
+
+  // Carry the statistics of a queue this one replaces
+  void AddStats( const VFrameQueueStats & i_rStats )
+  {
+    m_Dropped.fetch_add( i_rStats.m_Dropped, std::memory_order_relaxed );
+    RaiseHighWaterMark( i_rStats.m_HighWaterMark );
+  }
+
+  VFrameQueueStats Stats() const
+  {
+    VFrameQueueStats Stats;
+    Stats.m_Dropped = m_Dropped.load( std::memory_order_relaxed );
+    Stats.m_HighWaterMark = static_cast< ViconCGStreamType::UInt32 >( m_HighWaterMark.load( std::memory_order_relaxed ) );
+    Stats.m_Capacity = static_cast< ViconCGStreamType::UInt32 >( m_Capacity );
+    return Stats;
+  }
+
+private:
+  VFrameQueue( const VFrameQueue & );
+  VFrameQueue & operator=( const VFrameQueue & );
+
+  // A slot is free for the push at position P when its sequence is P, and holds the frame for the pop at P when it is P + 1.
+  // A single slot could not tell those apart, so there is always one more slot than the capacity, which is enforced separately.
+  class VSlot
+  {
+  public:
+    std::atomic< std::size_t > m_Sequence;
+    T m_Value;
+  };
+
+  bool TryPush( T & io_rValue )
+  {
+    std::size_t Position = m_PushPosition.load( std::memory_order_relaxed );
+    for( ;; )
+    {
+      VSlot & rSlot = m_pSlots[ Position % m_SlotCount ];
+      const std::size_t Sequence = rSlot.m_Sequence.load( std::memory_order_acquire );
+      const std::ptrdiff_t Difference = static_cast< std::ptrdiff_t >( Sequence - Position );
+      if( Difference == 0 )
+      {
+        if( Position - m_PopPosition.load( std::memory_order_acquire ) >= m_Capacity )
+        {
+          // Full
+          return false;
+        }
+
+        if( m_PushPosition.compare_exchange_weak( Position, Position + 1, std::memory_order_relaxed ) )
+        {
+          rSlot.m_Value = std::move( io_rValue );
+          rSlot.m_Sequence.store( Position + 1, std::memory_order_release );
+          return true;
+        }
+      }
+      else if( Difference < 0 )
+      {
+        // Full
+        return false;
+      }
+      else
+      {
+        Position = m_PushPosition.load( std::memory_order_relaxed );
+      }
+    }
+  }
+
+  bool TryPop( T & o_rValue )
+  {
+    std::size_t Position = m_PopPosition.load( std::memory_order_relaxed );
+    for( ;; )
+    {
+      VSlot & rSlot = m_pSlots[ Position % m_SlotCount ];
+      const std::size_t Sequence = rSlot.m_Sequence.load( std::memory_order_acquire );
+      const std::ptrdiff_t Difference = static_cast< std::ptrdiff_t >( Sequence - ( Position + 1 ) );
+      if( Difference == 0 )
+      {
+        if( m_PopPosition.compare_exchange_weak( Position, Position + 1, std::memory_order_relaxed ) )
+        {
+          // Move the frame out, so the slot does not keep it alive
+          o_rValue = std::move( rSlot.m_Value );
+          rSlot.m_Value = T();
+          rSlot.m_Sequence.store( Position + m_SlotCount, std::memory_order_release );
+          return true;
+        }
+      }
+      else if( Difference < 0 )
+      {
+        // Empty
+        return false;
+      }
+      else
+      {
+        Position = m_PopPosition.load( std::memory_order_relaxed );
+      }
+    }
+  }
+
+  void UpdateHighWaterMark()
+  {
+    RaiseHighWaterMark( Size() );
+  }
+
+  void RaiseHighWaterMark( std::size_t i_Depth )
+  {
+    std::size_t HighWaterMark = m_HighWaterMark.load( std::memory_order_relaxed );
+    while( i_Depth > HighWaterMark && !m_HighWaterMark.compare_exchange_weak( HighWaterMark, i_Depth, std::memory_order_relaxed ) )
+    {
+    }
+  }
+
+  const std::size_t m_Capacity;
+  const std::size_t m_SlotCount;
+  std::unique_ptr< VSlot[] > m_pSlots;
+  std::atomic< EFrameDropPolicy > m_DropPolicy;
+
+  // Producers and consumers each update their own position; keep them on separate cache lines.
+  // The queue is not allocated with any particular alignment, so the members are spaced a whole line apart.
+  static const std::size_t s_CacheLineSize = 64;
+
+  char m_PushPadding[ s_CacheLineSize ];
+  std::atomic< std::size_t > m_PushPosition;
+  char m_PopPadding[ s_CacheLineSize - sizeof( std::atomic< std::size_t > ) ];
+  std::atomic< std::size_t > m_PopPosition;
+  char m_StatsPadding[ s_CacheLineSize - sizeof( std::atomic< std::size_t > ) ];
+
+  std::atomic< ViconCGStreamType::UInt64 > m_Dropped;
+  std::atomic< std::size_t > m_HighWaterMark;
+};
+
+} // End of namespace ViconCGStreamClientSDK
@@ -24,10 +24,16 @@
 //////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include "FrameQueue.h"
+
 #include <StreamCommon/Type.h>
+#include <functional>
 #include <string>
 #include <vector>
 
+class VMulticastReceiveOptions;
+class VMulticastReceiveStats;
+
 namespace ViconCGStream
 {
   class VVideoFrame;
@@ -38,6 +44,7 @@ namespace ViconCGStreamClientSDK
 {
 
 class ICGFrameState;
+class VLinkStats;
 
 class ICGClient
 {
@@ -62,6 +69,27 @@ public:
   /// i_LocalIPAddress is the local IP address, used to specify which NIC should listen.
   virtual void ReceiveMulticastData( std::string i_MulticastIPAddress, std::string i_LocalIPAddress, unsigned short i_Port ) = 0;
 
+  /// Tune the multicast receive path (socket buffer size, datagrams per system call and busy polling).
+  /// Applies from the next call to ReceiveMulticastData.
+  virtual void SetMulticastReceiveOptions( const VMulticastReceiveOptions & i_rOptions ) = 0;
+
+  /// Get the multicast receive counters, summed over all connections. Returns false if not receiving multicast data.
+  virtual bool GetMulticastReceiveStats( VMulticastReceiveStats & o_rStats ) const = 0;
+
+  /// Run every connection as asynchronous operations on a process-wide executor serviced by i_ThreadCount threads,
+  /// rather than on a thread per connection. Zero, the default, gives each connection its own thread.
+  /// Applies from the next call to Connect or ReceiveMulticastData.
+  virtual void SetExecutorThreads( unsigned int i_ThreadCount ) = 0;
+
+  /// Choose which frame is discarded when a frame arrives and the buffer is full. The default is EDropOldest.
+  virtual void SetBufferDropPolicy( EFrameDropPolicy i_DropPolicy ) = 0;
+
+  /// Get the number of frames which were discarded from the buffer before being read, and the deepest the buffer has been
+  virtual VFrameQueueStats GetBufferStats() const = 0;
+
+  /// Get counters for each connection made by Connect, in the order the hosts were given
+  virtual void GetLinkStats( std::vector< VLinkStats > & o_rStats ) const = 0;
+
   /// Stop this CGClient from receiving multicast data
   /// After calling this function users should call either ReceiveMulticastData or Connect.
   virtual void StopReceivingMulticastData( ) = 0;
@@ -81,6 +109,9 @@ public:
   /// Request that video data be transcoded into BGR888
   virtual void SetDecodeVideo( bool i_bDecode ) = 0;
 
+  /// Defer decoding of bulk frame data until the frame is read, so frames which are dropped are never decoded
+  virtual void SetLazyDecoding( bool i_bLazy ) = 0;
+
   /// Request that data is constantly streamed from the server, rather than sent on request.
   virtual void SetStreamMode( bool i_bStream ) = 0;
 
@@ -128,6 +159,10 @@ public:
   virtual bool WaitFrame( ICGFrameState& o_rFrame, unsigned int i_TimeoutMs ) = 0;
   virtual bool WaitFrames( std::vector< ICGFrameState > & o_rFrames, unsigned int i_TimeoutMs ) = 0;
 
+  /// Register a function to be called with the frame id each time a new frame is buffered.
+  /// The callback is invoked on the receiving thread, outside of any client locks. Pass an empty function to clear it.
+  virtual void SetNewFrameCallback( std::function< void( unsigned int ) > i_Callback ) = 0;
+
   /// Sets a log filename through which this cgstream client can log data
   virtual bool SetLogFile( const std::string & i_rLog ) = 0;
 
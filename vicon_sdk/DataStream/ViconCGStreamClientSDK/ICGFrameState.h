@@ -74,71 +74,80 @@
 #include <memory>
 #include <vector>
 
+#include "CopyOnWrite.h"
 #include "ICGClient.h"
 
+class VStaticObjects;
+
 namespace ViconCGStreamClientSDK
 {
 
 typedef std::shared_ptr< const ViconCGStream::VVideoFrame > VVideoFramePtr;
 
+// Objects read from the stream refer to the shared objects they were received in, so copying or buffering
+// a frame does not copy its payload. Use Mutable() to modify an object; it is copied on first write.
 class ICGFrameState
 {
 public:
+  // The static objects this frame was read from. Only changes when the server sends new static data,
+  // so it can be used to tell when anything derived from the static objects needs to be rebuilt.
+  std::shared_ptr< const VStaticObjects >                                 m_pStaticObjects;
+
   // Frame
-  ViconCGStream::VStreamInfo                           m_Stream;
-  ViconCGStream::VFrameInfo                            m_Frame;
-  ViconCGStream::VHardwareFrameInfo                    m_HardwareFrame;
-  ViconCGStream::VTimecode                             m_Timecode;
-  ViconCGStream::VLatencyInfo                          m_Latency;
-  boost::optional<ViconCGStream::VApplicationInfo>     m_ApplicationInfo;
-  ViconCGStream::VFrameRateInfo                        m_FrameRateInfo;
+  ViconCGStream::VStreamInfo                                              m_Stream;
+  ViconCGStream::VFrameInfo                                               m_Frame;
+  ViconCGStream::VHardwareFrameInfo                                       m_HardwareFrame;
+  ViconCGStream::VTimecode                                                m_Timecode;
+  VCopyOnWrite< ViconCGStream::VLatencyInfo >                             m_Latency;
+  boost::optional<ViconCGStream::VApplicationInfo>                        m_ApplicationInfo;
+  VCopyOnWrite< ViconCGStream::VFrameRateInfo >                           m_FrameRateInfo;
 
   // Cameras
-  ViconCGStream::VCameraCalibrationHealth              m_CameraCalibrationHealth;
-  std::vector< ViconCGStream::VCameraCalibrationInfo > m_CameraCalibrations;
-  std::vector< ViconCGStream::VCameraInfo >            m_Cameras;
-  std::vector< ViconCGStream::VCameraSensorInfo >      m_CamerasSensorInfo;
-  std::vector< ViconCGStream::VEdgePairs >             m_EdgePairs;
-  std::vector< ViconCGStream::VGreyscaleBlobs >        m_GreyscaleBlobs;
-  std::vector< ViconCGStream::VGreyscaleSubsampledBlobs > m_GreyscaleSubsampledBlobs;
-  std::vector< ViconCGStream::VCentroids >             m_Centroids;
-  std::vector< ViconCGStream::VCentroidTracks >        m_CentroidTracks;
-  std::vector< ViconCGStream::VCentroidWeights >       m_CentroidWeights;
-  std::vector< VVideoFramePtr >                        m_VideoFrames;
-  std::vector< ViconCGStream::VCameraWand2d >          m_CameraWand2d;
-  std::vector< ViconCGStream::VCameraWand3d >          m_CameraWand3d;
+  VCopyOnWrite< ViconCGStream::VCameraCalibrationHealth >                 m_CameraCalibrationHealth;
+  VCopyOnWrite< std::vector< ViconCGStream::VCameraCalibrationInfo > >    m_CameraCalibrations;
+  VCopyOnWrite< std::vector< ViconCGStream::VCameraInfo > >               m_Cameras;
+  VCopyOnWrite< std::vector< ViconCGStream::VCameraSensorInfo > >         m_CamerasSensorInfo;
+  VCopyOnWrite< std::vector< ViconCGStream::VEdgePairs > >                m_EdgePairs;
+  VCopyOnWrite< std::vector< ViconCGStream::VGreyscaleBlobs > >           m_GreyscaleBlobs;
+  VCopyOnWrite< std::vector< ViconCGStream::VGreyscaleSubsampledBlobs > > m_GreyscaleSubsampledBlobs;
+  VCopyOnWrite< std::vector< ViconCGStream::VCentroids > >                m_Centroids;
+  VCopyOnWrite< std::vector< ViconCGStream::VCentroidTracks > >           m_CentroidTracks;
+  VCopyOnWrite< std::vector< ViconCGStream::VCentroidWeights > >          m_CentroidWeights;
+  std::vector< VVideoFramePtr >                                           m_VideoFrames;
+  VCopyOnWrite< std::vector< ViconCGStream::VCameraWand2d > >             m_CameraWand2d;
+  VCopyOnWrite< std::vector< ViconCGStream::VCameraWand3d > >             m_CameraWand3d;
 
   // Reconstructions
-  ViconCGStream::VUnlabeledRecons                      m_UnlabeledRecons;
-  ViconCGStream::VLabeledRecons                        m_LabeledRecons;
-  ViconCGStream::VLabeledReconRayAssignments           m_LabeledReconRayAssignments;
+  VCopyOnWrite< ViconCGStream::VUnlabeledRecons >                         m_UnlabeledRecons;
+  VCopyOnWrite< ViconCGStream::VLabeledRecons >                           m_LabeledRecons;
+  VCopyOnWrite< ViconCGStream::VLabeledReconRayAssignments >              m_LabeledReconRayAssignments;
 
   // Devices
-  std::vector< ViconCGStream::VDeviceInfo >            m_Devices;
-  std::vector< ViconCGStream::VDeviceInfoExtra >       m_DevicesExtra;
-  std::vector< ViconCGStream::VChannelInfo >           m_Channels;
-  std::vector< ViconCGStream::VChannelInfoExtra >      m_ChannelUnits;
-  std::vector< ViconCGStream::VVoltageFrame >          m_Voltages;
+  VCopyOnWrite< std::vector< ViconCGStream::VDeviceInfo > >               m_Devices;
+  VCopyOnWrite< std::vector< ViconCGStream::VDeviceInfoExtra > >          m_DevicesExtra;
+  VCopyOnWrite< std::vector< ViconCGStream::VChannelInfo > >              m_Channels;
+  VCopyOnWrite< std::vector< ViconCGStream::VChannelInfoExtra > >         m_ChannelUnits;
+  VCopyOnWrite< std::vector< ViconCGStream::VVoltageFrame > >             m_Voltages;
 
   // Force Plates
-  std::vector< ViconCGStream::VForcePlateInfo >        m_ForcePlates;
-  std::vector< ViconCGStream::VForceFrame >            m_Forces;
-  std::vector< ViconCGStream::VMomentFrame >           m_Moments;
-  std::vector< ViconCGStream::VCentreOfPressureFrame > m_CentresOfPressure;
+  VCopyOnWrite< std::vector< ViconCGStream::VForcePlateInfo > >           m_ForcePlates;
+  VCopyOnWrite< std::vector< ViconCGStream::VForceFrame > >               m_Forces;
+  VCopyOnWrite< std::vector< ViconCGStream::VMomentFrame > >              m_Moments;
+  VCopyOnWrite< std::vector< ViconCGStream::VCentreOfPressureFrame > >    m_CentresOfPressure;
   
   // Eye Trackers
-  std::vector< ViconCGStream::VEyeTrackerInfo >        m_EyeTrackers;
-  std::vector< ViconCGStream::VEyeTrackerFrame >       m_EyeTracks;
+  VCopyOnWrite< std::vector< ViconCGStream::VEyeTrackerInfo > >           m_EyeTrackers;
+  VCopyOnWrite< std::vector< ViconCGStream::VEyeTrackerFrame > >          m_EyeTracks;
 
   // Subjects
-  std::vector< ViconCGStream::VSubjectInfo >           m_Subjects;
-  std::vector< ViconCGStream::VSubjectTopology >       m_SubjectTopologies;
-  std::vector< ViconCGStream::VSubjectScale >          m_SubjectScales;
-  std::vector< ViconCGStream::VSubjectHealth >         m_SubjectHealths;
-  std::vector< ViconCGStream::VObjectQuality >         m_ObjectQualities;
-  std::vector< ViconCGStream::VGlobalSegments >        m_GlobalSegments;
-  std::vector< ViconCGStream::VLocalSegments >         m_LocalSegments;
-  std::vector< ViconCGStream::VLightweightSegments >   m_LightweightSegments;
+  VCopyOnWrite< std::vector< ViconCGStream::VSubjectInfo > >              m_Subjects;
+  VCopyOnWrite< std::vector< ViconCGStream::VSubjectTopology > >          m_SubjectTopologies;
+  VCopyOnWrite< std::vector< ViconCGStream::VSubjectScale > >             m_SubjectScales;
+  VCopyOnWrite< std::vector< ViconCGStream::VSubjectHealth > >            m_SubjectHealths;
+  VCopyOnWrite< std::vector< ViconCGStream::VObjectQuality > >            m_ObjectQualities;
+  VCopyOnWrite< std::vector< ViconCGStream::VGlobalSegments > >           m_GlobalSegments;
+  VCopyOnWrite< std::vector< ViconCGStream::VLocalSegments > >            m_LocalSegments;
+  VCopyOnWrite< std::vector< ViconCGStream::VLightweightSegments > >      m_LightweightSegments;
 };
 
 } // End of namespace ViconCGStreamClientSDK
@@ -47,6 +47,45 @@ namespace
   // Timeout for wait-for-frame operations (in milliseconds) 
   static const unsigned int s_WaitFrameTimeout = 1000;
 
+  // Find a segment in a frame's per-subject segment lists, trying the location it was found at last time first.
+  template< typename TSegment, typename TSubjectSegments, typename TLocations >
+  const TSegment * FindSegment( const std::vector< TSubjectSegments > & i_rSubjectSegments,
+                                const unsigned int                      i_SubjectID,
+                                const unsigned int                      i_SegmentID,
+                                      TLocations                      & io_rLocations )
+  {
+    const ViconCGStreamType::UInt64 Key = ( static_cast< ViconCGStreamType::UInt64 >( i_SubjectID ) << 32 ) | i_SegmentID;
+
+    const auto LocationIt = io_rLocations.find( Key );
+    if( LocationIt != io_rLocations.end() )
+    {
+      const unsigned int i = LocationIt->second.first;
+      const unsigned int j = LocationIt->second.second;
+      if( i < i_rSubjectSegments.size() && i_rSubjectSegments[ i ].m_SubjectID == i_SubjectID &&
+          j < i_rSubjectSegments[ i ].m_Segments.size() && i_rSubjectSegments[ i ].m_Segments[ j ].m_SegmentID == i_SegmentID )
+      {
+        return &i_rSubjectSegments[ i ].m_Segments[ j ];
+      }
+    }
+
+    for( unsigned int i = 0; i < i_rSubjectSegments.size(); ++i )
+    {
+      const TSubjectSegments & rSegments = i_rSubjectSegments[ i ];
+      if( rSegments.m_SubjectID == i_SubjectID )
+      {
+        for( unsigned int j = 0; j < rSegments.m_Segments.size(); ++j )
+        {
+          if( rSegments.m_Segments[ j ].m_SegmentID == i_SegmentID )
+          {
+            io_rLocations[ Key ] = std::make_pair( i, j );
+            return &rSegments.m_Segments[ j ];
+          }
+        }
+      }
+    }
+    return nullptr;
+  }
+
   // [ Start tick, End tick ) pair.
   TPeriod GetFramePeriod( const ViconCGStreamClientSDK::ICGFrameState & i_rFrame )
   {
@@ -130,10 +169,143 @@ namespace ViconDataStreamSDK
 namespace Core
 {
 
+namespace
+{
+  ViconCGStreamClientSDK::EFrameDropPolicy AdaptDropPolicy( BufferDropPolicy::Enum i_DropPolicy )
+  {
+    switch( i_DropPolicy )
+    {
+    default:
+    case BufferDropPolicy::DropOldest: return ViconCGStreamClientSDK::EDropOldest;
+    case BufferDropPolicy::DropNewest: return ViconCGStreamClientSDK::EDropNewest;
+    }
+  }
+
+  // Shared by VClient and VFrameSnapshot, which each supply their own axis mapping and server orientation
+  void TransformT( const VAxisMapping * i_pAxisMapping, const bool i_bServerYUp, const double i_Translation[3], double( &io_Translation )[3] )
+  {
+    if (i_pAxisMapping)
+    {
+
+      Direction::Enum RequestedX, RequestedY, RequestedZ;
+      i_pAxisMapping->GetAxisMapping(RequestedX, RequestedY, RequestedZ);
+
+      Direction::Enum ServerX, ServerY, ServerZ;
+
+      AxisMappingResult::Enum Error = AxisMappingResult::Success;
+      std::shared_ptr< VAxisMapping > pServerAxisMapping;
+
+      // If we've got information about our stream type from the server
+      if (i_bServerYUp)
+      {
+        ServerX = Direction::Forward;
+        ServerY = Direction::Up;
+        ServerZ = Direction::Right;
+
+        // Only create the server axis mapping if we need to modify the data from the server
+        pServerAxisMapping = VAxisMapping::Create(Error, Direction::Forward, Direction::Up, Direction::Right);
+      }
+      else
+      {
+        // We either know it's Z-up, or we assume it's Z-up due to lack of contrary information.
+        ServerX = Direction::Forward;
+        ServerY = Direction::Left;
+        ServerZ = Direction::Up;
+      }
+
+      // We will avoid the mapping in favour of a pure copy if the input and requested output are the same. 
+      if (RequestedX == ServerX && RequestedY == ServerY && RequestedZ == ServerZ)
+      {
+        std::copy(i_Translation, i_Translation + 3, io_Translation);
+      }
+      else
+      {
+        if (pServerAxisMapping && Error == AxisMappingResult::Success)
+        {
+          double Q[9];
+          pServerAxisMapping->GetTransformationMatrix(Q);
+          i_pAxisMapping->CopyAndTransformT(i_Translation, Q, io_Translation);
+        }
+        else
+        {
+          // We don't need to do a server axis mapping
+          i_pAxisMapping->CopyAndTransformT(i_Translation, io_Translation);
+        }
+      }
+    }
+    else
+    {
+      // Just do a pure copy if there's no axis mapping at all.
+      std::copy( i_Translation, i_Translation + 3, io_Translation );
+    }
+  }
+
+  void TransformR( const VAxisMapping * i_pAxisMapping, const bool i_bServerYUp, const double i_Rotation[ 9 ], double ( & io_Rotation )[ 9 ] )
+  {
+    if (i_pAxisMapping)
+    {
+
+      Direction::Enum RequestedX, RequestedY, RequestedZ;
+      i_pAxisMapping->GetAxisMapping(RequestedX, RequestedY, RequestedZ);
+
+      Direction::Enum ServerX, ServerY, ServerZ;
+
+      AxisMappingResult::Enum Error = AxisMappingResult::Success;
+      std::shared_ptr< VAxisMapping > pServerAxisMapping;
+
+      // If we've got information about our stream type from the server
+      if (i_bServerYUp)
+      {
+        ServerX = Direction::Forward;
+        ServerY = Direction::Up;
+        ServerZ = Direction::Right;
+
+        // Only create the server axis mapping if we need to modify the data from the server
+        pServerAxisMapping = VAxisMapping::Create(Error, Direction::Forward, Direction::Up, Direction::Right);
+      }
+      else
+      {
+        // We either know it's Z-up, or we assume it's Z-up due to lack of contrary information.
+        ServerX = Direction::Forward;
+        ServerY = Direction::Left;
+        ServerZ = Direction::Up;
+      }
+
+      // We will avoid the mapping in favour of a pure copy if the input and requested output are the same. 
+      if (RequestedX == ServerX && RequestedY == ServerY && RequestedZ == ServerZ)
+      {
+        std::copy(i_Rotation, i_Rotation + 9, io_Rotation);
+      }
+      else
+      {
+        if (pServerAxisMapping && Error == AxisMappingResult::Success)
+        {
+          double Q[9];
+          pServerAxisMapping->GetTransformationMatrix(Q);
+          i_pAxisMapping->CopyAndTransformR(i_Rotation, Q, io_Rotation);
+        }
+        else
+        {
+          // We don't need to do a server axis mapping
+          i_pAxisMapping->CopyAndTransformR(i_Rotation, io_Rotation);
+        }
+      }
+    }
+    else
+    {
+      // Just do a pure copy if there's no axis mapping at all.
+      std::copy(i_Rotation, i_Rotation + 9, io_Rotation);
+    }
+  
+  }
+}
+
+
 
 VClient::VClient()
 : m_bPreFetch( false )
 , m_bNewCachedFrame( false )
+, m_pFrameIndex( std::make_shared< VFrameIndex >() )
 , m_bSegmentDataEnabled( false )
 , m_bLightweightSegmentDataEnabled( false )
 , m_bMarkerDataEnabled( false )
@@ -147,12 +319,16 @@ VClient::VClient()
 , m_bVideoDataEnabled( false )
 , m_bSubjectScaleEnabled ( false )
 , m_BufferSize( 1 )
+, m_BufferDropPolicy( BufferDropPolicy::DropOldest )
+, m_bLazyDecoding( false )
+, m_ExecutorThreads( 0 )
 {
   SetAxisMapping( Direction::Forward, Direction::Left, Direction::Up );
 
   // set the frame index to a bad value so we know it is not from the stream 
-  m_LatestFrame.m_Frame.m_FrameID = BadFrameValue;
-  m_CachedFrame = m_LatestFrame;
+  m_pLatestFrame = std::make_shared< ViconCGStreamClientSDK::ICGFrameState >();
+  m_pLatestFrame->m_Frame.m_FrameID = BadFrameValue;
+  m_pCachedFrame = m_pLatestFrame;
 }
 
 VClient::~VClient()
@@ -245,6 +421,7 @@ Result::Enum VClient::Connect(       std::shared_ptr< ViconCGStreamClientSDK::IC
   }
 
   // here we attempt to connect to the IP address
+  i_pClient->SetExecutorThreads( m_ExecutorThreads );
   i_pClient->Connect( Hosts );
 
   if (!i_pClient->IsConnected())
@@ -255,6 +432,9 @@ Result::Enum VClient::Connect(       std::shared_ptr< ViconCGStreamClientSDK::IC
   // copy the pointer if all is well
   m_pClient = i_pClient;
   m_pClient->SetBufferSize(m_BufferSize);
+  m_pClient->SetBufferDropPolicy( AdaptDropPolicy( m_BufferDropPolicy ) );
+  m_pClient->SetLazyDecoding( m_bLazyDecoding );
+  m_pClient->SetNewFrameCallback( m_FrameCallback );
 
   // set some default request types
   m_pClient->SetRequestTypes( ViconCGStreamEnum::Contents );
@@ -360,6 +540,8 @@ Result::Enum VClient::ConnectToMulticast( std::shared_ptr< ViconCGStreamClientSD
   }  
   
   // here we attempt to connect to the IP address
+  i_pClient->SetMulticastReceiveOptions( m_MulticastReceiveOptions );
+  i_pClient->SetExecutorThreads( m_ExecutorThreads );
   i_pClient->ReceiveMulticastData( MulticastIP, LocalIP, MulticastPort );
 
   if( !i_pClient->IsMulticastReceiving() )
@@ -370,6 +552,9 @@ Result::Enum VClient::ConnectToMulticast( std::shared_ptr< ViconCGStreamClientSD
   // copy the pointer if all is well
   m_pClient = i_pClient;
   m_pClient->SetBufferSize( m_BufferSize );
+  m_pClient->SetBufferDropPolicy( AdaptDropPolicy( m_BufferDropPolicy ) );
+  m_pClient->SetLazyDecoding( m_bLazyDecoding );
+  m_pClient->SetNewFrameCallback( m_FrameCallback );
 
   return Result::Success;
 }
@@ -387,7 +572,19 @@ Result::Enum VClient::Disconnect()
     return Result::NotConnected;
   }  
 
-  m_pClient.reset(); 
+  m_pClient->SetNewFrameCallback( nullptr );
+
+  // Taken out under the frame lock, so that a frame being handed over on another thread cannot publish a snapshot
+  // after this; it is shut down once the lock is released
+  std::shared_ptr< ViconCGStreamClientSDK::ICGClient > pClient;
+  {
+    boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
+    pClient.swap( m_pClient );
+    m_bNewCachedFrame = false;
+
+    // Lock-free readers report NotConnected from now on
+    std::atomic_store( &m_pSnapshot, std::shared_ptr< const VFrameSnapshot >() );
+  }
 
   return Result::Success;
 }
@@ -491,23 +688,102 @@ void VClient::SetBufferSize( unsigned int i_MaxFrames )
   }
 }
 
+void VClient::SetBufferDropPolicy( BufferDropPolicy::Enum i_DropPolicy )
+{
+  m_BufferDropPolicy = i_DropPolicy;
+  if( m_pClient )
+  {
+    m_pClient->SetBufferDropPolicy( AdaptDropPolicy( m_BufferDropPolicy ) );
+  }
+}
+
+void VClient::SetLazyDecoding( bool i_bLazy )
+{
+  m_bLazyDecoding = i_bLazy;
+  if( m_pClient )
+  {
+    m_pClient->SetLazyDecoding( m_bLazyDecoding );
+  }
+}
+
+void VClient::SetMulticastReceiveOptions( unsigned int i_SocketBufferSize, unsigned int i_BatchSize, unsigned int i_SpinMicroseconds )
+{
+  m_MulticastReceiveOptions.m_SocketBufferSize = i_SocketBufferSize;
+  m_MulticastReceiveOptions.m_BatchSize = i_BatchSize;
+  m_MulticastReceiveOptions.m_SpinMicroseconds = i_SpinMicroseconds;
+}
+
+void VClient::SetExecutorThreads( unsigned int i_ThreadCount )
+{
+  m_ExecutorThreads = i_ThreadCount;
+}
+
+Result::Enum VClient::GetReceiveStats( VMulticastReceiveStats & o_rMulticastStats, ViconCGStreamClientSDK::VFrameQueueStats & o_rBufferStats ) const
+{
+  o_rMulticastStats = VMulticastReceiveStats();
+  o_rBufferStats = ViconCGStreamClientSDK::VFrameQueueStats();
+
+  if( !IsConnected() )
+  {
+    return Result::NotConnected;
+  }
+
+  m_pClient->GetMulticastReceiveStats( o_rMulticastStats );
+  o_rBufferStats = m_pClient->GetBufferStats();
+  return Result::Success;
+}
+
+Result::Enum VClient::GetLinkStats( std::vector< ViconCGStreamClientSDK::VLinkStats > & o_rStats ) const
+{
+  o_rStats.clear();
+
+  if( !m_pClient )
+  {
+    return Result::NotConnected;
+  }
+
+  m_pClient->GetLinkStats( o_rStats );
+  return Result::Success;
+}
+
+void VClient::SetFrameCallback( std::function< void( unsigned int ) > i_Callback )
+{
+  m_FrameCallback = i_Callback;
+  if( m_pClient )
+  {
+    m_pClient->SetNewFrameCallback( m_FrameCallback );
+  }
+}
+
 Result::Enum VClient::GetFrame()
+{
+  return WaitForFrame( s_WaitFrameTimeout );
+}
+
+Result::Enum VClient::WaitForFrame( unsigned int i_TimeoutMs )
 {
   if( !IsConnected() )
   {
     return Result::NotConnected;
   }
 
+  // Keep the client alive while we wait on it, in case another thread disconnects
+  std::shared_ptr< ViconCGStreamClientSDK::ICGClient > pClient;
+  {
+    boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
+    pClient = m_pClient;
+  }
+
   // Get the next frame
   if( !m_bPreFetch )
   {
     // Not in pre-fetch mode
     // Request the next frame.  If streaming, this does nothing.
-    if( m_pClient )
+    if( pClient )
     {
-      m_pClient->RequestFrame();
+      pClient->RequestFrame();
       // Wait for it to arrive.
-      FetchNextFrame();
+      FetchNextFrame( *pClient, i_TimeoutMs );
     }
   }
   else
@@ -515,15 +791,21 @@ Result::Enum VClient::GetFrame()
     // In pre-fetch mode
     // The pre-fetch thread should have got a frame for us
     // Request the subsequent frame so it is ready for the next call.
-    if( m_pClient )
+    if( pClient )
     {
-      FetchNextFrame();
-      m_pClient->RequestNextFrame();
+      FetchNextFrame( *pClient, i_TimeoutMs );
+      pClient->RequestNextFrame();
     }
   }
 
   // Is the latest frame different from the one we dispatched?
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
+
+  // Disconnected while we were waiting
+  if( !m_pClient )
+  {
+    return Result::NotConnected;
+  }
   
   if( !m_bNewCachedFrame )
   {
@@ -531,7 +813,14 @@ Result::Enum VClient::GetFrame()
   }
   else
   {
-    m_LatestFrame = m_CachedFrame;
+    // Hand the frame over by pointer. Anything added to it below is added before it can be seen outside this lock.
+    m_pLatestFrame = m_pCachedFrame;
+
+    // Names only change with the static objects, so the lookups can be kept across frames
+    if( m_pLatestFrame->m_pStaticObjects != m_pFrameIndex->m_pStaticObjects )
+    {
+      BuildNameIndex();
+    }
 
     // Find somewhere better for this to live.
     if ( m_bLightweightSegmentDataEnabled )
@@ -539,6 +828,9 @@ Result::Enum VClient::GetFrame()
       CalculateGlobalsFromLocals();
     }
 
+    // The frame is complete, so lock-free readers may now see it
+    PublishSnapshot();
+
     // Send a ping to the server to keep our network latency statistics updated
     m_pClient->SendPing();
 
@@ -547,6 +839,142 @@ Result::Enum VClient::GetFrame()
   }
 }
 
+void VClient::BuildNameIndex()
+{
+  // The previous index may still be in use by a snapshot, so a new one is built alongside it
+  std::shared_ptr< VFrameIndex > pIndex = std::make_shared< VFrameIndex >();
+
+  // Segment handles are positions in m_IndexedSegments, which only move if the subjects do
+  pIndex->m_SegmentHandleGeneration = m_pFrameIndex->m_SegmentHandleGeneration;
+  if( !m_pFrameIndex->m_pStaticObjects || !m_pLatestFrame->m_pStaticObjects ||
+      !( m_pFrameIndex->m_pStaticObjects->m_SubjectInfo == m_pLatestFrame->m_pStaticObjects->m_SubjectInfo ) )
+  {
+    ++pIndex->m_SegmentHandleGeneration;
+  }
+
+  pIndex->m_pStaticObjects = m_pLatestFrame->m_pStaticObjects;
+  m_GlobalSegmentLocations.clear();
+  m_LocalSegmentLocations.clear();
+
+  // emplace keeps the first of any duplicate names, which is what a linear search would have found
+  for( unsigned int SubjectIndex = 0; SubjectIndex < m_pLatestFrame->m_Subjects->size(); ++SubjectIndex )
+  {
+    const ViconCGStream::VSubjectInfo & rSubject = (*m_pLatestFrame->m_Subjects)[ SubjectIndex ];
+    pIndex->m_SubjectNameIndex.emplace( rSubject.m_Name, SubjectIndex );
+
+    if( pIndex->m_SubjectIDIndex.count( rSubject.m_SubjectID ) )
+    {
+      continue;
+    }
+
+    VFrameIndex::VSubjectNameIndex & rIndex = pIndex->m_SubjectIDIndex[ rSubject.m_SubjectID ];
+    rIndex.m_SubjectIndex = SubjectIndex;
+    for( const auto & rSegment : rSubject.m_Segments )
+    {
+      if( rIndex.m_Segments.emplace( rSegment.m_Name, static_cast< unsigned int >( pIndex->m_IndexedSegments.size() ) ).second )
+      {
+        pIndex->m_IndexedSegments.push_back( std::make_pair( rSubject.m_SubjectID, rSegment.m_SegmentID ) );
+      }
+    }
+    for( const auto & rMarker : rSubject.m_Markers )
+    {
+      rIndex.m_MarkerIDs.emplace( rMarker.m_Name, rMarker.m_MarkerID );
+    }
+
+    // Parent segments are resolved as GetMarkerParentName does
+    for( unsigned int MarkerIndex = 0; MarkerIndex < rSubject.m_Markers.size(); ++MarkerIndex )
+    {
+      const unsigned int MarkerID = rSubject.m_Markers[ MarkerIndex ].m_MarkerID;
+      unsigned int SegmentID = 0;
+      for( const auto & rAttachment : rSubject.m_Attachments )
+      {
+        if( rAttachment.m_MarkerID == MarkerID )
+        {
+          SegmentID = rAttachment.m_SegmentID;
+          break;
+        }
+      }
+
+      VFrameIndex::VIndexedMarker Marker;
+      Marker.m_SubjectIndex = SubjectIndex;
+      Marker.m_SegmentIndex = NoParentSegment;
+      Marker.m_MarkerIndex  = MarkerIndex;
+      for( unsigned int SegmentIndex = 0; SegmentIndex < rSubject.m_Segments.size(); ++SegmentIndex )
+      {
+        if( rSubject.m_Segments[ SegmentIndex ].m_SegmentID == SegmentID )
+        {
+          Marker.m_SegmentIndex = SegmentIndex;
+          break;
+        }
+      }
+
+      const ViconCGStreamType::UInt64 Key = ( static_cast< ViconCGStreamType::UInt64 >( rSubject.m_SubjectID ) << 32 ) | MarkerID;
+      if( pIndex->m_MarkerSlots.emplace( Key, static_cast< unsigned int >( pIndex->m_IndexedMarkers.size() ) ).second )
+      {
+        pIndex->m_IndexedMarkers.push_back( Marker );
+      }
+    }
+  }
+
+  for( unsigned int DeviceIndex = 0; DeviceIndex < m_pLatestFrame->m_Devices->size(); ++DeviceIndex )
+  {
+    const ViconCGStream::VDeviceInfo & rDevice = (*m_pLatestFrame->m_Devices)[ DeviceIndex ];
+    pIndex->m_DeviceNameIndex.emplace( AdaptDeviceName( rDevice.m_Name, rDevice.m_DeviceID ), DeviceIndex );
+  }
+
+  m_pFrameIndex = pIndex;
+}
+
+const ViconCGStreamDetail::VGlobalSegments_Segment * VClient::FindGlobalSegment( const unsigned int i_SubjectID, const unsigned int i_SegmentID ) const
+{
+  return FindSegment< ViconCGStreamDetail::VGlobalSegments_Segment >( *m_pLatestFrame->m_GlobalSegments, i_SubjectID, i_SegmentID, m_GlobalSegmentLocations );
+}
+
+const ViconCGStreamDetail::VLocalSegments_Segment * VClient::FindLocalSegment( const unsigned int i_SubjectID, const unsigned int i_SegmentID ) const
+{
+  return FindSegment< ViconCGStreamDetail::VLocalSegments_Segment >( *m_pLatestFrame->m_LocalSegments, i_SubjectID, i_SegmentID, m_LocalSegmentLocations );
+}
+
+void VClient::PublishSnapshot()
+{
+  std::shared_ptr< VFrameSnapshot > pSnapshot = std::make_shared< VFrameSnapshot >();
+  pSnapshot->m_pFrame = m_pLatestFrame;
+  pSnapshot->m_pIndex = m_pFrameIndex;
+  pSnapshot->m_pAxisMapping = m_pAxisMapping;
+  pSnapshot->m_bServerYUp = IsServerYUp();
+
+  // Find every segment once here rather than in each reader. The pointers stay valid as the snapshot keeps the frame.
+  const std::vector< std::pair< unsigned int, unsigned int > > & rSegments = m_pFrameIndex->m_IndexedSegments;
+  pSnapshot->m_GlobalSegments.reserve( rSegments.size() );
+  for( const auto & rSegment : rSegments )
+  {
+    pSnapshot->m_GlobalSegments.push_back( FindGlobalSegment( rSegment.first, rSegment.second ) );
+  }
+
+  std::atomic_store( &m_pSnapshot, std::shared_ptr< const VFrameSnapshot >( pSnapshot ) );
+}
+
+std::shared_ptr< const VClient::VFrameSnapshot > VClient::GetSnapshot( Result::Enum & o_rResult ) const
+{
+  o_rResult = Result::Success;
+
+  std::shared_ptr< const VFrameSnapshot > pSnapshot = std::atomic_load( &m_pSnapshot );
+  if( pSnapshot )
+  {
+    return pSnapshot;
+  }
+
+  // Nothing has been published; only now is the lock needed, to find out why.
+  // A frame that was being handed over will have been published by the time we have the lock.
+  boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
+  pSnapshot = std::atomic_load( &m_pSnapshot );
+  if( !pSnapshot && InitGet( o_rResult ) )
+  {
+    o_rResult = Result::NoFrame;
+  }
+  return pSnapshot;
+}
+
 bool VClient::InitGet( Result::Enum & o_rResult ) const
 {
   o_rResult = Result::Success;
@@ -565,12 +993,13 @@ bool VClient::InitGet( Result::Enum & o_rResult ) const
 
 Result::Enum VClient::GetFrameNumber( unsigned int & o_rFrameNumber ) const
 {
-  boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
-  
+  Clear( o_rFrameNumber );
+
   Result::Enum GetResult = Result::Success;
-  if ( InitGet( GetResult, o_rFrameNumber ) )
+  const std::shared_ptr< const VFrameSnapshot > pSnapshot = GetSnapshot( GetResult );
+  if ( pSnapshot )
   {
-    o_rFrameNumber = m_LatestFrame.m_Frame.m_FrameID + 1;
+    o_rFrameNumber = pSnapshot->m_pFrame->m_Frame.m_FrameID + 1;
   }
 
   return GetResult; 
@@ -583,7 +1012,7 @@ Result::Enum VClient::GetFrameRate( double & o_rFrameRateInHz ) const
   Result::Enum GetResult = Result::Success;
   if ( InitGet( GetResult, o_rFrameRateInHz ) )
   {
-    ViconCGStreamType::Int64 Period = m_LatestFrame.m_Stream.m_FramePeriod;
+    ViconCGStreamType::Int64 Period = m_pLatestFrame->m_Stream.m_FramePeriod;
     if (Period == 0)
     {
       o_rFrameRateInHz = 0.0;
@@ -625,16 +1054,16 @@ Result::Enum VClient::GetTimecode( unsigned int           & o_rHours,
     return GetResult; 
   }
 
-  o_rHours             = m_LatestFrame.m_Timecode.m_Hours;
-  o_rMinutes           = m_LatestFrame.m_Timecode.m_Minutes;
-  o_rSeconds           = m_LatestFrame.m_Timecode.m_Seconds;
-  o_rFrames            = m_LatestFrame.m_Timecode.m_Frames;
-  o_rSubFrame          = m_LatestFrame.m_Timecode.m_Subframes;
-  o_rbFieldFlag        = m_LatestFrame.m_Timecode.m_FieldFlag != 0;
-  o_rSubFramesPerFrame = m_LatestFrame.m_Timecode.m_SubframesPerFrame;
-  o_rUserBits          = m_LatestFrame.m_Timecode.m_UserBits;
+  o_rHours             = m_pLatestFrame->m_Timecode.m_Hours;
+  o_rMinutes           = m_pLatestFrame->m_Timecode.m_Minutes;
+  o_rSeconds           = m_pLatestFrame->m_Timecode.m_Seconds;
+  o_rFrames            = m_pLatestFrame->m_Timecode.m_Frames;
+  o_rSubFrame          = m_pLatestFrame->m_Timecode.m_Subframes;
+  o_rbFieldFlag        = m_pLatestFrame->m_Timecode.m_FieldFlag != 0;
+  o_rSubFramesPerFrame = m_pLatestFrame->m_Timecode.m_SubframesPerFrame;
+  o_rUserBits          = m_pLatestFrame->m_Timecode.m_UserBits;
 
-  switch( m_LatestFrame.m_Timecode.m_Standard )
+  switch( m_pLatestFrame->m_Timecode.m_Standard )
   {
   case ViconCGStream::VTimecode::ETimecodePAL      : o_rTimecodeStandard = TimecodeStandard::PAL;      break;
   case ViconCGStream::VTimecode::ETimecodeNTSC     : o_rTimecodeStandard = TimecodeStandard::NTSC;     break;
@@ -650,16 +1079,17 @@ Result::Enum VClient::GetTimecode( unsigned int           & o_rHours,
 
 Result::Enum VClient::GetLatencyTotal( double & o_rLatency ) const
 {
-  boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
-  
+  Clear( o_rLatency );
+
   Result::Enum GetResult = Result::Success;
-  if ( !InitGet( GetResult, o_rLatency ) )
+  const std::shared_ptr< const VFrameSnapshot > pSnapshot = GetSnapshot( GetResult );
+  if ( !pSnapshot )
   {
     return GetResult; 
   }
 
-  std::vector< ViconCGStreamDetail::VLatencyInfo_Sample >::const_iterator It  = m_LatestFrame.m_Latency.m_Samples.begin();
-  std::vector< ViconCGStreamDetail::VLatencyInfo_Sample >::const_iterator End = m_LatestFrame.m_Latency.m_Samples.end();
+  std::vector< ViconCGStreamDetail::VLatencyInfo_Sample >::const_iterator It  = pSnapshot->m_pFrame->m_Latency->m_Samples.begin();
+  std::vector< ViconCGStreamDetail::VLatencyInfo_Sample >::const_iterator End = pSnapshot->m_pFrame->m_Latency->m_Samples.end();
   for( ; It != End ; ++It )
   {
     o_rLatency += It->m_Latency;
@@ -675,7 +1105,7 @@ Result::Enum VClient::GetLatencySampleCount( unsigned int & o_rSampleCount ) con
   Result::Enum GetResult = Result::Success;
   if ( InitGet( GetResult, o_rSampleCount ) )
   {
-    o_rSampleCount = static_cast< unsigned int >( m_LatestFrame.m_Latency.m_Samples.size() );
+    o_rSampleCount = static_cast< unsigned int >( m_pLatestFrame->m_Latency->m_Samples.size() );
   }
 
   return GetResult;
@@ -691,12 +1121,12 @@ Result::Enum VClient::GetLatencySampleName( const unsigned int i_SampleIndex, st
     return GetResult; 
   }
 
-  if( i_SampleIndex >= m_LatestFrame.m_Latency.m_Samples.size() )
+  if( i_SampleIndex >= m_pLatestFrame->m_Latency->m_Samples.size() )
   {
     return Result::InvalidIndex;
   }
 
-  o_rSampleName = m_LatestFrame.m_Latency.m_Samples[ i_SampleIndex ].m_Name;
+  o_rSampleName = m_pLatestFrame->m_Latency->m_Samples[ i_SampleIndex ].m_Name;
 
   return Result::Success;
 }
@@ -711,8 +1141,8 @@ Result::Enum VClient::GetLatencySampleValue( const std::string & i_rSampleName,
     return GetResult; 
   }
 
-  std::vector< ViconCGStreamDetail::VLatencyInfo_Sample >::const_iterator It  = m_LatestFrame.m_Latency.m_Samples.begin();
-  std::vector< ViconCGStreamDetail::VLatencyInfo_Sample >::const_iterator End = m_LatestFrame.m_Latency.m_Samples.end();
+  std::vector< ViconCGStreamDetail::VLatencyInfo_Sample >::const_iterator It  = m_pLatestFrame->m_Latency->m_Samples.begin();
+  std::vector< ViconCGStreamDetail::VLatencyInfo_Sample >::const_iterator End = m_pLatestFrame->m_Latency->m_Samples.end();
   for( ; It != End ; ++It )
   {
     if( It->m_Name == i_rSampleName )
@@ -725,6 +1155,43 @@ Result::Enum VClient::GetLatencySampleValue( const std::string & i_rSampleName,
   return Result::InvalidLatencySampleName;
 }
 
+Result::Enum VClient::GetLatencySamples( std::map< std::string, double > & o_rSamples ) const
+{
+  boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
+
+  Result::Enum GetResult = Result::Success;
+  if ( !InitGet( GetResult ) )
+  {
+    o_rSamples.clear();
+    return GetResult; 
+  }
+
+  // The same samples arrive with every frame, so existing entries are updated rather than rebuilt
+  const std::vector< ViconCGStreamDetail::VLatencyInfo_Sample > & rSamples = m_pLatestFrame->m_Latency->m_Samples;
+  bool bSameNames = o_rSamples.size() == rSamples.size();
+  for( auto SampleIt = rSamples.begin(); bSameNames && SampleIt != rSamples.end(); ++SampleIt )
+  {
+    const auto EntryIt = o_rSamples.find( SampleIt->m_Name );
+    bSameNames = EntryIt != o_rSamples.end();
+    if( bSameNames )
+    {
+      EntryIt->second = SampleIt->m_Latency;
+    }
+  }
+
+  if( !bSameNames )
+  {
+    // Some names changed, so drop the ones from the last frame
+    o_rSamples.clear();
+    for( const auto & rSample : rSamples )
+    {
+      o_rSamples[ rSample.m_Name ] = rSample.m_Latency;
+    }
+  }
+
+  return Result::Success;
+}
+
 Result::Enum VClient::GetHardwareFrameNumber( unsigned int & o_rFrameNumber ) const
 {
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
@@ -732,7 +1199,7 @@ Result::Enum VClient::GetHardwareFrameNumber( unsigned int & o_rFrameNumber ) co
   Result::Enum GetResult = Result::Success;
   if ( InitGet( GetResult, o_rFrameNumber ) )
   {
-    o_rFrameNumber = m_LatestFrame.m_HardwareFrame.m_HardwareFrame;
+    o_rFrameNumber = m_pLatestFrame->m_HardwareFrame.m_HardwareFrame;
   }
 
   return GetResult; 
@@ -747,7 +1214,7 @@ Result::Enum VClient::GetFrameRateCount( unsigned int & o_rFrameRateCount ) cons
     return GetResult; 
   }
 
-  o_rFrameRateCount = static_cast< unsigned int >( m_LatestFrame.m_FrameRateInfo.m_FrameRates.size() );
+  o_rFrameRateCount = static_cast< unsigned int >( m_pLatestFrame->m_FrameRateInfo->m_FrameRates.size() );
   return Result::Success;
 }
 
@@ -760,14 +1227,14 @@ Result::Enum VClient::GetFrameRateName( const unsigned int i_FrameRateIndex, std
     return GetResult; 
   }
 
-  if( i_FrameRateIndex >= m_LatestFrame.m_FrameRateInfo.m_FrameRates.size()  )
+  if( i_FrameRateIndex >= m_pLatestFrame->m_FrameRateInfo->m_FrameRates.size()  )
   {
     return Result::InvalidIndex;
   }
 
   unsigned int Counter = 0;
-  std::map< std::string, double >::const_iterator It= m_LatestFrame.m_FrameRateInfo.m_FrameRates.begin();
-  std::map< std::string, double >::const_iterator End= m_LatestFrame.m_FrameRateInfo.m_FrameRates.end();
+  std::map< std::string, double >::const_iterator It= m_pLatestFrame->m_FrameRateInfo->m_FrameRates.begin();
+  std::map< std::string, double >::const_iterator End= m_pLatestFrame->m_FrameRateInfo->m_FrameRates.end();
   for( ; It!=End; ++It, ++Counter )
   {
     if( Counter == i_FrameRateIndex )
@@ -788,13 +1255,13 @@ Result::Enum VClient::GetFrameRateValue( const std::string & i_rFrameRateName, d
     return GetResult; 
   }
 
-  if( !m_LatestFrame.m_FrameRateInfo.m_FrameRates.count( i_rFrameRateName ) )
+  if( !m_pLatestFrame->m_FrameRateInfo->m_FrameRates.count( i_rFrameRateName ) )
   {
     return Result::InvalidFrameRateName;
   }
 
 
-  std::map<std::string, double> FrameRates = m_LatestFrame.m_FrameRateInfo.m_FrameRates;
+  std::map<std::string, double> FrameRates = m_pLatestFrame->m_FrameRateInfo->m_FrameRates;
   o_rFrameRateValue = FrameRates[i_rFrameRateName];
   return Result::Success;
 }
@@ -1172,6 +1639,12 @@ Result::Enum VClient::SetAxisMapping( const Direction::Enum i_XAxis,
 
   m_pAxisMapping = pAxisMapping;
 
+  // Readers of the current frame should see the new mapping straight away
+  if( std::atomic_load( &m_pSnapshot ) )
+  {
+    PublishSnapshot();
+  }
+
   return Result::Success;
 }
 
@@ -1185,9 +1658,9 @@ void VClient::GetAxisMapping( Direction::Enum & o_rXAxis, Direction::Enum & o_rY
 Result::Enum VClient::GetServerOrientation( ServerOrientation::Enum & o_rServerOrientation ) const
 {
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
-  if( m_CachedFrame.m_ApplicationInfo )
+  if( m_pCachedFrame->m_ApplicationInfo )
   {
-    switch(m_CachedFrame.m_ApplicationInfo.get().m_AxisOrientation )
+    switch(m_pCachedFrame->m_ApplicationInfo.get().m_AxisOrientation )
     {
       case  ViconCGStream::VApplicationInfo::EYUp:
         o_rServerOrientation = ServerOrientation::YUp;
@@ -1211,12 +1684,13 @@ Result::Enum VClient::GetServerOrientation( ServerOrientation::Enum & o_rServerO
 
 Result::Enum VClient::GetSubjectCount( unsigned int & o_rSubjectCount ) const
 {
-  boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
-  
+  Clear( o_rSubjectCount );
+
   Result::Enum GetResult = Result::Success;
-  if ( InitGet( GetResult, o_rSubjectCount ) )
+  const std::shared_ptr< const VFrameSnapshot > pSnapshot = GetSnapshot( GetResult );
+  if ( pSnapshot )
   {
-    o_rSubjectCount = static_cast< unsigned int >( m_LatestFrame.m_Subjects.size() );
+    o_rSubjectCount = static_cast< unsigned int >( pSnapshot->m_pFrame->m_Subjects->size() );
   }
 
   return GetResult;
@@ -1225,20 +1699,21 @@ Result::Enum VClient::GetSubjectCount( unsigned int & o_rSubjectCount ) const
 Result::Enum VClient::GetSubjectName( const unsigned int i_SubjectIndex, 
                                             std::string& o_rSubjectName ) const
 {
-  boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
-  
+  Clear( o_rSubjectName );
+
   Result::Enum GetResult = Result::Success;
-  if ( !InitGet( GetResult, o_rSubjectName ) )
+  const std::shared_ptr< const VFrameSnapshot > pSnapshot = GetSnapshot( GetResult );
+  if ( !pSnapshot )
   {
     return GetResult; 
   }
 
-  if( i_SubjectIndex >= m_LatestFrame.m_Subjects.size() )
+  if( i_SubjectIndex >= pSnapshot->m_pFrame->m_Subjects->size() )
   {
     return Result::InvalidIndex;
   }
 
-  o_rSubjectName = m_LatestFrame.m_Subjects[ i_SubjectIndex ].m_Name;
+  o_rSubjectName = (*pSnapshot->m_pFrame->m_Subjects)[ i_SubjectIndex ].m_Name;
   return Result::Success;
 }
 
@@ -1337,8 +1812,8 @@ Result::Enum VClient::GetSegmentChildCount( const std::string  & i_rSubjectName,
   }
 
   // here we have a valid frame of data. need to check for this subject and retrieve information
-  std::vector< ViconCGStream::VSubjectInfo >::const_iterator SubIt  = m_LatestFrame.m_Subjects.begin();
-  std::vector< ViconCGStream::VSubjectInfo >::const_iterator SubEnd = m_LatestFrame.m_Subjects.end();
+  std::vector< ViconCGStream::VSubjectInfo >::const_iterator SubIt  = m_pLatestFrame->m_Subjects->begin();
+  std::vector< ViconCGStream::VSubjectInfo >::const_iterator SubEnd = m_pLatestFrame->m_Subjects->end();
   for( ; SubIt != SubEnd ; ++SubIt )
   {
     if( SubjectID == SubIt->m_SubjectID )
@@ -1383,8 +1858,8 @@ Result::Enum VClient::GetSegmentChildName( const std::string& i_rSubjectName, co
   }
 
   // here we have a valid frame of data. need to check for this subject and retrieve information
-  std::vector< ViconCGStream::VSubjectInfo >::const_iterator SubIt  = m_LatestFrame.m_Subjects.begin();
-  std::vector< ViconCGStream::VSubjectInfo >::const_iterator SubEnd = m_LatestFrame.m_Subjects.end();
+  std::vector< ViconCGStream::VSubjectInfo >::const_iterator SubIt  = m_pLatestFrame->m_Subjects->begin();
+  std::vector< ViconCGStream::VSubjectInfo >::const_iterator SubEnd = m_pLatestFrame->m_Subjects->end();
   for( ; SubIt != SubEnd ; ++SubIt )
   {
     if( SubjectID == SubIt->m_SubjectID )
@@ -1435,8 +1910,8 @@ Result::Enum VClient::GetSegmentParentName( const std::string& i_rSubjectName, c
   }
 
   // here we have a valid frame of data. need to check for this subject and retrieve information
-  std::vector< ViconCGStream::VSubjectInfo >::const_iterator SubIt  = m_LatestFrame.m_Subjects.begin();
-  std::vector< ViconCGStream::VSubjectInfo >::const_iterator SubEnd = m_LatestFrame.m_Subjects.end();
+  std::vector< ViconCGStream::VSubjectInfo >::const_iterator SubIt  = m_pLatestFrame->m_Subjects->begin();
+  std::vector< ViconCGStream::VSubjectInfo >::const_iterator SubEnd = m_pLatestFrame->m_Subjects->end();
   for( ; SubIt != SubEnd ; ++SubIt )
   {
     if( SubjectID == SubIt->m_SubjectID )
@@ -1652,9 +2127,9 @@ Result::Enum VClient::GetMarkerGlobalTranslation( const std::string & i_rSubject
   }
 
   // go through the frame's reconstructions and find its position in this frame
-  for( unsigned int i = 0 ; i < m_LatestFrame.m_LabeledRecons.m_LabeledRecons.size() ; ++i )
+  for( unsigned int i = 0 ; i < m_pLatestFrame->m_LabeledRecons->m_LabeledRecons.size() ; ++i )
   {
-    const ViconCGStreamDetail::VLabeledRecons_LabeledRecon& rRecon = m_LatestFrame.m_LabeledRecons.m_LabeledRecons[i];
+    const ViconCGStreamDetail::VLabeledRecons_LabeledRecon& rRecon = m_pLatestFrame->m_LabeledRecons->m_LabeledRecons[i];
     if( rRecon.m_SubjectID == SubjectID && rRecon.m_MarkerID == MarkerID )
     {  
       CopyAndTransformT( rRecon.m_Position, o_rThreeVector );
@@ -1724,7 +2199,7 @@ Result::Enum VClient::GetUnlabeledMarkerCount( unsigned int & o_rMarkerCount ) c
   Result::Enum GetResult = Result::Success;
   if ( InitGet( GetResult, o_rMarkerCount ) )
   {
-    o_rMarkerCount = static_cast< unsigned int >( m_LatestFrame.m_UnlabeledRecons.m_UnlabeledRecons.size() );
+    o_rMarkerCount = static_cast< unsigned int >( m_pLatestFrame->m_UnlabeledRecons->m_UnlabeledRecons.size() );
   }
 
   return GetResult;
@@ -1742,13 +2217,13 @@ Result::Enum VClient::GetUnlabeledMarkerGlobalTranslation( const unsigned int
     return GetResult; 
   }
 
-  if( i_MarkerIndex >= m_LatestFrame.m_UnlabeledRecons.m_UnlabeledRecons.size() )
+  if( i_MarkerIndex >= m_pLatestFrame->m_UnlabeledRecons->m_UnlabeledRecons.size() )
   {
     return Result::InvalidIndex;
   }
 
-  CopyAndTransformT( m_LatestFrame.m_UnlabeledRecons.m_UnlabeledRecons[ i_MarkerIndex ].m_Position, o_rTranslation );
-  o_rTrajID = m_LatestFrame.m_UnlabeledRecons.m_UnlabeledRecons[i_MarkerIndex].m_TrajectoryId;
+  CopyAndTransformT( m_pLatestFrame->m_UnlabeledRecons->m_UnlabeledRecons[ i_MarkerIndex ].m_Position, o_rTranslation );
+  o_rTrajID = m_pLatestFrame->m_UnlabeledRecons->m_UnlabeledRecons[i_MarkerIndex].m_TrajectoryId;
   return Result::Success;
 }
 
@@ -1759,7 +2234,7 @@ Result::Enum VClient::GetLabeledMarkerCount( unsigned int & o_rMarkerCount ) con
   Result::Enum GetResult = Result::Success;
   if ( InitGet( GetResult, o_rMarkerCount ) )
   {
-    o_rMarkerCount = static_cast< unsigned int >( m_LatestFrame.m_LabeledRecons.m_LabeledRecons.size() );
+    o_rMarkerCount = static_cast< unsigned int >( m_pLatestFrame->m_LabeledRecons->m_LabeledRecons.size() );
   }
 
   return GetResult;
@@ -1777,13 +2252,13 @@ Result::Enum VClient::GetLabeledMarkerGlobalTranslation( const unsigned int   i_
     return GetResult;
   }
 
-  if( i_MarkerIndex >= m_LatestFrame.m_LabeledRecons.m_LabeledRecons.size() )
+  if( i_MarkerIndex >= m_pLatestFrame->m_LabeledRecons->m_LabeledRecons.size() )
   {
     return Result::InvalidIndex;
   }
 
-  CopyAndTransformT( m_LatestFrame.m_LabeledRecons.m_LabeledRecons[ i_MarkerIndex ].m_Position, o_rTranslation );
-  o_rTrajID = m_LatestFrame.m_LabeledRecons.m_LabeledRecons[i_MarkerIndex].m_TrajectoryId;
+  CopyAndTransformT( m_pLatestFrame->m_LabeledRecons->m_LabeledRecons[ i_MarkerIndex ].m_Position, o_rTranslation );
+  o_rTrajID = m_pLatestFrame->m_LabeledRecons->m_LabeledRecons[i_MarkerIndex].m_TrajectoryId;
   return Result::Success;
 }
 
@@ -1800,7 +2275,7 @@ Result::Enum VClient::CalculateGlobalsFromLocals()
   }
 
   // For all subjects
-  for ( const auto & rSubject : m_LatestFrame.m_Subjects )
+  for ( const auto & rSubject : *m_pLatestFrame->m_Subjects )
   {
     const std::string & rSubjectName = rSubject.m_Name;
     std::string SubjectRoot;
@@ -1811,7 +2286,7 @@ Result::Enum VClient::CalculateGlobalsFromLocals()
       break;
     }
 
-    for ( const auto & rLightweightSegments : m_LatestFrame.m_LightweightSegments )
+    for ( const auto & rLightweightSegments : *m_pLatestFrame->m_LightweightSegments )
     {
       if ( rLightweightSegments.m_SubjectID == rSubject.m_SubjectID )
       {
@@ -1821,7 +2296,7 @@ Result::Enum VClient::CalculateGlobalsFromLocals()
 
         // Create some new segments. SHould probably check that there isn't already an entry for this subject...
         bool bGlobalsFound = false;
-        for ( const auto & rGlobalSegments : m_LatestFrame.m_GlobalSegments )
+        for ( const auto & rGlobalSegments : *m_pLatestFrame->m_GlobalSegments )
         {
           if ( rGlobalSegments.m_SubjectID == rSubject.m_SubjectID )
           {
@@ -1835,7 +2310,7 @@ Result::Enum VClient::CalculateGlobalsFromLocals()
         }
 
         bool bLocalsFound = false;
-        for ( const auto & rLocalSegments : m_LatestFrame.m_LocalSegments )
+        for ( const auto & rLocalSegments : *m_pLatestFrame->m_LocalSegments )
         {
           if ( rLocalSegments.m_SubjectID == rSubject.m_SubjectID )
           {
@@ -1860,8 +2335,8 @@ Result::Enum VClient::CalculateGlobalsFromLocals()
         if( GetResult == Result::Success )
         { 
           // Add these segments to the frame
-          m_LatestFrame.m_GlobalSegments.push_back( GlobalSegments );
-          m_LatestFrame.m_LocalSegments.push_back( LocalSegments );
+          m_pLatestFrame->m_GlobalSegments.Mutable().push_back( GlobalSegments );
+          m_pLatestFrame->m_LocalSegments.Mutable().push_back( LocalSegments );
         }
         break;
       }
@@ -1977,23 +2452,12 @@ Result::Enum VClient::GetSegmentGlobalTranslation( const std::string & i_rSubjec
     return _Result;
   }
   
-  // go through the frame's segment data and find its position in this frame
-  for ( unsigned int i = 0; i < m_LatestFrame.m_GlobalSegments.size(); i++ )
+  // find its position in this frame
+  const ViconCGStreamDetail::VGlobalSegments_Segment * pSegment = FindGlobalSegment( SubjectID, SegmentID );
+  if( pSegment )
   {
-    const ViconCGStream::VGlobalSegments& rSegments = m_LatestFrame.m_GlobalSegments[i];
-    if ( rSegments.m_SubjectID == SubjectID )
-    {
-      // now look through its segments
-      for ( unsigned int j = 0; j < rSegments.m_Segments.size(); j++ )
-      {
-        const ViconCGStreamDetail::VGlobalSegments_Segment& rSegment = rSegments.m_Segments[j];
-        if ( rSegment.m_SegmentID == SegmentID )
-        {
-          CopyAndTransformT( rSegment.m_Translation, o_rThreeVector );
-          return Result::Success;
-        }
-      }
-    }
+    CopyAndTransformT( pSegment->m_Translation, o_rThreeVector );
+    return Result::Success;
   }
 
   // if we're here then they entered correct subject and marker info,
@@ -2048,30 +2512,14 @@ Result::Enum VClient::GetSegmentGlobalRotationMatrix( const std::string & i_rSub
     return _Result;
   }
 
-  // go through the frame's segment data and find its position in this frame
-  std::vector< ViconCGStream::VGlobalSegments >::const_iterator SegmentIt = m_LatestFrame.m_GlobalSegments.begin();
-  std::vector< ViconCGStream::VGlobalSegments >::const_iterator SegmentEnd = m_LatestFrame.m_GlobalSegments.end();
-  for ( ; SegmentIt != SegmentEnd; ++SegmentIt )
+  // find its position in this frame
+  const ViconCGStreamDetail::VGlobalSegments_Segment * pSegment = FindGlobalSegment( SubjectID, SegmentID );
+  if( pSegment )
   {
-    const ViconCGStream::VGlobalSegments & rSegments( *SegmentIt );
-    if ( rSegments.m_SubjectID == SubjectID )
-    {
-      // now look through the segment detail
-      std::vector< ViconCGStreamDetail::VGlobalSegments_Segment >::const_iterator SegmentDetailIt = rSegments.m_Segments.begin();
-      std::vector< ViconCGStreamDetail::VGlobalSegments_Segment >::const_iterator SegmentDetailEnd = rSegments.m_Segments.end();
-      for ( ; SegmentDetailIt != SegmentDetailEnd; ++SegmentDetailIt )
-      {
-        const ViconCGStreamDetail::VGlobalSegments_Segment & rSegment( *SegmentDetailIt );
-        if ( rSegment.m_SegmentID == SegmentID )
-        {
-          // copy out the answer
-
-          CopyAndTransformR( rSegment.m_Rotation, o_rRotation );
-          o_rbOccluded = false;
-          return Result::Success;
-        }
-      }
-    }
+    // copy out the answer
+    CopyAndTransformR( pSegment->m_Rotation, o_rRotation );
+    o_rbOccluded = false;
+    return Result::Success;
   }
 
   // if we're here then they entered correct subject and marker info,
@@ -2306,23 +2754,12 @@ Result::Enum VClient::GetSegmentLocalTranslation( const std::string & i_rSubject
     return _Result;
   }
 
-  // go through the frame's segment data and find its position in this frame
-  for ( unsigned int i = 0; i < m_LatestFrame.m_LocalSegments.size(); i++ )
+  // find its position in this frame
+  const ViconCGStreamDetail::VLocalSegments_Segment * pSegment = FindLocalSegment( SubjectID, SegmentID );
+  if( pSegment )
   {
-    const ViconCGStream::VLocalSegments& rSegments = m_LatestFrame.m_LocalSegments[i];
-    if ( rSegments.m_SubjectID == SubjectID )
-    {
-      // now look through its segments
-      for ( unsigned int j = 0; j < rSegments.m_Segments.size(); j++ )
-      {
-        const ViconCGStreamDetail::VLocalSegments_Segment& rSegment = rSegments.m_Segments[j];
-        if ( rSegment.m_SegmentID == SegmentID )
-        {
-          CopyAndTransformT( rSegment.m_Translation, o_rThreeVector );
-          return Result::Success;
-        }
-      }
-    }
+    CopyAndTransformT( pSegment->m_Translation, o_rThreeVector );
+    return Result::Success;
   }
 
   // if we're here then they entered correct subject and marker info,
@@ -2377,29 +2814,14 @@ Result::Enum VClient::GetSegmentLocalRotationMatrix( const std::string & i_rSubj
     return _Result;
   }
 
-  // go through the frame's segment data and find its position in this frame
-  std::vector< ViconCGStream::VLocalSegments >::const_iterator SegmentIt = m_LatestFrame.m_LocalSegments.begin();
-  std::vector< ViconCGStream::VLocalSegments >::const_iterator SegmentEnd = m_LatestFrame.m_LocalSegments.end();
-  for ( ; SegmentIt != SegmentEnd; ++SegmentIt )
+  // find its position in this frame
+  const ViconCGStreamDetail::VLocalSegments_Segment * pSegment = FindLocalSegment( SubjectID, SegmentID );
+  if( pSegment )
   {
-    const ViconCGStream::VLocalSegments & rSegments( *SegmentIt );
-    if ( rSegments.m_SubjectID == SubjectID )
-    {
-      // now look through the segment detail
-      std::vector< ViconCGStreamDetail::VLocalSegments_Segment >::const_iterator SegmentDetailIt = rSegments.m_Segments.begin();
-      std::vector< ViconCGStreamDetail::VLocalSegments_Segment >::const_iterator SegmentDetailEnd = rSegments.m_Segments.end();
-      for ( ; SegmentDetailIt != SegmentDetailEnd; ++SegmentDetailIt )
-      {
-        const ViconCGStreamDetail::VLocalSegments_Segment & rSegment( *SegmentDetailIt );
-        if ( rSegment.m_SegmentID == SegmentID )
-        {
-          // copy out the answer
-          CopyAndTransformR( rSegment.m_Rotation, o_rRotation );
-          o_rbOccluded = false;
-          return Result::Success;
-        }
-      }
-    }
+    // copy out the answer
+    CopyAndTransformR( pSegment->m_Rotation, o_rRotation );
+    o_rbOccluded = false;
+    return Result::Success;
   }
 
   // if we're here then they entered correct subject and marker info,
@@ -2460,18 +2882,20 @@ Result::Enum VClient::GetMarkerID( const ViconCGStream::VSubjectInfo & i_rSubjec
     return Result::InvalidMarkerName;
   }
 
-  const std::vector< ViconCGStreamDetail::VSubjectInfo_Marker > & rMarkers = i_rSubjectInfo.m_Markers;
-  for( unsigned int j = 0 ; j < rMarkers.size() ; ++j )
+  const auto SubjectIt = m_pFrameIndex->m_SubjectIDIndex.find( i_rSubjectInfo.m_SubjectID );
+  if( SubjectIt == m_pFrameIndex->m_SubjectIDIndex.end() )
   {
-    const ViconCGStreamDetail::VSubjectInfo_Marker & rMarker = rMarkers[j];
-    if( i_rMarkerName == rMarker.m_Name )
-    {
-      o_rMarkerID = rMarker.m_MarkerID;
-      return Result::Success;
-    }
+    return Result::InvalidMarkerName;
   }
 
-  return Result::InvalidMarkerName;
+  const auto MarkerIt = SubjectIt->second.m_MarkerIDs.find( i_rMarkerName );
+  if( MarkerIt == SubjectIt->second.m_MarkerIDs.end() )
+  {
+    return Result::InvalidMarkerName;
+  }
+
+  o_rMarkerID = MarkerIt->second;
+  return Result::Success;
 }
 
 Result::Enum VClient::GetSubjectAndMarkerID( const std::string  & i_rSubjectName, 
@@ -2504,17 +2928,129 @@ Result::Enum VClient::GetSegmentID( const ViconCGStream::VSubjectInfo & i_rSubje
     return Result::InvalidSegmentName;
   }
 
-  const std::vector< ViconCGStreamDetail::VSubjectInfo_Segment > & rSegments = i_rSubjectInfo.m_Segments;
-  for ( unsigned int j = 0; j < rSegments.size(); ++j )
+  const auto SubjectIt = m_pFrameIndex->m_SubjectIDIndex.find( i_rSubjectInfo.m_SubjectID );
+  if( SubjectIt == m_pFrameIndex->m_SubjectIDIndex.end() )
+  {
+    return Result::InvalidSegmentName;
+  }
+
+  const auto SegmentIt = SubjectIt->second.m_Segments.find( i_rSegmentName );
+  if( SegmentIt == SubjectIt->second.m_Segments.end() )
+  {
+    return Result::InvalidSegmentName;
+  }
+
+  o_rSegmentID = m_pFrameIndex->m_IndexedSegments[ SegmentIt->second ].second;
+  return Result::Success;
+}
+
+Result::Enum VClient::GetSegmentHandle( const std::string               & i_rSubjectName, 
+                                        const std::string               & i_rSegmentName, 
+                                              ViconCGStreamType::UInt64 & o_rHandle ) const
+{
+  boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
+
+  o_rHandle = 0;
+
+  Result::Enum GetResult = Result::Success;
+  const ViconCGStream::VSubjectInfo * pSubjectInfo = GetSubjectInfo( i_rSubjectName, GetResult );
+  if( !pSubjectInfo )
+  {
+    return GetResult;
+  }
+
+  const VFrameIndex::VSubjectNameIndex & rIndex = m_pFrameIndex->m_SubjectIDIndex.at( pSubjectInfo->m_SubjectID );
+  const auto SegmentIt = rIndex.m_Segments.find( i_rSegmentName );
+  if( i_rSegmentName.empty() || SegmentIt == rIndex.m_Segments.end() )
+  {
+    return Result::InvalidSegmentName;
+  }
+
+  o_rHandle = ( static_cast< ViconCGStreamType::UInt64 >( m_pFrameIndex->m_SegmentHandleGeneration ) << 32 ) | SegmentIt->second;
+  return Result::Success;
+}
+
+Result::Enum VClient::GetSegmentGlobalPose( const ViconCGStreamType::UInt64   i_Handle,
+                                                  double                  ( & o_rTranslation )[3],
+                                                  double                  ( & o_rRotation )[4],
+                                                  bool                      & o_rbOccluded ) const
+{
+  Clear( o_rTranslation );
+  Clear( o_rRotation );
+  Clear( o_rbOccluded );
+
+  Result::Enum GetResult = Result::Success;
+  const std::shared_ptr< const VFrameSnapshot > pSnapshot = GetSnapshot( GetResult );
+  if ( !pSnapshot )
+  {
+    return GetResult; 
+  }
+
+  const unsigned int Generation = static_cast< unsigned int >( i_Handle >> 32 );
+  const unsigned int SegmentIndex = static_cast< unsigned int >( i_Handle & 0xFFFFFFFF );
+  if( Generation != pSnapshot->m_pIndex->m_SegmentHandleGeneration || SegmentIndex >= pSnapshot->m_GlobalSegments.size() )
+  {
+    return Result::InvalidIndex;
+  }
+
+  const ViconCGStreamDetail::VGlobalSegments_Segment * pSegment = pSnapshot->m_GlobalSegments[ SegmentIndex ];
+  if( !pSegment )
+  {
+    // Known segment, but not in this frame
+    o_rbOccluded = true;
+    return Result::Success;
+  }
+
+  double RotationArray[ 9 ];
+  pSnapshot->CopyAndTransformT( pSegment->m_Translation, o_rTranslation );
+  pSnapshot->CopyAndTransformR( pSegment->m_Rotation, RotationArray );
+  MatrixToQuaternion( RotationArray, o_rRotation );
+  return Result::Success;
+}
+
+Result::Enum VClient::GetAllSegmentGlobalPoses( const unsigned int                i_Capacity,
+                                                      ViconCGStreamType::UInt64 * o_pHandles,
+                                                      double                    * o_pTranslations,
+                                                      double                    * o_pRotations,
+                                                      bool                      * o_pOccluded,
+                                                      unsigned int              & o_rSegmentCount ) const
+{
+  Clear( o_rSegmentCount );
+
+  Result::Enum GetResult = Result::Success;
+  const std::shared_ptr< const VFrameSnapshot > pSnapshot = GetSnapshot( GetResult );
+  if ( !pSnapshot )
+  {
+    return GetResult; 
+  }
+
+  o_rSegmentCount = static_cast< unsigned int >( pSnapshot->m_GlobalSegments.size() );
+  const unsigned int Count = std::min( i_Capacity, o_rSegmentCount );
+
+  const ViconCGStreamType::UInt64 Generation = static_cast< ViconCGStreamType::UInt64 >( pSnapshot->m_pIndex->m_SegmentHandleGeneration ) << 32;
+  for( unsigned int SegmentIndex = 0; SegmentIndex < Count; ++SegmentIndex )
   {
-    const ViconCGStreamDetail::VSubjectInfo_Segment & rSegment = rSegments[j];
-    if (i_rSegmentName == rSegment.m_Name)
+    double Translation[ 3 ] = { 0.0, 0.0, 0.0 };
+    double Rotation[ 4 ] = { 0.0, 0.0, 0.0, 0.0 };
+    bool bOccluded = true;
+
+    const ViconCGStreamDetail::VGlobalSegments_Segment * pSegment = pSnapshot->m_GlobalSegments[ SegmentIndex ];
+    if( pSegment )
     {
-      o_rSegmentID = rSegment.m_SegmentID;
-      return Result::Success;
+      double RotationArray[ 9 ];
+      pSnapshot->CopyAndTransformT( pSegment->m_Translation, Translation );
+      pSnapshot->CopyAndTransformR( pSegment->m_Rotation, RotationArray );
+      MatrixToQuaternion( RotationArray, Rotation );
+      bOccluded = false;
     }
+
+    o_pHandles[ SegmentIndex ] = Generation | SegmentIndex;
+    std::copy( Translation, Translation + 3, o_pTranslations + 3 * SegmentIndex );
+    std::copy( Rotation, Rotation + 4, o_pRotations + 4 * SegmentIndex );
+    o_pOccluded[ SegmentIndex ] = bOccluded;
   }
-  return Result::InvalidSegmentName;
+
+  return Result::Success;
 }
 
 Result::Enum VClient::GetSubjectAndSegmentID( const std::string  & i_rSubjectName, 
@@ -2544,16 +3080,11 @@ const ViconCGStream::VDeviceInfo * VClient::GetDevice( const std::string & i_rDe
 {
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
 
-  const auto DeviceIt =
-    std::find_if( m_LatestFrame.m_Devices.begin(), m_LatestFrame.m_Devices.end(),
-      [&i_rDeviceName]( const ViconCGStream::VDeviceInfo& rDevice )
-        { return i_rDeviceName == AdaptDeviceName( rDevice.m_Name, rDevice.m_DeviceID ); } 
-    );
-  
-  if( DeviceIt != m_LatestFrame.m_Devices.end() )
+  const auto DeviceIt = m_pFrameIndex->m_DeviceNameIndex.find( i_rDeviceName );
+  if( DeviceIt != m_pFrameIndex->m_DeviceNameIndex.end() )
   {
     o_rResult = Result::Success;
-    return &(*DeviceIt);
+    return &(*m_pLatestFrame->m_Devices)[ DeviceIt->second ];
   }
   o_rResult = Result::InvalidDeviceName;
   return nullptr;
@@ -2593,9 +3124,9 @@ Result::Enum VClient::GetReconRayAssignments( const std::string& i_rSubjectName,
   }
 
   // go through the frame's reconstructions and find the ray contributions
-  for( unsigned int i = 0; i < m_LatestFrame.m_LabeledReconRayAssignments.m_ReconRayAssignments.size(); ++i )
+  for( unsigned int i = 0; i < m_pLatestFrame->m_LabeledReconRayAssignments->m_ReconRayAssignments.size(); ++i )
   {
-    const ViconCGStreamDetail::VReconRayAssignments& rReconAssignments = m_LatestFrame.m_LabeledReconRayAssignments.m_ReconRayAssignments[i];
+    const ViconCGStreamDetail::VReconRayAssignments& rReconAssignments = m_pLatestFrame->m_LabeledReconRayAssignments->m_ReconRayAssignments[i];
     if( rReconAssignments.m_SubjectID == SubjectID && rReconAssignments.m_MarkerID == MarkerID )
     {
       for( const auto & rReconRay : rReconAssignments.m_ReconRays )
@@ -2624,15 +3155,11 @@ const ViconCGStream::VSubjectInfo * VClient::GetSubjectInfo( const std::string
     return NULL;
   }
 
-  std::vector< ViconCGStream::VSubjectInfo >::const_iterator It  = m_LatestFrame.m_Subjects.begin();
-  std::vector< ViconCGStream::VSubjectInfo >::const_iterator End = m_LatestFrame.m_Subjects.end();
-  for( ; It != End ; ++It )
+  const auto SubjectIt = m_pFrameIndex->m_SubjectNameIndex.find( i_rSubjectName );
+  if( SubjectIt != m_pFrameIndex->m_SubjectNameIndex.end() )
   {
-    if( i_rSubjectName == It->m_Name )
-    {
-      o_rResult = Result::Success;
-      return &(*It);
-    }
+    o_rResult = Result::Success;
+    return &(*m_pLatestFrame->m_Subjects)[ SubjectIt->second ];
   }
 
   return NULL;
@@ -2642,8 +3169,8 @@ const ViconCGStream::VSubjectTopology * VClient::GetSubjectTopology( const unsig
 {
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
   
-  std::vector< ViconCGStream::VSubjectTopology >::const_iterator It  = m_LatestFrame.m_SubjectTopologies.begin();
-  std::vector< ViconCGStream::VSubjectTopology >::const_iterator End = m_LatestFrame.m_SubjectTopologies.end();
+  std::vector< ViconCGStream::VSubjectTopology >::const_iterator It  = m_pLatestFrame->m_SubjectTopologies->begin();
+  std::vector< ViconCGStream::VSubjectTopology >::const_iterator End = m_pLatestFrame->m_SubjectTopologies->end();
   for( ; It != End ; ++It )
   {
     if( i_SubjectID == It->m_SubjectID )
@@ -2660,8 +3187,8 @@ const ViconCGStream::VSubjectScale * VClient::GetSubjectScale(const unsigned int
 {
   boost::recursive_mutex::scoped_lock Lock(m_FrameMutex);
 
-  std::vector< ViconCGStream::VSubjectScale >::const_iterator It = m_LatestFrame.m_SubjectScales.begin();
-  std::vector< ViconCGStream::VSubjectScale >::const_iterator End = m_LatestFrame.m_SubjectScales.end();
+  std::vector< ViconCGStream::VSubjectScale >::const_iterator It = m_pLatestFrame->m_SubjectScales->begin();
+  std::vector< ViconCGStream::VSubjectScale >::const_iterator End = m_pLatestFrame->m_SubjectScales->end();
   for( ; It != End; ++It )
   {
     if( i_SubjectID == It->m_SubjectID )
@@ -2677,8 +3204,8 @@ const ViconCGStream::VObjectQuality * VClient::GetObjectQuality( const unsigned
 {
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
 
-  std::vector< ViconCGStream::VObjectQuality >::const_iterator It = m_LatestFrame.m_ObjectQualities.begin();
-  std::vector< ViconCGStream::VObjectQuality >::const_iterator End = m_LatestFrame.m_ObjectQualities.end();
+  std::vector< ViconCGStream::VObjectQuality >::const_iterator It = m_pLatestFrame->m_ObjectQualities->begin();
+  std::vector< ViconCGStream::VObjectQuality >::const_iterator End = m_pLatestFrame->m_ObjectQualities->end();
   for( ; It != End; ++It )
   {
     if( i_SubjectID == It->m_SubjectID )
@@ -2694,13 +3221,13 @@ const ViconCGStream::VCentroids * VClient::GetCentroidSet( const unsigned int i_
 {
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
 
-  const auto rCentroidSetIt = std::find_if( m_LatestFrame.m_Centroids.begin(), m_LatestFrame.m_Centroids.end(),
+  const auto rCentroidSetIt = std::find_if( m_pLatestFrame->m_Centroids->begin(), m_pLatestFrame->m_Centroids->end(),
                                             [&i_CameraID]( const ViconCGStream::VCentroids & rSet )
                                             {
                                               return rSet.m_CameraID == i_CameraID;
                                             } );
 
-  if( rCentroidSetIt != m_LatestFrame.m_Centroids.end() )
+  if( rCentroidSetIt != m_pLatestFrame->m_Centroids->end() )
   {
     o_rResult = Result::Success;
     return &(*rCentroidSetIt);
@@ -2714,13 +3241,13 @@ const ViconCGStream::VCentroidWeights * VClient::GetCentroidWeightSet( const uns
 {
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
 
-  const auto rCentroidWeightSetIt = std::find_if( m_LatestFrame.m_CentroidWeights.begin(), m_LatestFrame.m_CentroidWeights.end(),
+  const auto rCentroidWeightSetIt = std::find_if( m_pLatestFrame->m_CentroidWeights->begin(), m_pLatestFrame->m_CentroidWeights->end(),
     [&i_CameraID]( const ViconCGStream::VCentroidWeights & rSet )
   {
     return rSet.m_CameraID == i_CameraID;
   } );
 
-  if( rCentroidWeightSetIt != m_LatestFrame.m_CentroidWeights.end() )
+  if( rCentroidWeightSetIt != m_pLatestFrame->m_CentroidWeights->end() )
   {
     o_rResult = Result::Success;
     return &( *rCentroidWeightSetIt );
@@ -2737,26 +3264,26 @@ const ViconCGStream::VGreyscaleBlobs  * VClient::GetGreyscaleBlobs( const unsign
   // First look in the subsampled blobs.
   // When the camera information contains the subsampling mode, we will be able to tell where the data should be and give an appropriate error
   // if it isn't, but for now, look in both places
-  const auto rGreyscaleSubsampledBlobIt = std::find_if( m_LatestFrame.m_GreyscaleSubsampledBlobs.begin(), m_LatestFrame.m_GreyscaleSubsampledBlobs.end(),
+  const auto rGreyscaleSubsampledBlobIt = std::find_if( m_pLatestFrame->m_GreyscaleSubsampledBlobs->begin(), m_pLatestFrame->m_GreyscaleSubsampledBlobs->end(),
                                               [&i_CameraID](const ViconCGStream::VGreyscaleSubsampledBlobs & rSet )
                                               {
                                                 return rSet.m_CameraID == i_CameraID;
                                               });
-  if (rGreyscaleSubsampledBlobIt != m_LatestFrame.m_GreyscaleSubsampledBlobs.end())
+  if (rGreyscaleSubsampledBlobIt != m_pLatestFrame->m_GreyscaleSubsampledBlobs->end())
   {
     o_rResult = Result::Success;
     return &(*rGreyscaleSubsampledBlobIt);
   }
   else
   {
-    const auto rGreyscaleBlobIt = std::find_if(m_LatestFrame.m_GreyscaleBlobs.begin(), m_LatestFrame.m_GreyscaleBlobs.end(),
+    const auto rGreyscaleBlobIt = std::find_if(m_pLatestFrame->m_GreyscaleBlobs->begin(), m_pLatestFrame->m_GreyscaleBlobs->end(),
       [&i_CameraID](const ViconCGStream::VGreyscaleBlobs & rSet)
     {
       return rSet.m_CameraID == i_CameraID;
     });
 
 
-    if (rGreyscaleBlobIt != m_LatestFrame.m_GreyscaleBlobs.end())
+    if (rGreyscaleBlobIt != m_pLatestFrame->m_GreyscaleBlobs->end())
     {
       o_rResult = Result::Success;
       return &(*rGreyscaleBlobIt);
@@ -2771,13 +3298,13 @@ void VClient::GetVideoFrame( const unsigned int i_CameraID, Result::Enum & o_rRe
 {
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
 
-  const auto rVideoFramePtrIt = std::find_if( m_LatestFrame.m_VideoFrames.begin(), m_LatestFrame.m_VideoFrames.end(),
+  const auto rVideoFramePtrIt = std::find_if( m_pLatestFrame->m_VideoFrames.begin(), m_pLatestFrame->m_VideoFrames.end(),
                                               [&i_CameraID]( const ViconCGStreamClientSDK::VVideoFramePtr & rPtr )
                                               {
                                                 return (*rPtr).m_CameraID == i_CameraID;
                                               } );
 
-  if( rVideoFramePtrIt != m_LatestFrame.m_VideoFrames.end() )
+  if( rVideoFramePtrIt != m_pLatestFrame->m_VideoFrames.end() )
   {
     o_rResult = Result::Success;
     o_rVideoFramePtr = *rVideoFramePtrIt;
@@ -2797,9 +3324,9 @@ bool VClient::IsForcePlateDevice( unsigned int i_DeviceID ) const
   unsigned int RelevantChannels = 0;
 
   // check for any channel information that would mean this is a forceplate
-  for (unsigned int j = 0; j < m_LatestFrame.m_Channels.size(); j++)
+  for (unsigned int j = 0; j < m_pLatestFrame->m_Channels->size(); j++)
   {
-    const ViconCGStream::VChannelInfo& rChannel = m_LatestFrame.m_Channels[j];
+    const ViconCGStream::VChannelInfo& rChannel = (*m_pLatestFrame->m_Channels)[j];
 
     if (i_DeviceID == rChannel.m_DeviceID && IsForcePlateCoreChannel(rChannel))
     {
@@ -2864,9 +3391,9 @@ Result::Enum VClient::GetForcePlateCount( unsigned int & o_rCount ) const
 
   unsigned int ForcePlates = 0;
 
-  for( unsigned int i = 0; i < m_LatestFrame.m_Devices.size(); i++ )
+  for( unsigned int i = 0; i < m_pLatestFrame->m_Devices->size(); i++ )
   {
-    if( IsForcePlateDevice( m_LatestFrame.m_Devices[i].m_DeviceID ) )
+    if( IsForcePlateDevice( (*m_pLatestFrame->m_Devices)[i].m_DeviceID ) )
     {
       ForcePlates++;
     }
@@ -2888,9 +3415,9 @@ Result::Enum VClient::GetForcePlateID( unsigned int i_ZeroIndexedPlateIndex, uns
 
   unsigned int ForcePlates = 0;
 
-  for( unsigned int i = 0 ; i < m_LatestFrame.m_Devices.size() ; ++i )
+  for( unsigned int i = 0 ; i < m_pLatestFrame->m_Devices->size() ; ++i )
   {
-    if( !IsForcePlateDevice( m_LatestFrame.m_Devices[i].m_DeviceID ) )
+    if( !IsForcePlateDevice( (*m_pLatestFrame->m_Devices)[i].m_DeviceID ) )
     {
       continue;
     }
@@ -2898,7 +3425,7 @@ Result::Enum VClient::GetForcePlateID( unsigned int i_ZeroIndexedPlateIndex, uns
     if( ForcePlates == i_ZeroIndexedPlateIndex )
     {
       // this is our forceplate
-      o_rPlateID = m_LatestFrame.m_Devices[i].m_DeviceID;
+      o_rPlateID = (*m_pLatestFrame->m_Devices)[i].m_DeviceID;
       return Result::Success;
     }
     else
@@ -2914,9 +3441,9 @@ bool VClient::ForcePlateDeviceIndex( const unsigned int i_DeviceID, unsigned int
 {
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
   
-  for(unsigned int j = 0; j < m_LatestFrame.m_ForcePlates.size(); ++j )
+  for(unsigned int j = 0; j < m_pLatestFrame->m_ForcePlates->size(); ++j )
   {
-    const ViconCGStream::VForcePlateInfo & rForcePlate = m_LatestFrame.m_ForcePlates[j];
+    const ViconCGStream::VForcePlateInfo & rForcePlate = (*m_pLatestFrame->m_ForcePlates)[j];
 
     if( i_DeviceID == rForcePlate.m_DeviceID )
     {
@@ -2946,11 +3473,11 @@ Result::Enum VClient::ForcePlateSubsamples( unsigned int i_PlateID, unsigned int
 
   const ViconCGStreamType::UInt64 DevicePeriod = GetDevicePeriod( i_PlateID );
   const ViconCGStreamType::UInt64 DeviceStartTick = GetDeviceStartTick( i_PlateID );
-  const TPeriod FramePeriod = GetFramePeriod( m_LatestFrame );
+  const TPeriod FramePeriod = GetFramePeriod( *m_pLatestFrame );
 
-  for( unsigned int i = 0 ; i < m_LatestFrame.m_Forces.size() ; ++i )
+  for( unsigned int i = 0 ; i < m_pLatestFrame->m_Forces->size() ; ++i )
   {
-    const ViconCGStream::VForceFrame& rForces = m_LatestFrame.m_Forces[i];
+    const ViconCGStream::VForceFrame& rForces = (*m_pLatestFrame->m_Forces)[i];
     if( rForces.m_DeviceID == i_PlateID )
     {
       const size_t NumSamples = rForces.m_Samples.size() / 3;
@@ -2997,7 +3524,7 @@ Result::Enum ViconDataStreamSDK::Core::VClient::GetForcePlateVector( const unsig
 
   const ViconCGStreamType::UInt64 DeviceOffset = GetDeviceStartTick( i_PlateID );
 
-  const TPeriod FramePeriod = GetFramePeriod( m_LatestFrame );
+  const TPeriod FramePeriod = GetFramePeriod( *m_pLatestFrame );
 
   for( unsigned int i = 0 ; i < i_rFrameVector.size() ; ++i )
   {
@@ -3042,7 +3569,7 @@ Result::Enum VClient::GetForceVector( const unsigned int i_PlateID,
                                       const unsigned int i_ForcePlateSubsamples,
                                       std::array< double, 3 > & o_rForceVector ) const
 {
-  return GetForcePlateVector( i_PlateID, i_ForcePlateSubsamples, m_LatestFrame.m_Forces, o_rForceVector );
+  return GetForcePlateVector( i_PlateID, i_ForcePlateSubsamples, *m_pLatestFrame->m_Forces, o_rForceVector );
 }
 
 // Internal function used by local and global moment functions.
@@ -3050,7 +3577,7 @@ Result::Enum VClient::GetMomentVector( const unsigned int i_PlateID,
                                        const unsigned int i_ForcePlateSubsamples,
                                        std::array< double, 3 > & o_rMomentVector ) const
 {
-  return GetForcePlateVector( i_PlateID, i_ForcePlateSubsamples, m_LatestFrame.m_Moments, o_rMomentVector );
+  return GetForcePlateVector( i_PlateID, i_ForcePlateSubsamples, *m_pLatestFrame->m_Moments, o_rMomentVector );
 }
 
 // Internal function used by local and global CoP functions.
@@ -3058,7 +3585,7 @@ Result::Enum VClient::GetCentreOfPressure( const unsigned int i_PlateID,
                                            const unsigned int i_ForcePlateSubsamples,
                                            std::array< double, 3 > & o_rLocation ) const
 {
-  return GetForcePlateVector( i_PlateID, i_ForcePlateSubsamples, m_LatestFrame.m_CentresOfPressure, o_rLocation );
+  return GetForcePlateVector( i_PlateID, i_ForcePlateSubsamples, *m_pLatestFrame->m_CentresOfPressure, o_rLocation );
 }
 
 Result::Enum VClient::GetForceVectorAtSample( const unsigned int i_PlateID,
@@ -3142,7 +3669,7 @@ Result::Enum VClient::GetGlobalForceVectorAtSample( const unsigned int i_PlateID
 
     // Transform result to global coordinates by rotating by plate orientation.
 
-    const ViconCGStream::VForcePlateInfo & rForcePlate = m_LatestFrame.m_ForcePlates[ PlateIndex ];
+    const ViconCGStream::VForcePlateInfo & rForcePlate = (*m_pLatestFrame->m_ForcePlates)[ PlateIndex ];
 
     std::array< double, 3 * 3 > WorldRotation;
     std::copy( rForcePlate.m_WorldRotation, rForcePlate.m_WorldRotation + 9, WorldRotation.begin() );
@@ -3176,7 +3703,7 @@ Result::Enum VClient::GetGlobalMomentVectorAtSample( const unsigned int i_PlateI
       return Result::Unknown;
     }
 
-    const ViconCGStream::VForcePlateInfo & rForcePlate = m_LatestFrame.m_ForcePlates[ PlateIndex ];
+    const ViconCGStream::VForcePlateInfo & rForcePlate = (*m_pLatestFrame->m_ForcePlates)[ PlateIndex ];
 
     std::array< double, 3 * 3 > WorldRotation;
     std::copy( rForcePlate.m_WorldRotation, rForcePlate.m_WorldRotation + 9, WorldRotation.begin() );
@@ -3210,7 +3737,7 @@ Result::Enum VClient::GetGlobalCentreOfPressureAtSample( const unsigned int i_Pl
       return Result::Unknown;
     }
 
-    const ViconCGStream::VForcePlateInfo & rForcePlate = m_LatestFrame.m_ForcePlates[ PlateIndex ];
+    const ViconCGStream::VForcePlateInfo & rForcePlate = (*m_pLatestFrame->m_ForcePlates)[ PlateIndex ];
 
     std::array< double, 3 * 3 > WorldRotation;
     std::copy( rForcePlate.m_WorldRotation, rForcePlate.m_WorldRotation + 9, WorldRotation.begin() );
@@ -3283,9 +3810,9 @@ Result::Enum VClient::GetNumberOfAnalogChannels( const unsigned int i_PlateID, u
   }
 
   // now find channel information that is not
-  for( size_t j = 0 ; j < m_LatestFrame.m_Channels.size() ; ++j )
+  for( size_t j = 0 ; j < m_pLatestFrame->m_Channels->size() ; ++j )
   {
-    const ViconCGStream::VChannelInfo& rChannel = m_LatestFrame.m_Channels[j];
+    const ViconCGStream::VChannelInfo& rChannel = (*m_pLatestFrame->m_Channels)[j];
 
     if( i_PlateID == rChannel.m_DeviceID && !IsForcePlateCoreChannel( rChannel ) )
     {
@@ -3334,9 +3861,9 @@ Result::Enum VClient::GetAnalogChannelVoltageAtSample( const unsigned int i_Plat
   bool bFoundChannelID = false;
 
   // get the channel ID for the voltage channel of this plate
-  for( size_t j = 0 ; j < m_LatestFrame.m_Channels.size() ; ++j )
+  for( size_t j = 0 ; j < m_pLatestFrame->m_Channels->size() ; ++j )
   {
-    const ViconCGStream::VChannelInfo& rChannel = m_LatestFrame.m_Channels[j];
+    const ViconCGStream::VChannelInfo& rChannel = (*m_pLatestFrame->m_Channels)[j];
 
     if( i_PlateID == rChannel.m_DeviceID && !IsForcePlateCoreChannel( rChannel ) )
     {
@@ -3352,15 +3879,15 @@ Result::Enum VClient::GetAnalogChannelVoltageAtSample( const unsigned int i_Plat
     return Result::InvalidIndex;
   }
 
-  const TPeriod FramePeriod = GetFramePeriod( m_LatestFrame );
+  const TPeriod FramePeriod = GetFramePeriod( *m_pLatestFrame );
   const ViconCGStreamType::UInt64 DeviceStartTick = GetDeviceStartTick( i_PlateID );
 
   // now look through the voltage channels for this ID
   // subfactor the voltage values by "VoltageComponentsPerSample"
 
-  for( size_t i = 0 ; i < m_LatestFrame.m_Voltages.size() ; ++i )
+  for( size_t i = 0 ; i < m_pLatestFrame->m_Voltages->size() ; ++i )
   {
-    const ViconCGStream::VVoltageFrame& rVoltages = m_LatestFrame.m_Voltages[i];
+    const ViconCGStream::VVoltageFrame& rVoltages = (*m_pLatestFrame->m_Voltages)[i];
 
     if( rVoltages.m_ChannelID == ChannelID )
     {
@@ -3404,7 +3931,7 @@ Result::Enum VClient::GetEyeTrackerCount( unsigned int & o_rCount ) const
   Result::Enum GetResult = Result::Success;
   if ( InitGet( GetResult, o_rCount ) )
   {
-    o_rCount = static_cast<unsigned int>( m_LatestFrame.m_EyeTrackers.size() );
+    o_rCount = static_cast<unsigned int>( m_pLatestFrame->m_EyeTrackers->size() );
   }
   return GetResult;
 }
@@ -3419,9 +3946,9 @@ Result::Enum VClient::GetEyeTrackerID( const unsigned int i_EyeTrackerIndex, uns
     return GetResult; 
   }
 
-  if( i_EyeTrackerIndex < m_LatestFrame.m_EyeTrackers.size() )
+  if( i_EyeTrackerIndex < m_pLatestFrame->m_EyeTrackers->size() )
   {
-    o_rEyeTrackerID = m_LatestFrame.m_EyeTrackers[ i_EyeTrackerIndex ].m_DeviceID;
+    o_rEyeTrackerID = (*m_pLatestFrame->m_EyeTrackers)[ i_EyeTrackerIndex ].m_DeviceID;
     return Result::Success;
   }
 
@@ -3440,9 +3967,9 @@ Result::Enum VClient::GetEyeTrackerGlobalPosition( const unsigned int i_EyeTrack
 
   size_t EyeTrackerIndex = -1;
 
-  for( size_t i = 0; i < m_LatestFrame.m_EyeTrackers.size(); i++ )
+  for( size_t i = 0; i < m_pLatestFrame->m_EyeTrackers->size(); i++ )
   {
-    if( m_LatestFrame.m_EyeTrackers[ i ].m_DeviceID == i_EyeTrackerID )
+    if( (*m_pLatestFrame->m_EyeTrackers)[ i ].m_DeviceID == i_EyeTrackerID )
     {
       EyeTrackerIndex = i;
     }
@@ -3453,16 +3980,16 @@ Result::Enum VClient::GetEyeTrackerGlobalPosition( const unsigned int i_EyeTrack
     return Result::InvalidIndex;
   }
 
-  const ViconCGStream::VEyeTrackerInfo & rEyeTracker = m_LatestFrame.m_EyeTrackers[ EyeTrackerIndex ];
+  const ViconCGStream::VEyeTrackerInfo & rEyeTracker = (*m_pLatestFrame->m_EyeTrackers)[ EyeTrackerIndex ];
 
   // Look up the ids for the subject and segment
   unsigned int SubjectID = rEyeTracker.m_SubjectID;
   unsigned int SegmentID = rEyeTracker.m_SegmentID;
 
   // go through the frame's segment data and find its position in this frame
-  for( unsigned int i = 0; i < m_LatestFrame.m_GlobalSegments.size(); i++ )
+  for( unsigned int i = 0; i < m_pLatestFrame->m_GlobalSegments->size(); i++ )
   {
-    const ViconCGStream::VGlobalSegments& rSegments = m_LatestFrame.m_GlobalSegments[i];
+    const ViconCGStream::VGlobalSegments& rSegments = (*m_pLatestFrame->m_GlobalSegments)[i];
     if( rSegments.m_SubjectID == SubjectID )
     {
       // now look through its segments
@@ -3510,9 +4037,9 @@ Result::Enum VClient::GetEyeTrackerGlobalGazeVector( const unsigned int i_EyeTra
 
   size_t EyeTrackerIndex = -1;
 
-  for( size_t i = 0; i < m_LatestFrame.m_EyeTrackers.size(); i++ )
+  for( size_t i = 0; i < m_pLatestFrame->m_EyeTrackers->size(); i++ )
   {
-    if( m_LatestFrame.m_EyeTrackers[ i ].m_DeviceID == i_EyeTrackerID )
+    if( (*m_pLatestFrame->m_EyeTrackers)[ i ].m_DeviceID == i_EyeTrackerID )
     {
       EyeTrackerIndex = i;
     }
@@ -3523,13 +4050,13 @@ Result::Enum VClient::GetEyeTrackerGlobalGazeVector( const unsigned int i_EyeTra
     return Result::InvalidIndex;
   }
 
-  const ViconCGStream::VEyeTrackerInfo & rEyeTracker = m_LatestFrame.m_EyeTrackers[ EyeTrackerIndex ];
+  const ViconCGStream::VEyeTrackerInfo & rEyeTracker = (*m_pLatestFrame->m_EyeTrackers)[ EyeTrackerIndex ];
 
   size_t EyeTrackIndex = -1;
 
-  for( size_t i = 0; i < m_LatestFrame.m_EyeTracks.size(); i++ )
+  for( size_t i = 0; i < m_pLatestFrame->m_EyeTracks->size(); i++ )
   {
-    if( m_LatestFrame.m_EyeTracks[ i ].m_DeviceID == i_EyeTrackerID )
+    if( (*m_pLatestFrame->m_EyeTracks)[ i ].m_DeviceID == i_EyeTrackerID )
     {
       EyeTrackIndex = i;
     }
@@ -3544,16 +4071,16 @@ Result::Enum VClient::GetEyeTrackerGlobalGazeVector( const unsigned int i_EyeTra
     return Result::Success;
   }
 
-  const ViconCGStream::VEyeTrackerFrame & rEyeTrack = m_LatestFrame.m_EyeTracks[ EyeTrackIndex ];
+  const ViconCGStream::VEyeTrackerFrame & rEyeTrack = (*m_pLatestFrame->m_EyeTracks)[ EyeTrackIndex ];
 
   // Look up the ids for the subject and segment
   unsigned int SubjectID = rEyeTracker.m_SubjectID;
   unsigned int SegmentID = rEyeTracker.m_SegmentID;
 
   // go through the frame's segment data and find its position in this frame
-  for( unsigned int i = 0; i < m_LatestFrame.m_GlobalSegments.size(); i++ )
+  for( unsigned int i = 0; i < m_pLatestFrame->m_GlobalSegments->size(); i++ )
   {
-    const ViconCGStream::VGlobalSegments& rSegments = m_LatestFrame.m_GlobalSegments[i];
+    const ViconCGStream::VGlobalSegments& rSegments = (*m_pLatestFrame->m_GlobalSegments)[i];
     if( rSegments.m_SubjectID == SubjectID )
     {
       // now look through its segments
@@ -3591,9 +4118,9 @@ bool VClient::IsEyeTrackerDevice(unsigned int i_DeviceID) const
 {
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
 
-  for( unsigned int i = 0; i < m_LatestFrame.m_EyeTrackers.size(); i++ )
+  for( unsigned int i = 0; i < m_pLatestFrame->m_EyeTrackers->size(); i++ )
   {
-    if( m_LatestFrame.m_EyeTrackers[ i ].m_DeviceID == i_DeviceID )
+    if( (*m_pLatestFrame->m_EyeTrackers)[ i ].m_DeviceID == i_DeviceID )
     {
       return true;
     }
@@ -3606,33 +4133,100 @@ bool VClient::HasData() const
 {
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
   
-  return BadFrameValue != m_LatestFrame.m_Frame.m_FrameID;
+  return BadFrameValue != m_pLatestFrame->m_Frame.m_FrameID;
 }
 
-void VClient::FetchNextFrame()
+void VClient::FetchNextFrame( ViconCGStreamClientSDK::ICGClient & i_rClient, unsigned int i_TimeoutMs )
 {
-  if( !m_pClient )
-  {
-    return;
-  }
-
   std::vector< ViconCGStreamClientSDK::ICGFrameState > LoadedFrames;
 
-  ViconCGStreamClientSDK::ICGFrameState Frame;
-  if( m_pClient->WaitFrame( Frame, s_WaitFrameTimeout ) )
+  // Each frame is read into its own snapshot, so handing it over is a pointer swap and
+  // callers still holding the previous one are unaffected
+  std::shared_ptr< ViconCGStreamClientSDK::ICGFrameState > pFrame = std::make_shared< ViconCGStreamClientSDK::ICGFrameState >();
+  if( i_rClient.WaitFrame( *pFrame, i_TimeoutMs ) )
   {
-    // copy out the last frame
-    m_bNewCachedFrame = true;
-    m_CachedFrame = Frame;
+    {
+      boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
+      m_bNewCachedFrame = true;
+      m_pCachedFrame = pFrame;
+    }
 
     // Log this frame in timing information
     if( m_pTimingLog)
     { 
-      m_pTimingLog->WriteToLog(Frame.m_Frame.m_FrameID, Frame.m_Latency.m_Samples );
+      m_pTimingLog->WriteToLog(pFrame->m_Frame.m_FrameID, pFrame->m_Latency->m_Samples );
     }
   }
 } 
 
+Result::Enum VClient::GetAllMarkerGlobalTranslations( const unsigned int   i_LabeledCapacity,
+                                                            unsigned int * o_pSubjectIndices,
+                                                            unsigned int * o_pSegmentIndices,
+                                                            unsigned int * o_pMarkerIndices,
+                                                            double       * o_pTranslations,
+                                                            bool         * o_pOccluded,
+                                                            unsigned int & o_rLabeledCount,
+                                                      const unsigned int   i_UnlabeledCapacity,
+                                                            double       * o_pUnlabeledTranslations,
+                                                            unsigned int * o_pUnlabeledTrajIDs,
+                                                            unsigned int & o_rUnlabeledCount,
+                                                            unsigned int & o_rLayoutGeneration ) const
+{
+  Clear( o_rLabeledCount );
+  Clear( o_rUnlabeledCount );
+  Clear( o_rLayoutGeneration );
+
+  Result::Enum GetResult = Result::Success;
+  const std::shared_ptr< const VFrameSnapshot > pSnapshot = GetSnapshot( GetResult );
+  if ( !pSnapshot )
+  {
+    return GetResult; 
+  }
+
+  const VFrameIndex & rIndex = *pSnapshot->m_pIndex;
+  o_rLayoutGeneration = rIndex.m_SegmentHandleGeneration;
+  o_rLabeledCount = static_cast< unsigned int >( rIndex.m_IndexedMarkers.size() );
+  const unsigned int LabeledCount = std::min( i_LabeledCapacity, o_rLabeledCount );
+  for( unsigned int Slot = 0; Slot < LabeledCount; ++Slot )
+  {
+    const VFrameIndex::VIndexedMarker & rMarker = rIndex.m_IndexedMarkers[ Slot ];
+    o_pSubjectIndices[ Slot ] = rMarker.m_SubjectIndex;
+    o_pSegmentIndices[ Slot ] = rMarker.m_SegmentIndex;
+    o_pMarkerIndices[ Slot ] = rMarker.m_MarkerIndex;
+    std::fill( o_pTranslations + 3 * Slot, o_pTranslations + 3 * Slot + 3, 0.0 );
+    o_pOccluded[ Slot ] = true;
+  }
+
+  // One pass over the reconstructions, rather than one per marker
+  for( const auto & rRecon : pSnapshot->m_pFrame->m_LabeledRecons->m_LabeledRecons )
+  {
+    const ViconCGStreamType::UInt64 Key = ( static_cast< ViconCGStreamType::UInt64 >( rRecon.m_SubjectID ) << 32 ) | rRecon.m_MarkerID;
+    const auto SlotIt = rIndex.m_MarkerSlots.find( Key );
+    if( SlotIt == rIndex.m_MarkerSlots.end() || SlotIt->second >= LabeledCount || !o_pOccluded[ SlotIt->second ] )
+    {
+      continue;
+    }
+
+    double Translation[ 3 ];
+    pSnapshot->CopyAndTransformT( rRecon.m_Position, Translation );
+    std::copy( Translation, Translation + 3, o_pTranslations + 3 * SlotIt->second );
+    o_pOccluded[ SlotIt->second ] = false;
+  }
+
+  const std::vector< ViconCGStreamDetail::VUnlabeledRecons_UnlabeledRecon > & rUnlabeled = pSnapshot->m_pFrame->m_UnlabeledRecons->m_UnlabeledRecons;
+  o_rUnlabeledCount = static_cast< unsigned int >( rUnlabeled.size() );
+  const unsigned int UnlabeledCount = std::min( i_UnlabeledCapacity, o_rUnlabeledCount );
+  for( unsigned int MarkerIndex = 0; MarkerIndex < UnlabeledCount; ++MarkerIndex )
+  {
+    double Translation[ 3 ];
+    pSnapshot->CopyAndTransformT( rUnlabeled[ MarkerIndex ].m_Position, Translation );
+    std::copy( Translation, Translation + 3, o_pUnlabeledTranslations + 3 * MarkerIndex );
+    o_pUnlabeledTrajIDs[ MarkerIndex ] = rUnlabeled[ MarkerIndex ].m_TrajectoryId;
+  }
+
+  return Result::Success;
+}
+
 Result::Enum VClient::GetDeviceCount( unsigned int & o_rDeviceCount ) const
 {
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
@@ -3640,7 +4234,7 @@ Result::Enum VClient::GetDeviceCount( unsigned int & o_rDeviceCount ) const
   Result::Enum GetResult = Result::Success;
   if ( InitGet( GetResult, o_rDeviceCount ) )
   {
-    o_rDeviceCount = static_cast< unsigned int >( m_LatestFrame.m_Devices.size() );
+    o_rDeviceCount = static_cast< unsigned int >( m_pLatestFrame->m_Devices->size() );
   }
   return GetResult;
 }
@@ -3657,12 +4251,12 @@ Result::Enum VClient::GetDeviceName( const unsigned int       i_DeviceIndex,
     return GetResult; 
   }
 
-  if( i_DeviceIndex >= m_LatestFrame.m_Devices.size() )
+  if( i_DeviceIndex >= m_pLatestFrame->m_Devices->size() )
   {
     return Result::InvalidIndex;
   }
 
-  const ViconCGStream::VDeviceInfo & rDevice( m_LatestFrame.m_Devices[ i_DeviceIndex ] );
+  const ViconCGStream::VDeviceInfo & rDevice( (*m_pLatestFrame->m_Devices)[ i_DeviceIndex ] );
   o_rDeviceName = AdaptDeviceName( rDevice.m_Name, rDevice.m_DeviceID );
   if( IsForcePlateDevice( rDevice.m_DeviceID ) )
   {
@@ -3700,8 +4294,8 @@ Result::Enum VClient::GetDeviceOutputCount( const std::string  & i_rDeviceName,
   }
 
   // Iterate over the channels for this device
-  std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelIt  = m_LatestFrame.m_Channels.begin();
-  std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelEnd = m_LatestFrame.m_Channels.end();
+  std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelIt  = m_pLatestFrame->m_Channels->begin();
+  std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelEnd = m_pLatestFrame->m_Channels->end();
   for( ; ChannelIt != ChannelEnd ; ++ChannelIt )
   {
     const ViconCGStream::VChannelInfo & rChannel( *ChannelIt );
@@ -3870,8 +4464,8 @@ Result::Enum VClient::GetDeviceOutputNameComponent( const std::string  & i_rDevi
 
   // Iterate over the channels for this device
   unsigned int CurrentDeviceOutputIndex = 0;
-  std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelIt  = m_LatestFrame.m_Channels.begin();
-  const std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelEnd = m_LatestFrame.m_Channels.end();
+  std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelIt  = m_pLatestFrame->m_Channels->begin();
+  const std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelEnd = m_pLatestFrame->m_Channels->end();
   for( ; ChannelIt != ChannelEnd ; ++ChannelIt )
   {
     const ViconCGStream::VChannelInfo & rChannel( *ChannelIt );
@@ -3918,8 +4512,8 @@ Result::Enum VClient::GetDeviceOutputNameComponent( const std::string  & i_rDevi
 
           // Look for information in the extra channel information.
 
-          std::vector< ViconCGStream::VChannelInfoExtra >::const_iterator ChannelUnitIt  = m_LatestFrame.m_ChannelUnits.begin();
-          const std::vector< ViconCGStream::VChannelInfoExtra >::const_iterator ChannelUnitEnd = m_LatestFrame.m_ChannelUnits.end();
+          std::vector< ViconCGStream::VChannelInfoExtra >::const_iterator ChannelUnitIt  = m_pLatestFrame->m_ChannelUnits->begin();
+          const std::vector< ViconCGStream::VChannelInfoExtra >::const_iterator ChannelUnitEnd = m_pLatestFrame->m_ChannelUnits->end();
           for( ; ChannelUnitIt != ChannelUnitEnd ; ++ChannelUnitIt )
           {
             const ViconCGStream::VChannelInfoExtra & rChannelInfoExtra( *ChannelUnitIt );
@@ -4136,12 +4730,12 @@ Result::Enum VClient::GetDeviceOutputSubsamples( const std::string  & i_rDeviceN
 
   ViconCGStreamType::Int64 DeviceStartTick = GetDeviceStartTick( DeviceID );
 
-  const TPeriod FramePeriod = GetFramePeriod( m_LatestFrame );
+  const TPeriod FramePeriod = GetFramePeriod( *m_pLatestFrame );
 
   // Iterate over the channels for this device
   unsigned int CurrentDeviceOutputIndex = 0;
-  std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelIt  = m_LatestFrame.m_Channels.begin();
-  std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelEnd = m_LatestFrame.m_Channels.end();
+  std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelIt  = m_pLatestFrame->m_Channels->begin();
+  std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelEnd = m_pLatestFrame->m_Channels->end();
   for ( ; ChannelIt != ChannelEnd; ++ChannelIt )
   {
     const ViconCGStream::VChannelInfo & rChannel( *ChannelIt );
@@ -4176,19 +4770,19 @@ Result::Enum VClient::GetDeviceOutputSubsamples( const std::string  & i_rDeviceN
 
         if( IsForcePlateForceChannel( rChannel ) )
         {
-          o_rbOccluded = !GetSampleCount( m_LatestFrame.m_Forces, rChannel, DevicePeriod, DeviceStartTick, FramePeriod, o_rDeviceOutputSubsamples );
+          o_rbOccluded = !GetSampleCount( *m_pLatestFrame->m_Forces, rChannel, DevicePeriod, DeviceStartTick, FramePeriod, o_rDeviceOutputSubsamples );
         }
         else if( IsForcePlateMomentChannel( rChannel ) )
         {
-          o_rbOccluded = !GetSampleCount( m_LatestFrame.m_Moments, rChannel, DevicePeriod, DeviceStartTick, FramePeriod, o_rDeviceOutputSubsamples );
+          o_rbOccluded = !GetSampleCount( *m_pLatestFrame->m_Moments, rChannel, DevicePeriod, DeviceStartTick, FramePeriod, o_rDeviceOutputSubsamples );
         }
         else if( IsForcePlateCoPChannel( rChannel ) )
         {
-          o_rbOccluded = !GetSampleCount( m_LatestFrame.m_CentresOfPressure, rChannel, DevicePeriod, DeviceStartTick, FramePeriod, o_rDeviceOutputSubsamples );
+          o_rbOccluded = !GetSampleCount( *m_pLatestFrame->m_CentresOfPressure, rChannel, DevicePeriod, DeviceStartTick, FramePeriod, o_rDeviceOutputSubsamples );
         }
         else
         {
-          o_rbOccluded = !GetSampleCount( m_LatestFrame.m_Voltages, rChannel, DevicePeriod, DeviceStartTick, FramePeriod, o_rDeviceOutputSubsamples );
+          o_rbOccluded = !GetSampleCount( *m_pLatestFrame->m_Voltages, rChannel, DevicePeriod, DeviceStartTick, FramePeriod, o_rDeviceOutputSubsamples );
         }
 
         return Result::Success;
@@ -4234,12 +4828,12 @@ Result::Enum VClient::GetDeviceOutputValue( const std::string  & i_rDeviceName,
 
   ViconCGStreamType::Int64 DeviceStartTick = GetDeviceStartTick( DeviceID );
 
-  const TPeriod FramePeriod = GetFramePeriod( m_LatestFrame );
+  const TPeriod FramePeriod = GetFramePeriod( *m_pLatestFrame );
 
   // Try and find the channel which contains this device output
   unsigned int CurrentDeviceOutputIndex = 0;
-  std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelIt  = m_LatestFrame.m_Channels.begin();
-  std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelEnd = m_LatestFrame.m_Channels.end();
+  std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelIt  = m_pLatestFrame->m_Channels->begin();
+  std::vector< ViconCGStream::VChannelInfo >::const_iterator ChannelEnd = m_pLatestFrame->m_Channels->end();
   for( ; ChannelIt != ChannelEnd ; ++ChannelIt )
   {
     const ViconCGStream::VChannelInfo & rChannel( *ChannelIt );
@@ -4275,7 +4869,7 @@ Result::Enum VClient::GetDeviceOutputValue( const std::string  & i_rDeviceName,
           }
 
           double Samples[ 3 ];
-          if( !GetSamples( m_LatestFrame.m_Forces,
+          if( !GetSamples( *m_pLatestFrame->m_Forces,
                            rChannel,
                            i_Subsample,
                            DevicePeriod,
@@ -4305,7 +4899,7 @@ Result::Enum VClient::GetDeviceOutputValue( const std::string  & i_rDeviceName,
           }
 
           double Samples[ 3 ];
-          if( !GetSamples( m_LatestFrame.m_Moments,
+          if( !GetSamples( *m_pLatestFrame->m_Moments,
                            rChannel,
                            i_Subsample,
                            DevicePeriod,
@@ -4335,7 +4929,7 @@ Result::Enum VClient::GetDeviceOutputValue( const std::string  & i_rDeviceName,
           }
 
           double Samples[ 3 ];
-          if( !GetSamples( m_LatestFrame.m_CentresOfPressure,
+          if( !GetSamples( *m_pLatestFrame->m_CentresOfPressure,
                            rChannel,
                            i_Subsample,
                            DevicePeriod,
@@ -4360,7 +4954,7 @@ Result::Enum VClient::GetDeviceOutputValue( const std::string  & i_rDeviceName,
         // Voltage
         {
           std::vector< double > Samples;
-          if( !GetSamples( m_LatestFrame.m_Voltages,
+          if( !GetSamples( *m_pLatestFrame->m_Voltages,
                            rChannel,
                            i_Subsample,
                            DevicePeriod,
@@ -4404,7 +4998,7 @@ Result::Enum VClient::GetCameraCount( unsigned int & o_rCount ) const
   Result::Enum GetResult = Result::Success;
   if ( InitGet( GetResult, o_rCount ) )
   {
-    o_rCount = static_cast< unsigned int >( m_LatestFrame.m_Cameras.size() );
+    o_rCount = static_cast< unsigned int >( m_pLatestFrame->m_Cameras->size() );
   }
   return GetResult;
 }
@@ -4419,12 +5013,12 @@ Result::Enum VClient::GetCameraName( const unsigned int i_CameraIndex, std::stri
     return GetResult; 
   }
 
-  if( i_CameraIndex >= m_LatestFrame.m_Cameras.size() )
+  if( i_CameraIndex >= m_pLatestFrame->m_Cameras->size() )
   {
     return Result::InvalidIndex;
   }
 
-  const ViconCGStream::VCameraInfo & rCamera( m_LatestFrame.m_Cameras[ i_CameraIndex ] );
+  const ViconCGStream::VCameraInfo & rCamera( (*m_pLatestFrame->m_Cameras)[ i_CameraIndex ] );
   o_rCameraName = AdaptCameraName( rCamera.m_Name, rCamera.m_DisplayType, rCamera.m_CameraID );
 
   return GetResult;
@@ -4436,12 +5030,12 @@ const ViconCGStream::VCameraInfo * VClient::GetCamera( const std::string & i_rCa
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
 
   const auto rCameraIt = 
-    std::find_if( m_LatestFrame.m_Cameras.begin(), m_LatestFrame.m_Cameras.end(),
+    std::find_if( m_pLatestFrame->m_Cameras->begin(), m_pLatestFrame->m_Cameras->end(),
       [&i_rCameraName]( const ViconCGStream::VCameraInfo & rCamera )
         { return AdaptCameraName( rCamera.m_Name, rCamera.m_DisplayType, rCamera.m_CameraID ) == i_rCameraName; }
     );
 
-  if( rCameraIt != m_LatestFrame.m_Cameras.end() )
+  if( rCameraIt != m_pLatestFrame->m_Cameras->end() )
   {
     o_rResult = Result::Success;
     return &(*rCameraIt);
@@ -4456,12 +5050,12 @@ const ViconCGStream::VCameraSensorInfo * VClient::GetCameraSensorInfo(unsigned i
   boost::recursive_mutex::scoped_lock Lock(m_FrameMutex);
 
   const auto rCameraIt =
-    std::find_if(m_LatestFrame.m_CamerasSensorInfo.begin(), m_LatestFrame.m_CamerasSensorInfo.end(),
+    std::find_if(m_pLatestFrame->m_CamerasSensorInfo->begin(), m_pLatestFrame->m_CamerasSensorInfo->end(),
       [&i_CameraID ](const ViconCGStream::VCameraSensorInfo & rCameraSensorInfo )
   { return rCameraSensorInfo.m_CameraID == i_CameraID; }
   );
 
-  if (rCameraIt != m_LatestFrame.m_CamerasSensorInfo.end())
+  if (rCameraIt != m_pLatestFrame->m_CamerasSensorInfo->end())
   {
     o_rResult = Result::Success;
     return &(*rCameraIt);
@@ -4909,14 +5503,16 @@ Result::Enum VClient::AddToSubjectFilter(const std::string & i_rSubjectName)
   return Result;
 }
 
-ViconCGStreamClientSDK::ICGFrameState& VClient::LatestFrame()
+std::shared_ptr< const ViconCGStreamClientSDK::ICGFrameState > VClient::LatestFrame() const
 { 
-  return m_LatestFrame; 
+  boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
+  return m_pLatestFrame; 
 }
 
-ViconCGStreamClientSDK::ICGFrameState& VClient::CachedFrame()
+std::shared_ptr< const ViconCGStreamClientSDK::ICGFrameState > VClient::CachedFrame() const
 { 
-  return m_CachedFrame; 
+  boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
+  return m_pCachedFrame; 
 }
 
 Result::Enum VClient::SetTimingLog(const std::string & i_rClientLog, const std::string & i_rCGStreamLog )
@@ -4980,127 +5576,35 @@ void VClient::CopyAndTransformT( const float i_Translation[3], double( &io_Trans
 
 void VClient::CopyAndTransformT( const double i_Translation[3], double( &io_Translation )[3] ) const
 {
-  if (m_pAxisMapping)
-  {
-
-    Direction::Enum RequestedX, RequestedY, RequestedZ;
-    m_pAxisMapping->GetAxisMapping(RequestedX, RequestedY, RequestedZ);
-
-    Direction::Enum ServerX, ServerY, ServerZ;
-
-    AxisMappingResult::Enum Error = AxisMappingResult::Success;
-    std::shared_ptr< VAxisMapping > pServerAxisMapping;
-
-    // If we've got information about our stream type from the server
-    if (m_CachedFrame.m_ApplicationInfo && m_CachedFrame.m_ApplicationInfo.get().m_AxisOrientation == ViconCGStream::VApplicationInfo::EYUp)
-    {
-      ServerX = Direction::Forward;
-      ServerY = Direction::Up;
-      ServerZ = Direction::Right;
-
-      // Only create the server axis mapping if we need to modify the data from the server
-      pServerAxisMapping = VAxisMapping::Create(Error, Direction::Forward, Direction::Up, Direction::Right);
-    }
-    else
-    {
-      // We either know it's Z-up, or we assume it's Z-up due to lack of contrary information.
-      ServerX = Direction::Forward;
-      ServerY = Direction::Left;
-      ServerZ = Direction::Up;
-    }
-
-    // We will avoid the mapping in favour of a pure copy if the input and requested output are the same. 
-    if (RequestedX == ServerX && RequestedY == ServerY && RequestedZ == ServerZ)
-    {
-      std::copy(i_Translation, i_Translation + 3, io_Translation);
-    }
-    else
-    {
-      if (pServerAxisMapping && Error == AxisMappingResult::Success)
-      {
-        double Q[9];
-        pServerAxisMapping->GetTransformationMatrix(Q);
-        m_pAxisMapping->CopyAndTransformT(i_Translation, Q, io_Translation);
-      }
-      else
-      {
-        // We don't need to do a server axis mapping
-        m_pAxisMapping->CopyAndTransformT(i_Translation, io_Translation);
-      }
-    }
-  }
-  else
-  {
-    // Just do a pure copy if there's no axis mapping at all.
-    std::copy( i_Translation, i_Translation + 3, io_Translation );
-  }
+  TransformT( m_pAxisMapping.get(), IsServerYUp(), i_Translation, io_Translation );
 }
 
 void VClient::CopyAndTransformR( const double i_Rotation[ 9 ], double ( & io_Rotation )[ 9 ] ) const
 {
-  if (m_pAxisMapping)
-  {
-
-    Direction::Enum RequestedX, RequestedY, RequestedZ;
-    m_pAxisMapping->GetAxisMapping(RequestedX, RequestedY, RequestedZ);
-
-    Direction::Enum ServerX, ServerY, ServerZ;
-
-    AxisMappingResult::Enum Error = AxisMappingResult::Success;
-    std::shared_ptr< VAxisMapping > pServerAxisMapping;
+  TransformR( m_pAxisMapping.get(), IsServerYUp(), i_Rotation, io_Rotation );
+}
 
-    // If we've got information about our stream type from the server
-    if (m_CachedFrame.m_ApplicationInfo && m_CachedFrame.m_ApplicationInfo.get().m_AxisOrientation == ViconCGStream::VApplicationInfo::EYUp)
-    {
-      ServerX = Direction::Forward;
-      ServerY = Direction::Up;
-      ServerZ = Direction::Right;
+bool VClient::IsServerYUp() const
+{
+  return m_pCachedFrame->m_ApplicationInfo && m_pCachedFrame->m_ApplicationInfo.get().m_AxisOrientation == ViconCGStream::VApplicationInfo::EYUp;
+}
 
-      // Only create the server axis mapping if we need to modify the data from the server
-      pServerAxisMapping = VAxisMapping::Create(Error, Direction::Forward, Direction::Up, Direction::Right);
-    }
-    else
-    {
-      // We either know it's Z-up, or we assume it's Z-up due to lack of contrary information.
-      ServerX = Direction::Forward;
-      ServerY = Direction::Left;
-      ServerZ = Direction::Up;
-    }
+void VClient::VFrameSnapshot::CopyAndTransformT( const double i_Translation[ 3 ], double ( & io_Translation )[ 3 ] ) const
+{
+  TransformT( m_pAxisMapping.get(), m_bServerYUp, i_Translation, io_Translation );
+}
 
-    // We will avoid the mapping in favour of a pure copy if the input and requested output are the same. 
-    if (RequestedX == ServerX && RequestedY == ServerY && RequestedZ == ServerZ)
-    {
-      std::copy(i_Rotation, i_Rotation + 9, io_Rotation);
-    }
-    else
-    {
-      if (pServerAxisMapping && Error == AxisMappingResult::Success)
-      {
-        double Q[9];
-        pServerAxisMapping->GetTransformationMatrix(Q);
-        m_pAxisMapping->CopyAndTransformR(i_Rotation, Q, io_Rotation);
-      }
-      else
-      {
-        // We don't need to do a server axis mapping
-        m_pAxisMapping->CopyAndTransformR(i_Rotation, io_Rotation);
-      }
-    }
-  }
-  else
-  {
-    // Just do a pure copy if there's no axis mapping at all.
-    std::copy(i_Rotation, i_Rotation + 9, io_Rotation);
-  }
-  
+void VClient::VFrameSnapshot::CopyAndTransformR( const double i_Rotation[ 9 ], double ( & io_Rotation )[ 9 ] ) const
+{
+  TransformR( m_pAxisMapping.get(), m_bServerYUp, i_Rotation, io_Rotation );
 }
 
 ViconCGStreamType::UInt64 VClient::GetDevicePeriod( const unsigned int i_DeviceID ) const
 {
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
 
-  std::vector< ViconCGStream::VDeviceInfo >::const_iterator It  = m_LatestFrame.m_Devices.begin();
-  std::vector< ViconCGStream::VDeviceInfo >::const_iterator End = m_LatestFrame.m_Devices.end();
+  std::vector< ViconCGStream::VDeviceInfo >::const_iterator It  = m_pLatestFrame->m_Devices->begin();
+  std::vector< ViconCGStream::VDeviceInfo >::const_iterator End = m_pLatestFrame->m_Devices->end();
   for( ; It != End ; ++It )
   {
     const ViconCGStream::VDeviceInfo & rDevice( *It );
@@ -5116,8 +5620,8 @@ ViconCGStreamType::UInt64 VClient::GetDeviceStartTick( const unsigned int i_Devi
 {
   boost::recursive_mutex::scoped_lock Lock( m_FrameMutex );
 
-  std::vector< ViconCGStream::VDeviceInfoExtra >::const_iterator It  = m_LatestFrame.m_DevicesExtra.begin();
-  std::vector< ViconCGStream::VDeviceInfoExtra >::const_iterator End = m_LatestFrame.m_DevicesExtra.end();
+  std::vector< ViconCGStream::VDeviceInfoExtra >::const_iterator It  = m_pLatestFrame->m_DevicesExtra->begin();
+  std::vector< ViconCGStream::VDeviceInfoExtra >::const_iterator End = m_pLatestFrame->m_DevicesExtra->end();
   for( ; It != End ; ++It )
   {
     const ViconCGStream::VDeviceInfoExtra & rDevice( *It );
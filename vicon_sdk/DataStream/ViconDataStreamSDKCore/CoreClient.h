@@ -31,8 +31,11 @@
 #include <ViconDataStreamSDKCoreUtils/ClientUtils.h>
 #include <ViconDataStreamSDKCoreUtils/Constants.h>
 
+#include <functional>
 #include <memory>
 #include <array>
+#include <map>
+#include <unordered_map>
 #include <boost/thread/thread.hpp>
 #include <boost/thread/recursive_mutex.hpp>
 #include <ViconCGStreamClientSDK/ICGClient.h>
@@ -86,7 +89,42 @@ public:
   // Control how many frames are buffered by the client (default is one)
   void SetBufferSize( unsigned int i_MaxFrames );
 
+  // Choose which frame is discarded when the buffer is full (default is the oldest)
+  void SetBufferDropPolicy( BufferDropPolicy::Enum i_DropPolicy );
+
+  // Defer decoding of bulk frame data until a frame is fetched (default is off)
+  void SetLazyDecoding( bool i_bLazy );
+
+  // Tune the multicast receive path; applies to subsequent calls to ConnectToMulticast
+  void SetMulticastReceiveOptions( unsigned int i_SocketBufferSize, unsigned int i_BatchSize, unsigned int i_SpinMicroseconds );
+
+  // Service connections from a shared pool of threads rather than one thread each (default is zero, a thread each);
+  // applies to subsequent calls to Connect and ConnectToMulticast
+  void SetExecutorThreads( unsigned int i_ThreadCount );
+
+  // Receive counters. The multicast counters are zero unless receiving multicast data;
+  // the buffer counters give the frames discarded from the client buffer before being fetched and its deepest fill.
+  Result::Enum GetReceiveStats( VMulticastReceiveStats & o_rMulticastStats, ViconCGStreamClientSDK::VFrameQueueStats & o_rBufferStats ) const;
+
+  // Per-connection counters when connected to several hosts at once, in the order the hosts were given
+  Result::Enum GetLinkStats( std::vector< ViconCGStreamClientSDK::VLinkStats > & o_rStats ) const;
+
   Result::Enum GetFrame();
+
+  // As GetFrame, but blocks for at most i_TimeoutMs waiting for the frame to arrive.
+  Result::Enum WaitForFrame( unsigned int i_TimeoutMs );
+
+  // Called with the frame number whenever a new frame is received. Runs on the network thread.
+  void SetFrameCallback( std::function< void( unsigned int ) > i_Callback );
+
+  // Frame getters. Each call reads a single frame: the one handed over by the last GetFrame or WaitForFrame to
+  // complete. Two calls see the same frame only if no GetFrame or WaitForFrame completes between them. That holds
+  // when frames are fetched on the thread making the calls. If another thread fetches frames, read everything
+  // needed from one frame with a single bulk call (GetAllSegmentGlobalPoses, GetAllMarkerGlobalTranslations).
+  // Only the frame number, latencies, subject count and names, segment poses by handle and the bulk calls read
+  // the published snapshot without locking. The rest take the frame lock, which they share with the hand-over,
+  // so they block while a frame is being handed over rather than seeing the previous one.
+
   Result::Enum GetFrameNumber( unsigned int & o_rFrameNumber ) const;
   Result::Enum GetFrameRate( double & o_rFrameRateInHz ) const;
 
@@ -106,6 +144,7 @@ public:
   Result::Enum GetLatencySampleCount( unsigned int & o_rSampleCount ) const;
   Result::Enum GetLatencySampleName( const unsigned int i_SampleIndex, std::string & o_rSampleName ) const;
   Result::Enum GetLatencySampleValue( const std::string & i_rSampleName, double & o_rSampleValue ) const;
+  Result::Enum GetLatencySamples( std::map< std::string, double > & o_rSamples ) const;
 
   // Get native hardware frame (for debugging purposes)
   Result::Enum GetHardwareFrameNumber( unsigned int & o_rFrameNumber ) const;
@@ -194,6 +233,20 @@ public:
   Result::Enum GetSegmentGlobalRotationQuaternion(const std::string& i_rSubjectName, const std::string& i_rSegmentName, double (&o_rFourVector)[4], bool& o_rbOccluded ) const;
   Result::Enum GetSegmentGlobalRotationEulerXYZ(const std::string& i_rSubjectName, const std::string& i_rSegmentName, double (&o_rThreeVector)[3], bool& o_rbOccludedFlag) const;
 
+  // A segment handle identifies a segment without a name search. It remains valid until the subject list changes,
+  // after which calls using it return InvalidIndex and a new handle must be fetched.
+  Result::Enum GetSegmentHandle( const std::string& i_rSubjectName, const std::string& i_rSegmentName, ViconCGStreamType::UInt64 & o_rHandle ) const;
+  Result::Enum GetSegmentGlobalPose( const ViconCGStreamType::UInt64 i_Handle, double (&o_rTranslation)[3], double (&o_rRotation)[4], bool& o_rbOccluded ) const;
+
+  // Copy the global pose of every segment, in handle order, from a single frame. Writes at most i_Capacity entries;
+  // translations are 3 and rotations (quaternions) 4 doubles per entry. o_rSegmentCount is the number of segments available.
+  Result::Enum GetAllSegmentGlobalPoses( const unsigned int i_Capacity,
+                                         ViconCGStreamType::UInt64 * o_pHandles,
+                                         double * o_pTranslations,
+                                         double * o_pRotations,
+                                         bool * o_pOccluded,
+                                         unsigned int & o_rSegmentCount ) const;
+
   Result::Enum GetSegmentLocalTranslation(const std::string& i_rSubjectName, const std::string& i_rSegmentName, double (&o_pThreeVector)[3], bool& o_rbOccludedFlag) const;
   Result::Enum GetSegmentLocalRotationHelical(const std::string& i_rSubjectName, const std::string& i_rSegmentName, double (&o_pThreeVector)[3], bool& o_rbOccludedFlag) const;
   Result::Enum GetSegmentLocalRotationMatrix( const std::string & i_rSubjectName, const std::string & i_rSegmentName, double (& o_rRotation)[9], bool & o_rbOccluded ) const;
@@ -218,6 +271,24 @@ public:
                                                         double( &o_rTranslation )[3],
                                                         unsigned int & o_rTrajID ) const;
 
+  // Copy every subject marker and every unlabeled marker from a single frame. Subject markers are reported in
+  // subject and marker index order as ( subject, parent segment, marker ) indices, occluded if not reconstructed;
+  // unlabeled translations are 3 doubles per entry. Writes at most the given capacities; the counts are the numbers available.
+  // The indices, and the names they refer to, stay the same for as long as o_rLayoutGeneration does.
+  static const unsigned int NoParentSegment = 0xFFFFFFFF;
+  Result::Enum GetAllMarkerGlobalTranslations( const unsigned int i_LabeledCapacity,
+                                               unsigned int * o_pSubjectIndices,
+                                               unsigned int * o_pSegmentIndices,
+                                               unsigned int * o_pMarkerIndices,
+                                               double * o_pTranslations,
+                                               bool * o_pOccluded,
+                                               unsigned int & o_rLabeledCount,
+                                               const unsigned int i_UnlabeledCapacity,
+                                               double * o_pUnlabeledTranslations,
+                                               unsigned int * o_pUnlabeledTrajIDs,
+                                               unsigned int & o_rUnlabeledCount,
+                                               unsigned int & o_rLayoutGeneration ) const;
+
   Result::Enum GetDeviceCount( unsigned int            & o_rDeviceCount ) const;
 
   // Empty device names are automatically assigned a name 'Unnamed Device N' where N is a 1 based device number.
@@ -366,8 +437,9 @@ public:
   Result::Enum ClearSubjectFilter();
   Result::Enum AddToSubjectFilter(const std::string & i_rSubjectName);
   
-  ViconCGStreamClientSDK::ICGFrameState& LatestFrame();
-  ViconCGStreamClientSDK::ICGFrameState& CachedFrame();
+  // Frames are not modified once returned, and may be kept for as long as required
+  std::shared_ptr< const ViconCGStreamClientSDK::ICGFrameState > LatestFrame() const;
+  std::shared_ptr< const ViconCGStreamClientSDK::ICGFrameState > CachedFrame() const;
 
   Result::Enum SetTimingLog(const std::string & i_rClientLog, const std::string & i_rCGStreamLog );
 
@@ -398,6 +470,10 @@ private:
   Result::Enum GetMarkerID( const ViconCGStream::VSubjectInfo & i_rSubjectInfo, const std::string& i_rMarkerName, unsigned int& o_rMarkerID ) const;
   Result::Enum GetSegmentID( const ViconCGStream::VSubjectInfo & i_rSubjectInfo, const std::string& i_rSegmentName, unsigned int& o_rSegmentID ) const;
 
+  void BuildNameIndex();
+  const ViconCGStreamDetail::VGlobalSegments_Segment * FindGlobalSegment( const unsigned int i_SubjectID, const unsigned int i_SegmentID ) const;
+  const ViconCGStreamDetail::VLocalSegments_Segment * FindLocalSegment( const unsigned int i_SubjectID, const unsigned int i_SegmentID ) const;
+
   Result::Enum CalculateGlobalsFromLocals();
   Result::Enum CalculateSegmentGlobalFromLocal( const std::string & i_rSubjectName,
                                                 const std::string & i_rSegmentName,
@@ -434,11 +510,12 @@ private:
 
   bool HasData() const;
 
-  void FetchNextFrame();
+  void FetchNextFrame( ViconCGStreamClientSDK::ICGClient & i_rClient, unsigned int i_TimeoutMs );
 
   void CopyAndTransformT( const float i_Translation[3], double( &io_Translation )[3] ) const;
   void CopyAndTransformT( const double i_Translation[ 3 ], double ( & io_Translation )[ 3 ] ) const;
   void CopyAndTransformR( const double i_Rotation[ 9 ], double ( & io_Rotation )[ 9 ] ) const;
+  bool IsServerYUp() const;
 
   ViconCGStreamType::UInt64 GetDevicePeriod( const unsigned int i_DeviceID ) const;
   ViconCGStreamType::UInt64 GetDeviceStartTick( const unsigned int i_DeviceID ) const;
@@ -449,12 +526,74 @@ private:
 
   bool m_bPreFetch;
 
-  ViconCGStreamClientSDK::ICGFrameState m_LatestFrame;
-  ViconCGStreamClientSDK::ICGFrameState m_CachedFrame;
-  bool                                  m_bNewCachedFrame;
+  // Each frame is a separate snapshot; a new frame replaces the pointer rather than overwriting the old frame
+  std::shared_ptr< ViconCGStreamClientSDK::ICGFrameState > m_pLatestFrame;
+  std::shared_ptr< ViconCGStreamClientSDK::ICGFrameState > m_pCachedFrame;
+  bool                                                     m_bNewCachedFrame;
 
   mutable boost::recursive_mutex m_FrameMutex;
 
+  // Name lookups for m_pLatestFrame. A new index is built only when the static objects change, and an index is
+  // never modified once built, so snapshots can share it.
+  class VFrameIndex
+  {
+  public:
+    class VSubjectNameIndex
+    {
+    public:
+      unsigned int m_SubjectIndex;
+      std::unordered_map< std::string, unsigned int > m_Segments; // index into m_IndexedSegments
+      std::unordered_map< std::string, unsigned int > m_MarkerIDs;
+    };
+    class VIndexedMarker
+    {
+    public:
+      unsigned int m_SubjectIndex;
+      unsigned int m_SegmentIndex;
+      unsigned int m_MarkerIndex;
+    };
+
+    VFrameIndex() : m_SegmentHandleGeneration( 0 ) {}
+
+    std::shared_ptr< const VStaticObjects >                      m_pStaticObjects;
+    std::vector< std::pair< unsigned int, unsigned int > >       m_IndexedSegments; // ( subject id, segment id )
+    unsigned int                                                 m_SegmentHandleGeneration;
+    std::vector< VIndexedMarker >                                m_IndexedMarkers;
+    std::unordered_map< ViconCGStreamType::UInt64, unsigned int > m_MarkerSlots; // ( subject id, marker id ) -> index into m_IndexedMarkers
+    std::unordered_map< std::string, unsigned int >              m_SubjectNameIndex;
+    std::unordered_map< unsigned int, VSubjectNameIndex >        m_SubjectIDIndex;
+    std::unordered_map< std::string, unsigned int >              m_DeviceNameIndex;
+  };
+  std::shared_ptr< const VFrameIndex > m_pFrameIndex;
+
+  // Where each ( subject, segment ) was found in the last frame; checked before use as the layout may change
+  typedef std::pair< unsigned int, unsigned int > TSegmentLocation;
+  mutable std::unordered_map< ViconCGStreamType::UInt64, TSegmentLocation > m_GlobalSegmentLocations;
+  mutable std::unordered_map< ViconCGStreamType::UInt64, TSegmentLocation > m_LocalSegmentLocations;
+
+  // Everything needed to read one frame, published by WaitForFrame once the frame is complete. Readers take a
+  // reference with std::atomic_load and need no lock; the writer replaces it with std::atomic_store, and a
+  // snapshot is freed when its last reader lets go of it. Only the getters listed with GetFrame above read through
+  // it; it is published inside the same lock as m_pLatestFrame, so outside a hand-over both give the same frame.
+  class VFrameSnapshot
+  {
+  public:
+    std::shared_ptr< const ViconCGStreamClientSDK::ICGFrameState > m_pFrame;
+    std::shared_ptr< const VFrameIndex >                           m_pIndex;
+    std::shared_ptr< VAxisMapping >                                m_pAxisMapping;
+    bool                                                           m_bServerYUp;
+
+    // Each of m_pIndex->m_IndexedSegments in m_pFrame, or null if absent from this frame
+    std::vector< const ViconCGStreamDetail::VGlobalSegments_Segment * > m_GlobalSegments;
+
+    void CopyAndTransformT( const double i_Translation[ 3 ], double ( & io_Translation )[ 3 ] ) const;
+    void CopyAndTransformR( const double i_Rotation[ 9 ], double ( & io_Rotation )[ 9 ] ) const;
+  };
+  std::shared_ptr< const VFrameSnapshot > m_pSnapshot;
+
+  void PublishSnapshot();
+  std::shared_ptr< const VFrameSnapshot > GetSnapshot( Result::Enum & o_rResult ) const;
+
   // What data is being requested
   bool m_bSegmentDataEnabled;
   bool m_bLightweightSegmentDataEnabled;
@@ -482,6 +621,17 @@ private:
 
   unsigned int m_BufferSize;
 
+  BufferDropPolicy::Enum m_BufferDropPolicy;
+
+  bool m_bLazyDecoding;
+
+  VMulticastReceiveOptions m_MulticastReceiveOptions;
+
+  unsigned int m_ExecutorThreads;
+
+  // New frame notification; kept here so that it can be set before the client is connected.
+  std::function< void( unsigned int ) > m_FrameCallback;
+
   // Timing log for this client
   std::shared_ptr< VClientTimingLog > m_pTimingLog;
 
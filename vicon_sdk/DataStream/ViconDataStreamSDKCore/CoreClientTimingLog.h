@@ -39,7 +39,7 @@
 #include <ViconCGStreamClientSDK/CGClient.h>
 #include <ViconCGStreamClientSDK/ICGFrameState.h>
 
-class VCGStreamPostalService;
+class VTimingTraceWriter;
 
 
 namespace ViconDataStreamSDK
@@ -52,15 +52,6 @@ namespace Core
 class VClientTimingLog
 {
 
-public:
-  enum EHeadingComparison
-  {
-    ESame,     /// The heading items are the same
-    ESubset,   /// Headings2 is completely contained within headings1
-    ESuperset, /// Headings1 is completely contained within headings2
-    EDifferent /// The items in the 2 heading vectors are different, or in a different order
-  };
-
 public:
 
   VClientTimingLog();
@@ -70,30 +61,11 @@ public:
   void WriteToLog( const unsigned int i_FrameNumber, const std::vector< ViconCGStreamDetail::VLatencyInfo_Sample >& i_rLatencies );
   void CloseLog();
 
-  EHeadingComparison CompareHeadings( const std::vector< std::string >& i_rHeadings1, const std::vector< std::string >& i_rHeadings2 ) const;
-  std::vector< std::string > LogHeadings( const std::vector< ViconCGStreamDetail::VLatencyInfo_Sample >& i_rSamples ) const;
-  void LogLatencies( std::ostream& i_rStream, const std::vector< std::string >& i_rHeadings, const std::vector< ViconCGStreamDetail::VLatencyInfo_Sample >& i_rLatencies ) const;
-
-protected:
-
-  void LogTimingFunction( const unsigned int i_FrameNumber, const double i_ReceiptTime, const std::vector< ViconCGStreamDetail::VLatencyInfo_Sample >& i_rLatencies );
-  EHeadingComparison CompareHeadings( const std::vector< std::string >& i_rHeadings1, const std::vector< std::string >& i_rHeadings2, const EHeadingComparison i_SubsetType ) const;
-
 private:
 
-  std::shared_ptr< VCGStreamPostalService > m_pPostalService;
+  // Written from the frame thread without locking; replaced under m_LogMutex
+  std::shared_ptr< VTimingTraceWriter > m_pLog;
   boost::mutex m_LogMutex;
-  std::ofstream m_Log;
-  
-  struct LogCacheItem
-  {
-    unsigned int m_FrameNumber;
-    double m_ReceiptTime;
-    std::vector< ViconCGStreamDetail::VLatencyInfo_Sample > m_Latencies;
-  };
-
-  std::deque< LogCacheItem > m_PreLoggedItems;
-  std::vector< std::string > m_LogHeadings;
 };
 
 
@@ -0,0 +1,226 @@
+
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+#include "OutputScheduler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+#if defined( __linux__ )
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace ViconDataStreamSDK
+{
+namespace Core
+{
+
+VOutputScheduler::VOutputScheduler()
+: m_FrameRate( 0 )
+, m_Frame( 0 )
+, m_Priority( 0 )
+, m_Cpu( -1 )
+, m_FrameCount( 0 )
+, m_MissedFrames( 0 )
+, m_TotalJitterNs( 0 )
+, m_MaximumJitterNs( 0 )
+, m_bRealTime( false )
+{
+  m_Histogram.fill( 0 );
+}
+
+bool VOutputScheduler::ThreadOptionsSupported()
+{
+#if defined( __linux__ )
+  return true;
+#else
+  return false;
+#endif
+}
+
+void VOutputScheduler::SetThreadOptions( unsigned int i_Priority, int i_Cpu )
+{
+  boost::mutex::scoped_lock Lock( m_Mutex );
+  m_Priority = i_Priority;
+  m_Cpu = i_Cpu;
+}
+
+void VOutputScheduler::Start( double i_FrameRate )
+{
+  const bool bRealTime = ApplyThreadOptions();
+
+  boost::mutex::scoped_lock Lock( m_Mutex );
+  m_Histogram.fill( 0 );
+  m_FrameCount = 0;
+  m_MissedFrames = 0;
+  m_TotalJitterNs = 0;
+  m_MaximumJitterNs = 0;
+  m_bRealTime = bRealTime;
+
+  m_FrameRate = i_FrameRate;
+  m_Frame = 0;
+  m_Start = Clock::now();
+}
+
+VOutputScheduler::Clock::time_point VOutputScheduler::WakeTime( std::uint64_t i_Frame ) const
+{
+  return m_Start + std::chrono::nanoseconds( static_cast< std::int64_t >( std::llround( static_cast< double >( i_Frame ) * 1.0e9 / m_FrameRate ) ) );
+}
+
+void VOutputScheduler::WaitForNextFrame()
+{
+  const Clock::time_point Wake = WakeTime( ++m_Frame );
+  std::this_thread::sleep_until( Wake );
+
+  const Clock::time_point Now = Clock::now();
+  const std::int64_t JitterNs = std::max< std::int64_t >( std::chrono::duration_cast< std::chrono::nanoseconds >( Now - Wake ).count(), 0 );
+
+  // Skip any frames whose time has already passed, rather than bunching them up
+  std::uint64_t Missed = 0;
+  while( WakeTime( m_Frame + 1 ) <= Now )
+  {
+    ++m_Frame;
+    ++Missed;
+  }
+
+  boost::mutex::scoped_lock Lock( m_Mutex );
+  ++m_Histogram[ Bucket( JitterNs ) ];
+  ++m_FrameCount;
+  m_MissedFrames += Missed;
+  m_TotalJitterNs += static_cast< double >( JitterNs );
+  m_MaximumJitterNs = std::max( m_MaximumJitterNs, JitterNs );
+}
+
+VOutputJitter VOutputScheduler::Jitter() const
+{
+  boost::mutex::scoped_lock Lock( m_Mutex );
+
+  VOutputJitter Jitter;
+  Jitter.m_FrameCount = m_FrameCount;
+  Jitter.m_MissedFrames = m_MissedFrames;
+  Jitter.m_bRealTime = m_bRealTime;
+  if( m_FrameCount == 0 )
+  {
+    return Jitter;
+  }
+
+  Jitter.m_Mean = m_TotalJitterNs / static_cast< double >( m_FrameCount ) / 1.0e6;
+  Jitter.m_Maximum = static_cast< double >( m_MaximumJitterNs ) / 1.0e6;
+
+  // Each percentile is reported as the upper limit of the bucket it falls in, but no more than the maximum
+  const std::array< double, 4 > Fractions = { 0.5, 0.9, 0.99, 0.999 };
+  const std::array< double *, 4 > Outputs = { &Jitter.m_Median, &Jitter.m_Percentile90, &Jitter.m_Percentile99, &Jitter.m_Percentile999 };
+
+  std::uint64_t Count = 0;
+  std::size_t Percentile = 0;
+  for( std::size_t Index = 0; Index < s_BucketCount && Percentile < Fractions.size(); ++Index )
+  {
+    Count += m_Histogram[ Index ];
+    while( Percentile < Fractions.size() && static_cast< double >( Count ) >= Fractions[ Percentile ] * static_cast< double >( m_FrameCount ) )
+    {
+      *Outputs[ Percentile++ ] = std::min( BucketLimit( Index ), Jitter.m_Maximum );
+    }
+  }
+
+  return Jitter;
+}
+
+bool VOutputScheduler::ApplyThreadOptions() const
+{
+  unsigned int Priority;
+  int Cpu;
+  {
+    boost::mutex::scoped_lock Lock( m_Mutex );
+    Priority = m_Priority;
+    Cpu = m_Cpu;
+  }
+
+  if( Priority == 0 && Cpu < 0 )
+  {
+    return false;
+  }
+
+#if defined( __linux__ )
+  bool bApplied = true;
+  if( Priority > 0 )
+  {
+    sched_param Param;
+    Param.sched_priority = std::min( std::max( static_cast< int >( Priority ), sched_get_priority_min( SCHED_FIFO ) ), sched_get_priority_max( SCHED_FIFO ) );
+    bApplied = pthread_setschedparam( pthread_self(), SCHED_FIFO, &Param ) == 0;
+  }
+
+  if( Cpu >= 0 )
+  {
+    cpu_set_t CpuSet;
+    CPU_ZERO( &CpuSet );
+    CPU_SET( Cpu, &CpuSet );
+    bApplied = pthread_setaffinity_np( pthread_self(), sizeof( CpuSet ), &CpuSet ) == 0 && bApplied;
+  }
+  return bApplied;
+#else
+  return false;
+#endif
+}
+
+std::size_t VOutputScheduler::Bucket( std::int64_t i_JitterNs )
+{
+  const std::int64_t Microseconds = i_JitterNs / 1000;
+  if( Microseconds < 1000 )
+  {
+    return static_cast< std::size_t >( Microseconds );
+  }
+  if( Microseconds < 10000 )
+  {
+    return static_cast< std::size_t >( 1000 + ( Microseconds - 1000 ) / 10 );
+  }
+  if( Microseconds < 100000 )
+  {
+    return static_cast< std::size_t >( 1900 + ( Microseconds - 10000 ) / 100 );
+  }
+  return s_BucketCount - 1;
+}
+
+double VOutputScheduler::BucketLimit( std::size_t i_Bucket )
+{
+  // In milliseconds
+  if( i_Bucket < 1000 )
+  {
+    return static_cast< double >( i_Bucket + 1 ) / 1000.0;
+  }
+  if( i_Bucket < 1900 )
+  {
+    return static_cast< double >( 1000 + ( i_Bucket - 1000 + 1 ) * 10 ) / 1000.0;
+  }
+  if( i_Bucket < 2800 )
+  {
+    return static_cast< double >( 10000 + ( i_Bucket - 1900 + 1 ) * 100 ) / 1000.0;
+  }
+  return std::numeric_limits< double >::infinity();
+}
+
+} // End of namespace Core
+} // End of namespace ViconDataStreamSDK
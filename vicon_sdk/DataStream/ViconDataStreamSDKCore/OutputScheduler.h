@@ -0,0 +1,114 @@
+
+//////////////////////////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2017 Vicon Motion Systems Ltd
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <boost/thread/mutex.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace ViconDataStreamSDK
+{
+namespace Core
+{
+
+// How late the output thread woke, in milliseconds, over the frames output so far
+class VOutputJitter
+{
+public:
+  VOutputJitter()
+  : m_FrameCount( 0 )
+  , m_MissedFrames( 0 )
+  , m_Mean( 0 )
+  , m_Median( 0 )
+  , m_Percentile90( 0 )
+  , m_Percentile99( 0 )
+  , m_Percentile999( 0 )
+  , m_Maximum( 0 )
+  , m_bRealTime( false )
+  {}
+
+  std::uint64_t m_FrameCount;
+  std::uint64_t m_MissedFrames;
+  double m_Mean;
+  double m_Median;
+  double m_Percentile90;
+  double m_Percentile99;
+  double m_Percentile999;
+  double m_Maximum;
+
+  // True if the requested real-time priority and CPU affinity were applied
+  bool m_bRealTime;
+};
+
+// Wakes a thread at a fixed rate. Wake times are whole nanoseconds on the steady clock, counted from the start,
+// so the rate does not drift however long it runs. If a whole period is overrun, the frames missed are skipped.
+class VOutputScheduler
+{
+public:
+  VOutputScheduler();
+
+  // Whether thread priority and affinity can be set on this platform
+  static bool ThreadOptionsSupported();
+
+  // Options for the thread that next calls Start. A priority above zero runs it with SCHED_FIFO at that priority;
+  // a CPU index of zero or more pins it to that CPU.
+  void SetThreadOptions( unsigned int i_Priority, int i_Cpu );
+
+  // Called by the output thread
+  void Start( double i_FrameRate );
+  void WaitForNextFrame();
+
+  VOutputJitter Jitter() const;
+
+private:
+  typedef std::chrono::steady_clock Clock;
+
+  Clock::time_point WakeTime( std::uint64_t i_Frame ) const;
+  bool ApplyThreadOptions() const;
+  static std::size_t Bucket( std::int64_t i_JitterNs );
+  static double BucketLimit( std::size_t i_Bucket );
+
+  Clock::time_point m_Start;
+  double m_FrameRate;
+  std::uint64_t m_Frame;
+
+  mutable boost::mutex m_Mutex;
+  unsigned int m_Priority;
+  int m_Cpu;
+
+  // Jitter histogram: 1us buckets to 1ms, 10us to 10ms, 100us to 100ms, then one for anything later
+  static const std::size_t s_BucketCount = 1000 + 900 + 900 + 1;
+  std::array< std::uint64_t, s_BucketCount > m_Histogram;
+  std::uint64_t m_FrameCount;
+  std::uint64_t m_MissedFrames;
+  double m_TotalJitterNs;
+  std::int64_t m_MaximumJitterNs;
+  bool m_bRealTime;
+};
+
+} // End of namespace Core
+} // End of namespace ViconDataStreamSDK
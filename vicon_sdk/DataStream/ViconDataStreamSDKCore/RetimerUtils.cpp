@@ -28,8 +28,49 @@
 
 #include <boost/math/constants/constants.hpp>
 
+#include <cmath>
+
 namespace bmc = boost::math::constants;
 
+namespace
+{
+  // Measurement noise of a position, in mm^2
+  const double s_MeasurementVariance = 0.25;
+
+  // Spectral density of the random jerk driving the filter, in mm^2/s^5
+  const double s_JerkDensity = 1.0e8;
+
+  // Variances used before the velocity and acceleration have been observed
+  const double s_InitialVelocityVariance = 1.0e6;
+  const double s_InitialAccelerationVariance = 1.0e8;
+
+  typedef std::array< double, 4 > Quaternion;
+  typedef std::array< double, 3 > Axis;
+
+  // Log of a unit quaternion, as a rotation vector of half the rotation angle
+  Axis Log( const Quaternion & i_rInput )
+  {
+    const double ImaginaryMagnitude = std::sqrt( i_rInput[0] * i_rInput[0] + i_rInput[1] * i_rInput[1] + i_rInput[2] * i_rInput[2] );
+    if( ImaginaryMagnitude < 1.0e-12 )
+    {
+      Axis Zero = { 0.0, 0.0, 0.0 };
+      return Zero;
+    }
+
+    const double Scale = std::atan2( ImaginaryMagnitude, i_rInput[3] ) / ImaginaryMagnitude;
+    Axis Output = { i_rInput[0] * Scale, i_rInput[1] * Scale, i_rInput[2] * Scale };
+    return Output;
+  }
+
+  Quaternion Exp( const Axis & i_rInput )
+  {
+    const double Angle = std::sqrt( i_rInput[0] * i_rInput[0] + i_rInput[1] * i_rInput[1] + i_rInput[2] * i_rInput[2] );
+    const double Scale = Angle < 1.0e-12 ? 1.0 : std::sin( Angle ) / Angle;
+    Quaternion Output = { i_rInput[0] * Scale, i_rInput[1] * Scale, i_rInput[2] * Scale, std::cos( Angle ) };
+    return Output;
+  }
+}
+
 namespace ClientUtils
 {
   typedef std::array< double, 4 > Quaternion;
@@ -252,6 +293,175 @@ namespace ClientUtils
     return d3;
 
   }
+
+  Displacement Tangent( const Displacement & d0, double t0, const Displacement & d1, double t1, const Displacement & d2, double t2 )
+  {
+    // Weight each side's slope by the length of the other interval
+    Displacement m = ( d1 - d0 ) * ( ( t2 - t1 ) / ( ( t1 - t0 ) * ( t2 - t0 ) ) ) + ( d2 - d1 ) * ( ( t1 - t0 ) / ( ( t2 - t1 ) * ( t2 - t0 ) ) );
+    return m;
+  }
+
+  Displacement EndTangent( const Displacement & d0, double t0, const Displacement & d1, double t1, const Displacement & d2, double t2 )
+  {
+    const Displacement Slope1 = ( d1 - d0 ) * ( 1.0 / ( t1 - t0 ) );
+    const Displacement Slope2 = ( d2 - d1 ) * ( 1.0 / ( t2 - t1 ) );
+    Displacement m = Slope2 + ( Slope2 - Slope1 ) * ( ( t2 - t1 ) / ( t2 - t0 ) );
+    return m;
+  }
+
+  Displacement InterpolateHermite( const Displacement & d1, const Displacement & m1, double t1, const Displacement & d2, const Displacement & m2, double t2, double t3 )
+  {
+    const double Interval = t2 - t1;
+    const double s = ( t3 - t1 ) / Interval;
+    const double s2 = s * s;
+    const double s3 = s2 * s;
+
+    const double h00 = 2 * s3 - 3 * s2 + 1;
+    const double h10 = s3 - 2 * s2 + s;
+    const double h01 = -2 * s3 + 3 * s2;
+    const double h11 = s3 - s2;
+
+    Displacement d3 = d1 * h00 + m1 * ( h10 * Interval ) + d2 * h01 + m2 * ( h11 * Interval );
+    return d3;
+  }
+
+  Quaternion SameHemisphere( const Quaternion & r, const Quaternion & i_rReference )
+  {
+    const double Dot = r[0] * i_rReference[0] + r[1] * i_rReference[1] + r[2] * i_rReference[2] + r[3] * i_rReference[3];
+    if( Dot >= 0.0 )
+    {
+      return r;
+    }
+
+    Quaternion Negated = { -r[0], -r[1], -r[2], -r[3] };
+    return Negated;
+  }
+
+  Quaternion Slerp( const Quaternion & r1, const Quaternion & r2, double h )
+  {
+    // r1 * ( r1^-1 * r2 )^h, taking the shorter way round
+    const Quaternion Step = Conjugate( r1 ) * SameHemisphere( r2, r1 );
+    return r1 * Exp( Log( Step ) * h );
+  }
+
+  Quaternion SquadControl( const Quaternion & r0, const Quaternion & r1, const Quaternion & r2 )
+  {
+    const Quaternion Inverse1 = Conjugate( r1 );
+    Axis Sum = Log( Inverse1 * SameHemisphere( r2, r1 ) );
+    Sum += Log( Inverse1 * SameHemisphere( r0, r1 ) );
+    return r1 * Exp( Sum * -0.25 );
+  }
+
+  Quaternion Squad( const Quaternion & r1, const Quaternion & s1, const Quaternion & s2, const Quaternion & r2, double h )
+  {
+    return Slerp( Slerp( r1, r2, h ), Slerp( s1, s2, h ), 2 * h * ( 1 - h ) );
+  }
+
+  VConstantAccelerationFilter::VConstantAccelerationFilter()
+  {
+    Reset();
+  }
+
+  void VConstantAccelerationFilter::Reset()
+  {
+    m_bInitialized = false;
+    m_Time = 0.0;
+    m_State.fill( 0.0 );
+    m_Covariance.fill( 0.0 );
+  }
+
+  bool VConstantAccelerationFilter::IsInitialized() const
+  {
+    return m_bInitialized;
+  }
+
+  void VConstantAccelerationFilter::Propagate( double i_Time, std::array< double, 3 > & o_rState, std::array< double, 9 > & o_rCovariance ) const
+  {
+    // The state is position, velocity and acceleration per second
+    const double dt = ( i_Time - m_Time ) / 1000.0;
+    const double dt2 = dt * dt;
+    const double dt3 = dt2 * dt;
+
+    const std::array< double, 9 > F = { 1.0, dt, dt2 / 2,
+                                         0.0, 1.0, dt,
+                                         0.0, 0.0, 1.0 };
+
+    o_rState[ 0 ] = m_State[ 0 ] + dt * m_State[ 1 ] + dt2 / 2 * m_State[ 2 ];
+    o_rState[ 1 ] = m_State[ 1 ] + dt * m_State[ 2 ];
+    o_rState[ 2 ] = m_State[ 2 ];
+
+    // F P F' + Q
+    std::array< double, 9 > FP;
+    for( unsigned int Row = 0; Row < 3; ++Row )
+    {
+      for( unsigned int Column = 0; Column < 3; ++Column )
+      {
+        double Sum = 0.0;
+        for( unsigned int k = 0; k < 3; ++k )
+        {
+          Sum += F[ Row * 3 + k ] * m_Covariance[ k * 3 + Column ];
+        }
+        FP[ Row * 3 + Column ] = Sum;
+      }
+    }
+
+    const std::array< double, 9 > Q = { dt3 * dt2 / 20, dt2 * dt2 / 8, dt3 / 6,
+                                         dt2 * dt2 / 8,  dt3 / 3,       dt2 / 2,
+                                         dt3 / 6,        dt2 / 2,       dt };
+
+    for( unsigned int Row = 0; Row < 3; ++Row )
+    {
+      for( unsigned int Column = 0; Column < 3; ++Column )
+      {
+        double Sum = 0.0;
+        for( unsigned int k = 0; k < 3; ++k )
+        {
+          Sum += FP[ Row * 3 + k ] * F[ Column * 3 + k ];
+        }
+        o_rCovariance[ Row * 3 + Column ] = Sum + s_JerkDensity * Q[ Row * 3 + Column ];
+      }
+    }
+  }
+
+  void VConstantAccelerationFilter::Update( double i_Value, double i_Time )
+  {
+    if( !m_bInitialized )
+    {
+      m_State = { i_Value, 0.0, 0.0 };
+      m_Covariance = { s_MeasurementVariance, 0.0, 0.0,
+                       0.0, s_InitialVelocityVariance, 0.0,
+                       0.0, 0.0, s_InitialAccelerationVariance };
+      m_Time = i_Time;
+      m_bInitialized = true;
+      return;
+    }
+
+    std::array< double, 3 > State;
+    std::array< double, 9 > Covariance;
+    Propagate( i_Time, State, Covariance );
+
+    // We measure position only
+    const double Innovation = i_Value - State[ 0 ];
+    const double InnovationVariance = Covariance[ 0 ] + s_MeasurementVariance;
+    const std::array< double, 3 > Gain = { Covariance[ 0 ] / InnovationVariance, Covariance[ 3 ] / InnovationVariance, Covariance[ 6 ] / InnovationVariance };
+
+    for( unsigned int Row = 0; Row < 3; ++Row )
+    {
+      m_State[ Row ] = State[ Row ] + Gain[ Row ] * Innovation;
+      for( unsigned int Column = 0; Column < 3; ++Column )
+      {
+        m_Covariance[ Row * 3 + Column ] = Covariance[ Row * 3 + Column ] - Gain[ Row ] * Covariance[ Column ];
+      }
+    }
+
+    m_Time = i_Time;
+  }
+
+  double VConstantAccelerationFilter::Predict( double i_Time ) const
+  {
+    const double dt = ( i_Time - m_Time ) / 1000.0;
+    return m_State[ 0 ] + dt * m_State[ 1 ] + dt * dt / 2 * m_State[ 2 ];
+  }
 }
 
 
@@ -59,6 +59,52 @@ namespace ClientUtils
 
   /// Linear interpolation between doubles
   double PredictVal( const double d1, double t1, const double d2, double t2, double t3 );
+
+  /// Returns the rate of change at t1 of the quadratic through d0, d1 and d2 at times t0 < t1 < t2
+  Displacement Tangent( const Displacement & d0, double t0, const Displacement & d1, double t1, const Displacement & d2, double t2 );
+
+  /// Returns the rate of change at t2 of the quadratic through d0, d1 and d2 at times t0 < t1 < t2
+  Displacement EndTangent( const Displacement & d0, double t0, const Displacement & d1, double t1, const Displacement & d2, double t2 );
+
+  /// Returns the cubic Hermite interpolation at time t3 between d1 at t1 and d2 at t2, with rates of change m1 and m2,
+  /// where t2 >= t3 >= t1
+  Displacement InterpolateHermite( const Displacement & d1, const Displacement & m1, double t1, const Displacement & d2, const Displacement & m2, double t2, double t3 );
+
+  /// Spherical linear interpolation from r1 to r2, for h from 0 to 1
+  Quaternion Slerp( const Quaternion & r1, const Quaternion & r2, double h );
+
+  /// Returns r, or -r if that is nearer to i_rReference; the two represent the same rotation
+  Quaternion SameHemisphere( const Quaternion & r, const Quaternion & i_rReference );
+
+  /// Returns the SQUAD control point for r1, given its neighbours r0 and r2
+  Quaternion SquadControl( const Quaternion & r0, const Quaternion & r1, const Quaternion & r2 );
+
+  /// Spherical quadrangle interpolation from r1 to r2 with control points s1 and s2, for h from 0 to 1
+  Quaternion Squad( const Quaternion & r1, const Quaternion & s1, const Quaternion & s2, const Quaternion & r2, double h );
+
+  /// Kalman filter for one coordinate moving with constant acceleration, driven by random jerk. Times are in milliseconds.
+  class VConstantAccelerationFilter
+  {
+  public:
+    VConstantAccelerationFilter();
+
+    void Reset();
+    bool IsInitialized() const;
+
+    // Add a measurement, which must be later than the previous one
+    void Update( double i_Value, double i_Time );
+
+    // Returns the filtered value extrapolated to i_Time
+    double Predict( double i_Time ) const;
+
+  private:
+    void Propagate( double i_Time, std::array< double, 3 > & o_rState, std::array< double, 9 > & o_rCovariance ) const;
+
+    bool m_bInitialized;
+    double m_Time;
+    std::array< double, 3 > m_State;
+    std::array< double, 9 > m_Covariance;
+  };
 }
 
 
@@ -48,7 +48,12 @@ namespace ViconDataStreamSDK
   namespace Core
   {
 
-    
+    namespace
+    {
+      // How long the input thread waits for a frame before checking whether it has been stopped (in milliseconds)
+      const unsigned int s_InputWaitTimeout = 100;
+    }
+
     Result::Enum Adapt(const VSubjectPose::EResult & i_rResult)
     {
       switch( i_rResult )
@@ -781,6 +786,38 @@ namespace ViconDataStreamSDK
       return m_Retimer.MaximumPrediction();
     }
 
+    void VRetimingClient::SetPredictor( PredictorModel::Enum i_Predictor )
+    {
+      m_Retimer.SetPredictor( i_Predictor );
+    }
+
+    PredictorModel::Enum VRetimingClient::Predictor() const
+    {
+      return m_Retimer.Predictor();
+    }
+
+    Result::Enum VRetimingClient::SetOutputThreadOptions( unsigned int i_Priority, int i_Cpu )
+    {
+      if( !VOutputScheduler::ThreadOptionsSupported() )
+      {
+        return Result::NotSupported;
+      }
+
+      if( i_Cpu < -1 || i_Cpu >= static_cast< int >( boost::thread::hardware_concurrency() ) )
+      {
+        return Result::InvalidIndex;
+      }
+
+      m_OutputScheduler.SetThreadOptions( i_Priority, i_Cpu );
+      return Result::Success;
+    }
+
+    Result::Enum VRetimingClient::GetOutputJitter( VOutputJitter & o_rJitter ) const
+    {
+      o_rJitter = m_OutputScheduler.Jitter();
+      return Result::Success;
+    }
+
     bool VRetimingClient::SetDebugLogFile(const std::string & i_rLogFile)
     {
       return m_Retimer.SetDebugLogFile(i_rLogFile);
@@ -807,38 +844,19 @@ namespace ViconDataStreamSDK
     {
       while( !m_bInputStopped )
       {
-        if( m_pClient->IsConnected() )
+        // Block until the stream delivers a frame. Frames queued while we were busy are taken one after another.
+        const Result::Enum FrameResult = m_pClient->WaitForFrame( s_InputWaitTimeout );
+        if( FrameResult == Result::NotConnected )
         {
+          std::this_thread::sleep_for( std::chrono::milliseconds( s_InputWaitTimeout ) );
+          continue;
+        }
 
-          // Get a frame
-          while( m_pClient->GetFrame() != Result::Success && m_pClient->IsConnected() )
-          {
-            // Sleep a little so that we don't lumber the CPU with a busy poll
-#ifdef WIN32
-            Sleep(200);
-#else
-            sleep(1);
-#endif
-          }
-
-          // Get the system latencies as individual components for debugging
-          std::map< std::string, double > Latencies;
-          unsigned int LatencySampleCount;
-          if( m_pClient->GetLatencySampleCount(LatencySampleCount) == Result::Success )
-          {
-            for( unsigned int SampleIndex = 0; SampleIndex < LatencySampleCount; ++SampleIndex )
-            {
-              std::string SampleName;
-              if( m_pClient->GetLatencySampleName(SampleIndex, SampleName) == Result::Success )
-              {
-                double SampleValue = 0;
-                if( m_pClient->GetLatencySampleValue(SampleName, SampleValue) == Result::Success )
-                {
-                  Latencies[SampleName] = SampleValue;
-                }
-              }
-            }
-          }
+        if( FrameResult == Result::Success )
+        {
+          // Get the system latencies as individual components for debugging; one copy is shared by every subject in the frame
+          std::shared_ptr< VSubjectPose::TLatencies > pLatencies = std::make_shared< VSubjectPose::TLatencies >();
+          m_pClient->GetLatencySamples( *pLatencies );
 
           unsigned int FrameNumber;
           double FrameRateHz;
@@ -867,7 +885,7 @@ namespace ViconDataStreamSDK
               pPoseData->FrameNumber = FrameNumber;
               pPoseData->FrameTime = FrameReceiptTime;
               pPoseData->ReceiptTime = WallReceiptTime;
-              pPoseData->Latencies = Latencies;
+              pPoseData->Latencies = pLatencies;
               pPoseData->Result = VSubjectPose::ESuccess;
               pPoseData->FrameRate = FrameRateHz;
 
@@ -979,11 +997,7 @@ namespace ViconDataStreamSDK
 
     void VRetimingClient::OutputThread()
     {
-      // Keep track of retimed output frame number
-      uint64_t CurrentOutputFrame = 0;
-
-      std::chrono::system_clock::time_point WakeTime
-        = std::chrono::system_clock::now() + std::chrono::milliseconds(static_cast< unsigned int >( ( 1.0 / m_FrameRate ) * 1000 ));;
+      m_OutputScheduler.Start( m_FrameRate );
 
       while( !m_bOutputStopped )
       {
@@ -999,13 +1013,8 @@ namespace ViconDataStreamSDK
           m_OutputWait.notify_all();
         }
 
-        // Increment our output frame number
-        ++CurrentOutputFrame;
-
         // Yield until next frame is required.
-        std::this_thread::sleep_until( WakeTime );
-        WakeTime += std::chrono::milliseconds(static_cast< unsigned int >( ( 1.0 / m_FrameRate ) * 1000 ));
-
+        m_OutputScheduler.WaitForNextFrame();
       }
 
       m_bOutputStopped = false;
@@ -36,6 +36,7 @@
 #include <chrono>
 
 #include "RetimingCore.h"
+#include "OutputScheduler.h"
 
 #include <ViconDataStreamSDKCoreUtils/Constants.h>
 #include <ViconDataStreamSDKCoreUtils/ClientUtils.h>
@@ -120,6 +121,19 @@ namespace ViconDataStreamSDK
       // Return the maximum prediction used by the system
       double MaximumPrediction() const;
 
+      // Set the model used to interpolate and predict poses
+      void SetPredictor( PredictorModel::Enum i_Predictor );
+
+      // Return the model used to interpolate and predict poses
+      PredictorModel::Enum Predictor() const;
+
+      // Run the output thread with real-time priority (0 for normal scheduling) and pinned to a CPU (-1 for any).
+      // Takes effect the next time output is started.
+      Result::Enum SetOutputThreadOptions( unsigned int i_Priority, int i_Cpu );
+
+      // Statistics on how late the output thread has woken since output was last started
+      Result::Enum GetOutputJitter( VOutputJitter & o_rJitter ) const;
+
       // Set a log file to write debug output about performance to
       bool SetDebugLogFile(const std::string & i_rLogFile);
 
@@ -162,6 +176,7 @@ namespace ViconDataStreamSDK
 
       std::unique_ptr< boost::thread > m_pOutputThread;
       bool m_bOutputStopped;
+      VOutputScheduler m_OutputScheduler;
 
       // Required output latency (in milliseconds)
       double m_OutputLatency;
@@ -25,6 +25,9 @@
 #include "RetimingCore.h"
 #include "RetimerUtils.h"
 
+#include <ViconDataStreamSDKCoreUtils/ClientUtils.h>
+
+#include <ViconCGStreamClient/CGStreamExecutor.h>
 #include <ViconCGStreamClient/CGStreamPostalService.h>
 
 #pragma warning( push )
@@ -48,17 +51,26 @@ namespace ViconDataStreamSDK
 {
   namespace Core
   {
-    static unsigned int s_BufSize = 2;
+    // Input samples kept per subject; enough to cover the output latency at typical input rates
+    static unsigned int s_BufSize = 32;
     static double s_PurgeLimit = 500.0;
 
     VRetimingCore::VRetimingCore()    
     : m_MaxPredictionTime( 100 )
+    , m_Predictor( PredictorModel::Linear )
     , m_bOutputLogHeaderWritten( true )
+    , m_bDebugLog( false )
     {
     }
 
     VRetimingCore::~VRetimingCore()
     {
+      // Log entries still queued refer to us, so let them run first
+      if( m_pPostalService )
+      {
+        m_pPostalService->StopService();
+      }
+
       CloseDebugLog();
       CloseOutputLog();
     }
@@ -75,6 +87,37 @@ namespace ViconDataStreamSDK
       return m_MaxPredictionTime;
     }
 
+    void VRetimingCore::SetPredictor( PredictorModel::Enum i_Predictor )
+    {
+      boost::recursive_mutex::scoped_lock Lock( m_DataMutex );
+      if( i_Predictor == m_Predictor )
+      {
+        return;
+      }
+
+      m_Predictor = i_Predictor;
+
+      // The filters are only fed while they are in use, so catch them up with what we have
+      for( auto & rPair : m_Data )
+      {
+        auto & rTrack = rPair.second;
+        rTrack.m_Filters.clear();
+        if( m_Predictor == PredictorModel::Kalman )
+        {
+          for( std::size_t SampleIndex = 0; SampleIndex < rTrack.SampleCount(); ++SampleIndex )
+          {
+            UpdateFilters( rTrack, rTrack.Sample( SampleIndex ) );
+          }
+        }
+      }
+    }
+
+    PredictorModel::Enum VRetimingCore::Predictor() const
+    {
+      boost::recursive_mutex::scoped_lock Lock( m_DataMutex );
+      return m_Predictor;
+    }
+
     // utility to insert the current date and time into a string
     static std::string TimestampFilename( const std::string& i_rFilename )
     {
@@ -131,142 +174,410 @@ namespace ViconDataStreamSDK
 
         if( !bOccluded )
         {
-          auto& rData = m_Data[ rpData->Name ];
-          rData.push_back( rpData );
+          auto& rTrack = m_Data[ rpData->Name ];
+          if( !SameTopology( rTrack, *rpData ) )
+          {
+            ResetTopology( rTrack, *rpData );
+          }
 
-          while( rData.size() > s_BufSize )
+          // Samples are searched by receipt time, so they must stay in order, and a sample received at the same
+          // time as the last one replaces it
+          if( rTrack.SampleCount() != 0 && rpData->ReceiptTime < rTrack.Newest().ReceiptTime )
+          {
+            rTrack.ClearSamples();
+          }
+          else if( rTrack.SampleCount() != 0 && rpData->ReceiptTime == rTrack.Newest().ReceiptTime )
           {
-            rData.pop_front();
+            rTrack.RemoveNewest();
+          }
+
+          ToSample( rpData, rTrack.AddSample() );
+          if( m_Predictor == PredictorModel::Kalman )
+          {
+            UpdateFilters( rTrack, rTrack.Newest() );
           }
         }
       }
     }
 
-    std::shared_ptr< const VSubjectPose > VRetimingCore::Predict( std::shared_ptr< const VSubjectPose > p1, std::shared_ptr< const VSubjectPose > p2, double t ) const
+    VRetimingCore::VPoseSample & VRetimingCore::VSubjectTrack::AddSample()
+    {
+      if( m_Samples.empty() )
+      {
+        m_Samples.resize( s_BufSize );
+      }
+
+      if( m_SampleCount == m_Samples.size() )
+      {
+        RemoveOldest();
+      }
+
+      return m_Samples[ ( m_FirstSample + m_SampleCount++ ) % m_Samples.size() ];
+    }
+
+    void VRetimingCore::VSubjectTrack::RemoveOldest()
+    {
+      m_FirstSample = ( m_FirstSample + 1 ) % m_Samples.size();
+      --m_SampleCount;
+    }
+
+    void VRetimingCore::VSubjectTrack::RemoveNewest()
+    {
+      --m_SampleCount;
+    }
+
+    void VRetimingCore::VSubjectTrack::ClearSamples()
+    {
+      m_FirstSample = 0;
+      m_SampleCount = 0;
+      m_Filters.clear();
+    }
+
+    std::size_t VRetimingCore::VSubjectTrack::Bracket( double i_Time ) const
+    {
+      // Find the first sample received after the requested time
+      std::size_t Begin = 0;
+      std::size_t End = m_SampleCount;
+      while( Begin != End )
+      {
+        const std::size_t Middle = Begin + ( End - Begin ) / 2;
+        if( Sample( Middle ).ReceiptTime <= i_Time )
+        {
+          Begin = Middle + 1;
+        }
+        else
+        {
+          End = Middle;
+        }
+      }
+
+      // Interpolate between the samples either side; before the oldest or after the newest, use the nearest two
+      return std::min( std::max( Begin, std::size_t( 1 ) ), m_SampleCount - 1 ) - 1;
+    }
+
+    bool VRetimingCore::SameTopology( const VSubjectTrack & i_rTrack, const VSubjectPose & i_rPose )
+    {
+      if( i_rTrack.m_SegmentNames.size() != i_rPose.m_Segments.size() )
+      {
+        return false;
+      }
+
+      auto NameIt = i_rTrack.m_SegmentNames.begin();
+      for( const auto & rSegment : i_rPose.m_Segments )
+      {
+        if( *NameIt++ != rSegment.first )
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    void VRetimingCore::ResetTopology( VSubjectTrack & io_rTrack, const VSubjectPose & i_rPose )
+    {
+      io_rTrack.m_SegmentNames.clear();
+      for( const auto & rSegment : i_rPose.m_Segments )
+      {
+        io_rTrack.m_SegmentNames.push_back( rSegment.first );
+      }
+
+      // Samples and outputs laid out for the old topology are no use
+      io_rTrack.ClearSamples();
+      for( auto & rpOutput : io_rTrack.m_Outputs )
+      {
+        rpOutput.reset();
+      }
+    }
+
+    void VRetimingCore::ToSample( const std::shared_ptr< const VSubjectPose > & i_rpPose, VPoseSample & o_rSample )
+    {
+      o_rSample.ReceiptTime = i_rpPose->ReceiptTime;
+      o_rSample.FrameNumber = i_rpPose->FrameNumber;
+      o_rSample.m_pInput = i_rpPose;
+      o_rSample.m_Segments.resize( i_rpPose->m_Segments.size() );
+
+      auto SampleIt = o_rSample.m_Segments.begin();
+      for( const auto & rSegment : i_rpPose->m_Segments )
+      {
+        const VSegmentPose & rInput = *rSegment.second;
+        VSegmentSample & rSample = *SampleIt++;
+        rSample.T = rInput.T;
+        rSample.R = rInput.R;
+        rSample.T_Rel = rInput.T_Rel;
+        rSample.R_Rel = rInput.R_Rel;
+        rSample.T_Stat = rInput.T_Stat;
+        rSample.R_Stat = rInput.R_Stat;
+        rSample.bOccluded = rInput.bOccluded;
+      }
+    }
+
+    void VRetimingCore::MakeOutput( VSubjectTrack & io_rTrack, unsigned int i_Slot, const VSubjectPose & i_rTemplate )
     {
       std::shared_ptr< VSubjectPose > pOutput( new VSubjectPose() );
+      pOutput->Name = i_rTemplate.Name;
+      pOutput->RootSegment = i_rTemplate.RootSegment;
+      pOutput->Latencies = i_rTemplate.Latencies;
+      pOutput->FrameRate = i_rTemplate.FrameRate;
+      pOutput->m_SegmentNames = i_rTemplate.m_SegmentNames;
+
+      auto & rOutputSegments = io_rTrack.m_OutputSegments[ i_Slot ];
+      rOutputSegments.clear();
+      for( const auto & rSegment : i_rTemplate.m_Segments )
+      {
+        std::shared_ptr< VSegmentPose > pOutputSegment( new VSegmentPose() );
+        pOutputSegment->Name = rSegment.second->Name;
+        pOutputSegment->Parent = rSegment.second->Parent;
+        pOutputSegment->m_Children = rSegment.second->m_Children;
+
+        pOutput->m_Segments.emplace_hint( pOutput->m_Segments.end(), rSegment.first, pOutputSegment );
+        rOutputSegments.push_back( pOutputSegment.get() );
+      }
+
+      io_rTrack.m_Outputs[ i_Slot ] = pOutput;
+    }
+
+    void VRetimingCore::UpdateFilters( VSubjectTrack & io_rTrack, const VPoseSample & i_rSample )
+    {
+      io_rTrack.m_Filters.resize( i_rSample.m_Segments.size() );
+      for( std::size_t SegmentIndex = 0; SegmentIndex < i_rSample.m_Segments.size(); ++SegmentIndex )
+      {
+        const VSegmentSample & rSegment = i_rSample.m_Segments[ SegmentIndex ];
+        auto & rFilters = io_rTrack.m_Filters[ SegmentIndex ];
+        for( unsigned int Axis = 0; Axis < 3; ++Axis )
+        {
+          rFilters[ Axis ].Update( rSegment.T[ Axis ], i_rSample.ReceiptTime );
+          rFilters[ Axis + 3 ].Update( rSegment.T_Rel[ Axis ], i_rSample.ReceiptTime );
+        }
+      }
+    }
 
+    ClientUtils::Displacement VRetimingCore::SplineTranslation( const VPoseSample * i_pSample0, const VPoseSample & i_rSample1, const VPoseSample & i_rSample2, const VPoseSample * i_pSample3,
+                                                                std::size_t i_Segment, std::array< double, 3 > VSegmentSample::* i_pTranslation, double i_Time )
+    {
+      const double t1 = i_rSample1.ReceiptTime;
+      const double t2 = i_rSample2.ReceiptTime;
+      const auto & d1 = i_rSample1.m_Segments[ i_Segment ].*i_pTranslation;
+      const auto & d2 = i_rSample2.m_Segments[ i_Segment ].*i_pTranslation;
+
+      // Without a neighbour, the rate of change at that end is that of the interval
+      const ClientUtils::Displacement Slope = ( d2 - d1 ) * ( 1.0 / ( t2 - t1 ) );
+      const ClientUtils::Displacement m1 = i_pSample0 ? ClientUtils::Tangent( i_pSample0->m_Segments[ i_Segment ].*i_pTranslation, i_pSample0->ReceiptTime, d1, t1, d2, t2 ) : Slope;
+      const ClientUtils::Displacement m2 = i_pSample3 ? ClientUtils::Tangent( d1, t1, d2, t2, i_pSample3->m_Segments[ i_Segment ].*i_pTranslation, i_pSample3->ReceiptTime ) : Slope;
+
+      return ClientUtils::InterpolateHermite( d1, m1, t1, d2, m2, t2, i_Time );
+    }
+
+    ClientUtils::Displacement VRetimingCore::ExtrapolateTranslation( const VPoseSample * i_pSample0, const VPoseSample & i_rSample1, const VPoseSample & i_rSample2,
+                                                                     std::size_t i_Segment, std::array< double, 3 > VSegmentSample::* i_pTranslation, double i_Time )
+    {
+      const auto & d1 = i_rSample1.m_Segments[ i_Segment ].*i_pTranslation;
+      const auto & d2 = i_rSample2.m_Segments[ i_Segment ].*i_pTranslation;
+      if( !i_pSample0 )
+      {
+        return ClientUtils::PredictDisplacement( d1, i_rSample1.ReceiptTime, d2, i_rSample2.ReceiptTime, i_Time );
+      }
+
+      // Continue along the end of the curve through the last three samples
+      const ClientUtils::Displacement m2 = ClientUtils::EndTangent( i_pSample0->m_Segments[ i_Segment ].*i_pTranslation, i_pSample0->ReceiptTime, d1, i_rSample1.ReceiptTime, d2, i_rSample2.ReceiptTime );
+      return d2 + m2 * ( i_Time - i_rSample2.ReceiptTime );
+    }
+
+    ClientUtils::Quaternion VRetimingCore::SquadRotation( const VPoseSample * i_pSample0, const VPoseSample & i_rSample1, const VPoseSample & i_rSample2, const VPoseSample * i_pSample3,
+                                                          std::size_t i_Segment, std::array< double, 4 > VSegmentSample::* i_pRotation, double i_Time )
+    {
+      const auto & r1 = i_rSample1.m_Segments[ i_Segment ].*i_pRotation;
+      const auto r2 = ClientUtils::SameHemisphere( i_rSample2.m_Segments[ i_Segment ].*i_pRotation, r1 );
+
+      // Without a neighbour, the control point is the end itself
+      const ClientUtils::Quaternion s1 = i_pSample0 ? ClientUtils::SquadControl( i_pSample0->m_Segments[ i_Segment ].*i_pRotation, r1, r2 ) : r1;
+      const ClientUtils::Quaternion s2 = i_pSample3 ? ClientUtils::SquadControl( r1, r2, i_pSample3->m_Segments[ i_Segment ].*i_pRotation ) : r2;
+
+      const double h = ( i_Time - i_rSample1.ReceiptTime ) / ( i_rSample2.ReceiptTime - i_rSample1.ReceiptTime );
+      return ClientUtils::Squad( r1, s1, s2, r2, h );
+    }
+
+    std::shared_ptr< const VSubjectPose > VRetimingCore::Predict( std::shared_ptr< const VSubjectPose > p1, std::shared_ptr< const VSubjectPose > p2, double t ) const
+    {
       if( !p1 || !p2 )
       {
+        return std::shared_ptr< VSubjectPose >( new VSubjectPose() );
+      }
+
+      VSubjectTrack Track;
+      ResetTopology( Track, *p1 );
+      if( !SameTopology( Track, *p2 ) )
+      {
+        std::shared_ptr< VSubjectPose > pOutput( new VSubjectPose() );
+        pOutput->Result = VSubjectPose::EInvalid;
         return pOutput;
       }
 
+      ToSample( p1, Track.AddSample() );
+      ToSample( p2, Track.AddSample() );
+      if( m_Predictor == PredictorModel::Kalman )
+      {
+        UpdateFilters( Track, Track.Sample( 0 ) );
+        UpdateFilters( Track, Track.Sample( 1 ) );
+      }
+
+      MakeOutput( Track, 0, *p1 );
+      Predict( Track, 0, t, *Track.m_Outputs[ 0 ], Track.m_OutputSegments[ 0 ] );
+      return Track.m_Outputs[ 0 ];
+    }
+
+    VSubjectPose::EResult VRetimingCore::Predict( const VSubjectTrack & i_rTrack, std::size_t i_First, double i_Time, VSubjectPose & o_rOutput, const std::vector< VSegmentPose * > & i_rOutputSegments ) const
+    {
+      const VPoseSample & rSample1 = i_rTrack.Sample( i_First );
+      const VPoseSample & rSample2 = i_rTrack.Sample( i_First + 1 );
+
       // Calculate the input frame number that corresponds to this requested time
-      double Sample1Index = p1->ReceiptTime;
-      double Sample2Index = p2->ReceiptTime;
-      double PredictionIndex = t;
+      double Sample1Index = rSample1.ReceiptTime;
+      double Sample2Index = rSample2.ReceiptTime;
+      double PredictionIndex = i_Time;
       double MaximumPredictionValue = m_MaxPredictionTime;
 
+      const VSubjectPose & rInput1 = *rSample1.m_pInput;
+
       if( Sample2Index < Sample1Index )
       {
-        pOutput->Result = VSubjectPose::EInvalid;
-        DebugLog( str( boost::format( "Invalid Receipt Time, %s, %d, %d, %d" ) % p1->Name % PredictionIndex % Sample1Index % Sample2Index ) );
-        return pOutput;
+        o_rOutput.Result = VSubjectPose::EInvalid;
+        if( m_bDebugLog )
+        {
+          DebugLog( str( boost::format( "Invalid Receipt Time, %s, %d, %d, %d" ) % rInput1.Name % PredictionIndex % Sample1Index % Sample2Index ) );
+        }
+        return o_rOutput.Result;
       }
 
       if( PredictionIndex < Sample1Index )
       {
-        pOutput->Result = VSubjectPose::EEarly;
-        const std::string Msg = str(boost::format("Early data requested, %d, %d, %d, %d") % p1->Name % PredictionIndex % Sample1Index % Sample2Index);
-        DebugLog( Msg );
-        return pOutput;
+        o_rOutput.Result = VSubjectPose::EEarly;
+        if( m_bDebugLog )
+        {
+          DebugLog( str( boost::format( "Early data requested, %d, %d, %d, %d" ) % rInput1.Name % PredictionIndex % Sample1Index % Sample2Index ) );
+        }
+        return o_rOutput.Result;
       }
 
       if( PredictionIndex > Sample2Index )
       {
         if( PredictionIndex - Sample2Index > MaximumPredictionValue )
         {
-          pOutput->Result = VSubjectPose::ELate;
-          DebugLog( str( boost::format( "Late data requested, %s, %d, %d, %d, %d" ) % p1->Name % PredictionIndex % Sample1Index % Sample2Index % MaximumPredictionValue ) );
-          return pOutput;
+          o_rOutput.Result = VSubjectPose::ELate;
+          if( m_bDebugLog )
+          {
+            DebugLog( str( boost::format( "Late data requested, %s, %d, %d, %d, %d" ) % rInput1.Name % PredictionIndex % Sample1Index % Sample2Index % MaximumPredictionValue ) );
+          }
+          return o_rOutput.Result;
         }
       }
 
-      DebugLog(str(boost::format("Prediction to time from samples, %d, %d, %d") % PredictionIndex % ( PredictionIndex - Sample1Index ) % ( PredictionIndex - Sample2Index ) ));
-
-      pOutput->FrameTime = t;
-      pOutput->ReceiptTime = t;
-      pOutput->Result = VSubjectPose::ESuccess;
-
-      // Copy over input data
-      pOutput->RootSegment = p1->RootSegment;
-      pOutput->Name = p1->Name;
-      for( const auto Latency : p1->Latencies )
+      if( m_bDebugLog )
       {
-        pOutput->Latencies.insert( Latency );
+        DebugLog( str( boost::format( "Prediction to time from samples, %d, %d, %d" ) % PredictionIndex % ( PredictionIndex - Sample1Index ) % ( PredictionIndex - Sample2Index ) ) );
       }
-      pOutput->FrameRate = p1->FrameRate;
 
+      o_rOutput.FrameTime = i_Time;
+      o_rOutput.ReceiptTime = i_Time;
+      o_rOutput.Result = VSubjectPose::ESuccess;
 
-      double PredictedFrameNumber = ClientUtils::PredictVal( p1->FrameNumber, p1->ReceiptTime, p2->FrameNumber, p2->ReceiptTime, t );
-      pOutput->FrameNumber = PredictedFrameNumber;
-
-      for( const auto SegIt : p1->m_Segments )
-      {
-        // Get corresponding segment from p2->
-        for( const auto SegIt2 : p2->m_Segments )
-        {
-          std::shared_ptr< VSegmentPose > pSegment = SegIt.second;
-          std::shared_ptr< VSegmentPose > pSegment2 = SegIt2.second;
-
-          if( pSegment2->Name == pSegment->Name )
-          {
+      // Copy over input data
+      o_rOutput.Latencies = rInput1.Latencies;
+      o_rOutput.FrameRate = rInput1.FrameRate;
 
-            std::shared_ptr< VSegmentPose > pOutputSegment( new VSegmentPose() );
-            pOutputSegment->Name = pSegment->Name;
-            pOutputSegment->Parent = pSegment->Parent;
-            std::copy( pSegment->T_Stat.begin(), pSegment->T_Stat.end(), pOutputSegment->T_Stat.begin() );
-            std::copy( pSegment->R_Stat.begin(), pSegment->R_Stat.end(), pOutputSegment->R_Stat.begin() );
+      double PredictedFrameNumber = ClientUtils::PredictVal( rSample1.FrameNumber, Sample1Index, rSample2.FrameNumber, Sample2Index, i_Time );
+      o_rOutput.FrameNumber = PredictedFrameNumber;
 
-            pOutputSegment->m_Children.reserve( pSegment->m_Children.size() );
-            std::copy( pSegment->m_Children.begin(), pSegment->m_Children.end(), std::back_inserter( pOutputSegment->m_Children ) );
+      // Neighbouring samples, for the higher order models
+      const VPoseSample * pSample0 = i_First > 0 ? &i_rTrack.Sample( i_First - 1 ) : nullptr;
+      const VPoseSample * pSample3 = i_First + 2 < i_rTrack.SampleCount() ? &i_rTrack.Sample( i_First + 2 ) : nullptr;
+      const bool bExtrapolate = PredictionIndex > Sample2Index;
+      const bool bKalman = m_Predictor == PredictorModel::Kalman && i_rTrack.m_Filters.size() == i_rOutputSegments.size();
 
-            pOutputSegment->bOccluded = pSegment->bOccluded || pSegment2->bOccluded;
+      // The samples and output share the subject's segment order
+      for( std::size_t SegmentIndex = 0; SegmentIndex < i_rOutputSegments.size(); ++SegmentIndex )
+      {
+        const VSegmentSample & rSegment = rSample1.m_Segments[ SegmentIndex ];
+        const VSegmentSample & rSegment2 = rSample2.m_Segments[ SegmentIndex ];
+        VSegmentPose & rOutputSegment = *i_rOutputSegments[ SegmentIndex ];
 
-            pOutputSegment->T = ClientUtils::PredictDisplacement( pSegment->T, Sample1Index, pSegment2->T, Sample2Index, PredictionIndex );
-            pOutputSegment->R = ClientUtils::PredictRotation( pSegment->R, Sample1Index, pSegment2->R, Sample2Index, PredictionIndex );
-            pOutputSegment->T_Rel = ClientUtils::PredictDisplacement( pSegment->T_Rel, Sample1Index, pSegment2->T_Rel, Sample2Index, PredictionIndex );
-            pOutputSegment->R_Rel = ClientUtils::PredictRotation( pSegment->R_Rel, Sample1Index, pSegment2->R_Rel, Sample2Index, PredictionIndex );
+        rOutputSegment.T_Stat = rSegment.T_Stat;
+        rOutputSegment.R_Stat = rSegment.R_Stat;
 
-            pOutput->m_Segments[ pSegment->Name ] = pOutputSegment;
+        rOutputSegment.bOccluded = rSegment.bOccluded || rSegment2.bOccluded;
 
-            break;
+        if( m_Predictor == PredictorModel::Linear )
+        {
+          rOutputSegment.T = ClientUtils::PredictDisplacement( rSegment.T, Sample1Index, rSegment2.T, Sample2Index, PredictionIndex );
+          rOutputSegment.R = ClientUtils::PredictRotation( rSegment.R, Sample1Index, rSegment2.R, Sample2Index, PredictionIndex );
+          rOutputSegment.T_Rel = ClientUtils::PredictDisplacement( rSegment.T_Rel, Sample1Index, rSegment2.T_Rel, Sample2Index, PredictionIndex );
+          rOutputSegment.R_Rel = ClientUtils::PredictRotation( rSegment.R_Rel, Sample1Index, rSegment2.R_Rel, Sample2Index, PredictionIndex );
+        }
+        else if( !bExtrapolate )
+        {
+          // Both Spline and Kalman interpolate between samples with splines
+          rOutputSegment.T = SplineTranslation( pSample0, rSample1, rSample2, pSample3, SegmentIndex, &VSegmentSample::T, PredictionIndex );
+          rOutputSegment.R = SquadRotation( pSample0, rSample1, rSample2, pSample3, SegmentIndex, &VSegmentSample::R, PredictionIndex );
+          rOutputSegment.T_Rel = SplineTranslation( pSample0, rSample1, rSample2, pSample3, SegmentIndex, &VSegmentSample::T_Rel, PredictionIndex );
+          rOutputSegment.R_Rel = SquadRotation( pSample0, rSample1, rSample2, pSample3, SegmentIndex, &VSegmentSample::R_Rel, PredictionIndex );
+        }
+        else
+        {
+          if( bKalman )
+          {
+            const auto & rFilters = i_rTrack.m_Filters[ SegmentIndex ];
+            for( unsigned int Axis = 0; Axis < 3; ++Axis )
+            {
+              rOutputSegment.T[ Axis ] = rFilters[ Axis ].Predict( PredictionIndex );
+              rOutputSegment.T_Rel[ Axis ] = rFilters[ Axis + 3 ].Predict( PredictionIndex );
+            }
           }
+          else
+          {
+            rOutputSegment.T = ExtrapolateTranslation( pSample0, rSample1, rSample2, SegmentIndex, &VSegmentSample::T, PredictionIndex );
+            rOutputSegment.T_Rel = ExtrapolateTranslation( pSample0, rSample1, rSample2, SegmentIndex, &VSegmentSample::T_Rel, PredictionIndex );
+          }
+
+          // Rotations are predicted at constant angular velocity
+          rOutputSegment.R = ClientUtils::PredictRotation( rSegment.R, Sample1Index, rSegment2.R, Sample2Index, PredictionIndex );
+          rOutputSegment.R_Rel = ClientUtils::PredictRotation( rSegment.R_Rel, Sample1Index, rSegment2.R_Rel, Sample2Index, PredictionIndex );
         }
       }
 
-      if( pOutput->Result != VSubjectPose::ESuccess )
-      {
-        DebugLog( str( boost::format( "Failed to update frame for, %s, %d, %d, %d, %s" ) % p1->Name % PredictionIndex % Sample1Index % Sample2Index % VSubjectPose::ResultString( pOutput->Result ) ) );
-      }
-      return pOutput;
+      return o_rOutput.Result;
     }
 
     VSubjectPose::EResult VRetimingCore::UpdateFrameAtTime( double i_rTime )
     {
       boost::recursive_mutex::scoped_lock Lock( m_DataMutex );
 
-      m_LatestOutputPoses.clear();
-
       VSubjectPose::EResult Result = VSubjectPose::ENoData;
 
-      for( const auto& Pair : m_Data )
+      for( auto& Pair : m_Data )
       {
-        std::shared_ptr< const VSubjectPose > pPose;
-        const auto& rData = Pair.second;
-        if( rData.size() >= 2 )
+        auto& rTrack = Pair.second;
+        auto& rpPose = m_LatestOutputPoses[ Pair.first ];
+        rpPose.reset();
+
+        if( rTrack.SampleCount() >= 2 )
         {
-          pPose = Predict( rData.front(), rData.back(), i_rTime );
+          // Write into the slot not published last time, unless a caller is still holding on to it
+          const unsigned int Slot = rTrack.m_OutputIndex ^ 1;
+          if( !rTrack.m_Outputs[ Slot ] || rTrack.m_Outputs[ Slot ].use_count() > 1 )
+          {
+            MakeOutput( rTrack, Slot, *rTrack.Newest().m_pInput );
+          }
+
+          const VSubjectPose::EResult PoseResult = Predict( rTrack, rTrack.Bracket( i_rTime ), i_rTime, *rTrack.m_Outputs[ Slot ], rTrack.m_OutputSegments[ Slot ] );
+          rTrack.m_OutputIndex = Slot;
+          rpPose = rTrack.m_Outputs[ Slot ];
 
           // Return success if prediction was successful for any of the subjects.
           // The individual poses will contain the result for that specific subject
-          if( pPose->Result == VSubjectPose::ESuccess )
+          if( PoseResult == VSubjectPose::ESuccess )
           {
-            Result = pPose->Result;
+            Result = PoseResult;
           }
         }
-
-        m_LatestOutputPoses[ Pair.first ] = pPose;
       }
 
       return Result;
@@ -337,10 +648,10 @@ namespace ViconDataStreamSDK
       auto DataIt = m_Data.find( i_rSubjectName );
       if( DataIt != m_Data.end() )
       {
-        if( !DataIt->second.empty() )
+        if( DataIt->second.SampleCount() != 0 )
         {
           // Use the most recent input data.
-          o_rpSubject = DataIt->second.back();
+          o_rpSubject = DataIt->second.Newest().m_pInput;
         }
 
         if( o_rpSubject )
@@ -356,6 +667,12 @@ namespace ViconDataStreamSDK
       return OutputResult;
     }
 
+    const std::shared_ptr< const VSubjectPose::TLatencies > & VSubjectPose::NoLatencies()
+    {
+      static const std::shared_ptr< const TLatencies > pNoLatencies = std::make_shared< const TLatencies >();
+      return pNoLatencies;
+    }
+
     bool VSubjectPose::operator==( const VSubjectPose& i_rOther )
     {
       bool bMatches = true;
@@ -364,7 +681,7 @@ namespace ViconDataStreamSDK
       bMatches = bMatches && ( i_rOther.Name == Name );
       bMatches = bMatches && ( i_rOther.RootSegment == RootSegment );
 
-      bMatches = bMatches && ( i_rOther.Latencies == Latencies );
+      bMatches = bMatches && ( i_rOther.Latencies == Latencies || *i_rOther.Latencies == *Latencies );
       bMatches = bMatches && ( i_rOther.FrameTime == FrameTime );
       bMatches = bMatches && ( i_rOther.FrameNumber == FrameNumber );
       bMatches = bMatches && ( i_rOther.ReceiptTime == ReceiptTime );
@@ -391,7 +708,7 @@ namespace ViconDataStreamSDK
     std::string VSubjectPose::OutputHeader( const std::shared_ptr< VSubjectPose >& i_rPose )
     {
       std::string HeaderString = "FrameNumber, Result, Frame Rate, ReceiptTime, #Latencies, ";
-      for( const auto Latency : i_rPose->Latencies )
+      for( const auto Latency : *i_rPose->Latencies )
       {
         HeaderString += Latency.first + ", ";
       }
@@ -409,9 +726,9 @@ namespace ViconDataStreamSDK
                 << i_Pose.Result << ", "
                 << i_Pose.FrameRate << ", "
                 << i_Pose.ReceiptTime << ", "
-                << i_Pose.Latencies.size() << ", ";
+                << i_Pose.Latencies->size() << ", ";
 
-      for( const auto LatencySample : i_Pose.Latencies )
+      for( const auto LatencySample : *i_Pose.Latencies )
       {
         o_rStream << LatencySample.second << ", ";
       }
@@ -514,7 +831,8 @@ namespace ViconDataStreamSDK
           m_pPostalService = std::make_shared< VCGStreamPostalService >();
         }
 
-        bSuccess = m_pPostalService->StartService();
+        // Log writes run in order on the process-wide executor, rather than on a thread of our own
+        bSuccess = m_pPostalService->StartService( VCGStreamExecutor::Shared( 1 ) );
       }
 
       return bSuccess;
@@ -559,6 +877,8 @@ namespace ViconDataStreamSDK
         bSuccess = m_DebugLog.good();
       }
 
+      m_bDebugLog = bSuccess;
+
       if( bSuccess )
       {
         if( !m_pPostalService )
@@ -566,7 +886,7 @@ namespace ViconDataStreamSDK
           m_pPostalService = std::make_shared< VCGStreamPostalService >();
         }
 
-        bSuccess = m_pPostalService->StartService();
+        bSuccess = m_pPostalService->StartService( VCGStreamExecutor::Shared( 1 ) );
       }
 
       return bSuccess;
@@ -576,6 +896,7 @@ namespace ViconDataStreamSDK
     {
       boost::mutex::scoped_lock LogLock( m_DebugLogMutex );
 
+      m_bDebugLog = false;
       if( m_DebugLog.is_open() )
       {
         m_DebugLog.close();
@@ -585,27 +906,17 @@ namespace ViconDataStreamSDK
     void VRetimingCore::PurgeOldData( double i_TimeNow )
     {
       boost::recursive_mutex::scoped_lock Lock( m_DataMutex );
-      std::vector< std::string > Subjects;
-      for( const auto& rSubject : m_Data )
-      {
-        Subjects.emplace_back(rSubject.first);
-      }
-
-      for( auto& rSubject : Subjects )
+      for( auto& rSubject : m_Data )
       {
-        auto& rPoses = m_Data[ rSubject ];
-        auto PoseIt = rPoses.begin();
-        while(  PoseIt != rPoses.end() )
+        // Samples are in order of receipt, so stale ones are at the front and any from the future at the back
+        auto& rTrack = rSubject.second;
+        while( rTrack.SampleCount() != 0 && ( i_TimeNow - rTrack.Sample( 0 ).ReceiptTime ) > s_PurgeLimit )
         {
-          auto pPose = *PoseIt;
-          if( !pPose || pPose->ReceiptTime > i_TimeNow || ( i_TimeNow - pPose->ReceiptTime ) > s_PurgeLimit )
-          {
-            PoseIt = rPoses.erase(PoseIt);
-          }
-          else
-          {
-            ++PoseIt;
-          }
+          rTrack.RemoveOldest();
+        }
+        while( rTrack.SampleCount() != 0 && rTrack.Newest().ReceiptTime > i_TimeNow )
+        {
+          rTrack.RemoveNewest();
         }
       }
     }
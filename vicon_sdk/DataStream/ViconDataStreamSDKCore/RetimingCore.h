@@ -29,6 +29,7 @@
 #include <boost/thread/mutex.hpp>
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <map>
@@ -40,6 +41,8 @@
 
 #include <ViconDataStreamSDKCoreUtils/Constants.h>
 
+#include "RetimerUtils.h"
+
 class VCGStreamPostalService;
 
 namespace ViconCGStreamClientSDK
@@ -130,6 +133,7 @@ namespace ViconDataStreamSDK
 
       VSubjectPose()
         : Result(EInvalid)
+        , Latencies( NoLatencies() )
         , FrameTime(0)
         , FrameNumber(0)
         , ReceiptTime(0)
@@ -143,11 +147,16 @@ namespace ViconDataStreamSDK
       std::string Name;
       std::string RootSegment;
 
-      std::map< std::string, double > Latencies;
+      typedef std::map< std::string, double > TLatencies;
+
+      // Shared by the poses of every subject in a frame; never null
+      std::shared_ptr< const TLatencies > Latencies;
+      static const std::shared_ptr< const TLatencies > & NoLatencies();
+
       double TotalLatency() const
       {
         double Total = 0;
-        for( const auto & rLatency : Latencies )
+        for( const auto & rLatency : *Latencies )
         {
           Total += rLatency.second;
         }
@@ -184,6 +193,12 @@ namespace ViconDataStreamSDK
       // Return the maximum prediction used by the system
       double MaximumPrediction() const;
 
+      // Set the model used to interpolate and predict poses
+      void SetPredictor( PredictorModel::Enum i_Predictor );
+
+      // Return the model used to interpolate and predict poses
+      PredictorModel::Enum Predictor() const;
+
       // Set a log file to write debug output about performance to
       bool SetDebugLogFile(const std::string & i_rLogFile);
 
@@ -210,16 +225,97 @@ namespace ViconDataStreamSDK
 
     private:
 
+      // The moving parts of one segment in an input sample
+      class VSegmentSample
+      {
+      public:
+        std::array< double, 3 > T;
+        std::array< double, 4 > R;
+        std::array< double, 3 > T_Rel;
+        std::array< double, 4 > R_Rel;
+        std::array< double, 3 > T_Stat;
+        std::array< double, 4 > R_Stat;
+        bool bOccluded;
+      };
+
+      // An input sample, with its segments in the order of the subject's segment names
+      class VPoseSample
+      {
+      public:
+        double ReceiptTime;
+        double FrameNumber;
+        std::shared_ptr< const VSubjectPose > m_pInput;
+        std::vector< VSegmentSample > m_Segments;
+      };
+
+      // Everything held for one subject. The segment order is fixed when the subject's topology is first seen,
+      // so that samples can be matched by index, and output poses are written into two slots which alternate
+      // between updates rather than being allocated each time.
+      class VSubjectTrack
+      {
+      public:
+        VSubjectTrack() : m_FirstSample( 0 ), m_SampleCount( 0 ), m_OutputIndex( 0 ) {}
+
+        // Samples in order of receipt, oldest first
+        std::size_t SampleCount() const { return m_SampleCount; }
+        const VPoseSample & Sample( std::size_t i_Index ) const { return m_Samples[ ( m_FirstSample + i_Index ) % m_Samples.size() ]; }
+        const VPoseSample & Newest() const { return Sample( m_SampleCount - 1 ); }
+
+        // Storage for a new newest sample, which replaces the oldest once the ring is full
+        VPoseSample & AddSample();
+        void RemoveOldest();
+        void RemoveNewest();
+        void ClearSamples();
+
+        // The first of the two samples to predict time i_Time from: those either side of it if there are any,
+        // otherwise the two nearest to it. Requires at least two samples.
+        std::size_t Bracket( double i_Time ) const;
+
+        std::vector< std::string > m_SegmentNames;
+
+        // Kalman filters for the translation coordinates of each segment, T then T_Rel; fed with every sample
+        // while the Kalman model is selected
+        std::vector< std::array< ClientUtils::VConstantAccelerationFilter, 6 > > m_Filters;
+
+        // Fixed size ring of samples, reused as samples arrive
+        std::vector< VPoseSample > m_Samples;
+        std::size_t m_FirstSample;
+        std::size_t m_SampleCount;
+
+        std::array< std::shared_ptr< VSubjectPose >, 2 > m_Outputs;
+        std::array< std::vector< VSegmentPose * >, 2 > m_OutputSegments;
+        unsigned int m_OutputIndex;
+      };
+
+      static bool SameTopology( const VSubjectTrack & i_rTrack, const VSubjectPose & i_rPose );
+      static void ResetTopology( VSubjectTrack & io_rTrack, const VSubjectPose & i_rPose );
+      static void ToSample( const std::shared_ptr< const VSubjectPose > & i_rpPose, VPoseSample & o_rSample );
+      static void MakeOutput( VSubjectTrack & io_rTrack, unsigned int i_Slot, const VSubjectPose & i_rTemplate );
+      static void UpdateFilters( VSubjectTrack & io_rTrack, const VPoseSample & i_rSample );
+
+      // Spline predictions from the samples either side of i_Time, and their neighbours if there are any
+      static ClientUtils::Displacement SplineTranslation( const VPoseSample * i_pSample0, const VPoseSample & i_rSample1, const VPoseSample & i_rSample2, const VPoseSample * i_pSample3,
+                                                          std::size_t i_Segment, std::array< double, 3 > VSegmentSample::* i_pTranslation, double i_Time );
+      static ClientUtils::Displacement ExtrapolateTranslation( const VPoseSample * i_pSample0, const VPoseSample & i_rSample1, const VPoseSample & i_rSample2,
+                                                               std::size_t i_Segment, std::array< double, 3 > VSegmentSample::* i_pTranslation, double i_Time );
+      static ClientUtils::Quaternion SquadRotation( const VPoseSample * i_pSample0, const VPoseSample & i_rSample1, const VPoseSample & i_rSample2, const VPoseSample * i_pSample3,
+                                                    std::size_t i_Segment, std::array< double, 4 > VSegmentSample::* i_pRotation, double i_Time );
+
+      // Predict from samples i_First and i_First + 1 of the track
+      VSubjectPose::EResult Predict( const VSubjectTrack & i_rTrack, std::size_t i_First, double i_Time, VSubjectPose & o_rOutput, const std::vector< VSegmentPose * > & i_rOutputSegments ) const;
+
       void PurgeOldData( double i_TimeNow );
 
       mutable boost::recursive_mutex m_DataMutex;
-      std::map< std::string, std::deque< std::shared_ptr< const VSubjectPose > > > m_Data;
+      std::map< std::string, VSubjectTrack > m_Data;
       std::map< std::string, std::shared_ptr< const VSubjectPose > > m_LatestOutputPoses;
 
 
       // Maximum time we should predict forwards (in milliseconds)
       double m_MaxPredictionTime;
 
+      PredictorModel::Enum m_Predictor;
+
       // Postal service for logging
       std::shared_ptr< VCGStreamPostalService > m_pPostalService;
 
@@ -239,6 +335,9 @@ namespace ViconDataStreamSDK
       void CloseDebugLog();
       mutable boost::mutex m_DebugLogMutex;
       mutable std::ofstream m_DebugLog;
+
+      // Checked before formatting debug messages, so that nothing is formatted unless a debug log is open
+      std::atomic< bool > m_bDebugLog;
     };
 
 
@@ -133,8 +133,10 @@ void VSegmentPoseReader::GenerateTestData(unsigned int i_NumFrames, double i_Fra
     pPose->FrameRate = i_FrameRate;
     pPose->Name = SubjectName;
     double FramePeriod = 1.0 / i_FrameRate * 1000;
-    pPose->Latencies[ "Network" ] = ClientUtils::JitterVal( JitterGenerator, i_TransmissionLatency, i_TransmissionJitter, i_TransmissionSpike, i_TransmissionSpikeFrequency );
-    pPose->Latencies[ "Processing" ] = ClientUtils::JitterVal(JitterGenerator, FramePeriod, FramePeriod / 10.0, 0.0, 0 );
+    std::shared_ptr< VSubjectPose::TLatencies > pLatencies = std::make_shared< VSubjectPose::TLatencies >();
+    ( *pLatencies )[ "Network" ] = ClientUtils::JitterVal( JitterGenerator, i_TransmissionLatency, i_TransmissionJitter, i_TransmissionSpike, i_TransmissionSpikeFrequency );
+    ( *pLatencies )[ "Processing" ] = ClientUtils::JitterVal(JitterGenerator, FramePeriod, FramePeriod / 10.0, 0.0, 0 );
+    pPose->Latencies = pLatencies;
     pPose->FrameTime = static_cast<double>(FrameNum) / i_FrameRate * 1000.0;
     pPose->ReceiptTime = pPose->FrameTime + pPose->TotalLatency();
 
@@ -200,6 +202,7 @@ std::shared_ptr< VSubjectPose > VSegmentPoseReader::ReadLine(const std::string &
     bOK = bOK && ReadValue<double>(Tokens[TokenIndex++], pPose->FrameRate);
     bOK = bOK && ReadValue<double>(Tokens[TokenIndex++], pPose->ReceiptTime);
     unsigned int NumLatencies = 0;
+    std::shared_ptr< VSubjectPose::TLatencies > pLatencies = std::make_shared< VSubjectPose::TLatencies >();
     bOK = bOK && ReadValue<unsigned int >(Tokens[TokenIndex++ ], NumLatencies );
     for( unsigned int LatencyIndex = 0; LatencyIndex < NumLatencies; ++LatencyIndex )
     {
@@ -210,8 +213,9 @@ std::shared_ptr< VSubjectPose > VSegmentPoseReader::ReadLine(const std::string &
         LatencyType = i_rHeaderItems[TokenIndex];
       }
       bOK = bOK && ReadValue< double >( Tokens[ TokenIndex++ ], Latency );
-      if( bOK ) pPose->Latencies[LatencyType] = Latency;
+      if( bOK ) ( *pLatencies )[LatencyType] = Latency;
     }
+    pPose->Latencies = pLatencies;
     bOK = bOK && ReadValue< std::string >(Tokens[TokenIndex++], pPose->Name);
     bOK = bOK && ReadValue< std::string >(Tokens[TokenIndex++], pPose->RootSegment);
 
@@ -72,6 +72,25 @@ namespace StreamMode
   };
 }
 
+namespace BufferDropPolicy
+{
+  enum Enum
+  {
+    DropOldest,
+    DropNewest
+  };
+}
+
+namespace PredictorModel
+{
+  enum Enum
+  {
+    Linear,
+    Spline,
+    Kalman
+  };
+}
+
 namespace TimecodeStandard
 {
   enum Enum
@@ -25,9 +25,44 @@
 #include "CClient.h"
 #include <ViconDataStreamSDK_CPP/DataStreamClient.h>
 #include <cstring>
+#include <memory>
 
 using namespace ViconDataStreamSDK::CPP;
 
+namespace
+{
+  // The bulk calls write occlusion flags as bool, which is not CBool, so they are staged and then copied across.
+  // Flags for small buffers are staged on the stack.
+  class VOccludedFlags
+  {
+  public:
+    explicit VOccludedFlags( unsigned int i_Capacity )
+    : m_pHeapFlags( i_Capacity > s_LocalCount ? new bool[ i_Capacity ] : nullptr )
+    {
+    }
+
+    bool * Data()
+    {
+      return m_pHeapFlags ? m_pHeapFlags.get() : m_LocalFlags;
+    }
+
+    void CopyTo( CBool * o_pFlags, unsigned int i_Count )
+    {
+      const bool * pFlags = Data();
+      for( unsigned int i = 0; i < i_Count; ++i )
+      {
+        o_pFlags[ i ] = pFlags[ i ];
+      }
+    }
+
+  private:
+    static const unsigned int s_LocalCount = 256;
+
+    bool m_LocalFlags[ s_LocalCount ];
+    std::unique_ptr< bool[] > m_pHeapFlags;
+  };
+}
+
 
 #ifdef _WIN32
 #define snprintf(str,size,format,arg) _snprintf_s(str,size,_TRUNCATE,format,arg)
@@ -187,6 +222,11 @@ CEnum Client_GetFrame(CClient* client)
   return ((Client*) client)->GetFrame().Result;
 }
 
+CEnum Client_WaitForFrame(CClient* client, unsigned int TimeoutMs)
+{
+  return ((Client*) client)->WaitForFrame( TimeoutMs ).Result;
+}
+
 void Client_GetFrameNumber(CClient* client, COutput_GetFrameNumber* outptr)
 {
   const Output_GetFrameNumber& outp = ((Client*) client)->GetFrameNumber();
@@ -395,6 +435,25 @@ void Client_GetSegmentGlobalRotationQuaternion(CClient* client, CString  Subject
 }
 
 
+void Client_GetAllSegmentGlobalPoses(CClient* client, const CSegmentGlobalPoses* poses,
+                                     COutput_GetAllSegmentGlobalPoses* outptr )
+{
+  VOccludedFlags Occluded( poses->Capacity );
+
+  SegmentGlobalPoses Poses;
+  Poses.Capacity = poses->Capacity;
+  Poses.Handles = poses->Handles;
+  Poses.Translations = poses->Translations;
+  Poses.Rotations = poses->Rotations;
+  Poses.Occluded = Occluded.Data();
+
+  const Output_GetAllSegmentGlobalPoses& outp = ((Client*) client)->GetAllSegmentGlobalPoses( Poses );
+  outptr->Result = outp.Result;
+  outptr->SegmentCount = outp.SegmentCount;
+
+  Occluded.CopyTo( poses->Occluded, outp.SegmentCount < poses->Capacity ? outp.SegmentCount : poses->Capacity );
+}
+
 void Client_GetSegmentGlobalRotationEulerXYZ(CClient* client, CString  SubjectName,
                                              CString  SegmentName, COutput_GetSegmentGlobalRotationEulerXYZ* outptr )
 {
@@ -506,6 +565,31 @@ void Client_GetUnlabeledMarkerGlobalTranslation(CClient* client, unsigned int Ma
   std::memcpy(outptr->Translation,outp.Translation,sizeof(outptr->Translation));
 }
 
+void Client_GetAllMarkerGlobalTranslations(CClient* client, const CMarkerGlobalTranslations* buffers,
+                                           COutput_GetAllMarkerGlobalTranslations* outptr )
+{
+  VOccludedFlags Occluded( buffers->LabeledCapacity );
+
+  MarkerGlobalTranslations Buffers;
+  Buffers.LabeledCapacity = buffers->LabeledCapacity;
+  Buffers.SubjectIndices = buffers->SubjectIndices;
+  Buffers.SegmentIndices = buffers->SegmentIndices;
+  Buffers.MarkerIndices = buffers->MarkerIndices;
+  Buffers.Translations = buffers->Translations;
+  Buffers.Occluded = Occluded.Data();
+  Buffers.UnlabeledCapacity = buffers->UnlabeledCapacity;
+  Buffers.UnlabeledTranslations = buffers->UnlabeledTranslations;
+  Buffers.UnlabeledMarkerIDs = buffers->UnlabeledMarkerIDs;
+
+  const Output_GetAllMarkerGlobalTranslations& outp = ((Client*) client)->GetAllMarkerGlobalTranslations( Buffers );
+  outptr->Result = outp.Result;
+  outptr->LabeledMarkerCount = outp.LabeledMarkerCount;
+  outptr->UnlabeledMarkerCount = outp.UnlabeledMarkerCount;
+  outptr->LayoutGeneration = outp.LayoutGeneration;
+
+  Occluded.CopyTo( buffers->Occluded, outp.LabeledMarkerCount < buffers->LabeledCapacity ? outp.LabeledMarkerCount : buffers->LabeledCapacity );
+}
+
 void Client_GetDeviceCount(CClient* client, COutput_GetDeviceCount* outptr)
 {
   const Output_GetDeviceCount& outp = ((Client*) client)->GetDeviceCount();
@@ -771,6 +855,61 @@ void Client_SetBufferSize( CClient* client, unsigned int bufferSize )
   ( (Client*)client )->DisableDebugData();
 }
 
+void Client_SetBufferDropPolicy( CClient* client, CEnum dropPolicy )
+{
+  ( (Client*)client )->SetBufferDropPolicy( (BufferDropPolicy::Enum) dropPolicy );
+}
+
+void Client_SetLazyDecoding( CClient* client, CBool lazy )
+{
+  ( (Client*)client )->SetLazyDecoding( lazy != 0 );
+}
+
+void Client_SetMulticastReceiveOptions( CClient* client, unsigned int socketBufferSize, unsigned int batchSize, unsigned int spinMicroseconds )
+{
+  ( (Client*)client )->SetMulticastReceiveOptions( socketBufferSize, batchSize, spinMicroseconds );
+}
+
+void Client_SetExecutorThreads( CClient* client, unsigned int threadCount )
+{
+  ( (Client*)client )->SetExecutorThreads( threadCount );
+}
+
+void Client_GetReceiveStats( CClient* client, COutput_GetReceiveStats* outptr )
+{
+  const Output_GetReceiveStats& outp = ( (Client*)client )->GetReceiveStats();
+  outptr->Result = outp.Result;
+  outptr->DatagramsReceived = outp.DatagramsReceived;
+  outptr->DatagramsDropped = outp.DatagramsDropped;
+  outptr->DatagramsTruncated = outp.DatagramsTruncated;
+  outptr->BatchesReceived = outp.BatchesReceived;
+  outptr->BatchesFull = outp.BatchesFull;
+  outptr->SocketBufferSize = outp.SocketBufferSize;
+  outptr->BufferOverruns = outp.BufferOverruns;
+  outptr->BufferHighWaterMark = outp.BufferHighWaterMark;
+}
+
+void Client_GetLinkCount( CClient* client, COutput_GetLinkCount* outptr )
+{
+  const Output_GetLinkCount& outp = ( (Client*)client )->GetLinkCount();
+  outptr->Result = outp.Result;
+  outptr->LinkCount = outp.LinkCount;
+}
+
+void Client_GetLinkStats( CClient* client, unsigned int linkIndex, COutput_GetLinkStats* outptr )
+{
+  const Output_GetLinkStats& outp = ( (Client*)client )->GetLinkStats( linkIndex );
+  outptr->Result = outp.Result;
+  outptr->Connected = outp.Connected;
+  outptr->FramesReceived = outp.FramesReceived;
+  outptr->FramesFirst = outp.FramesFirst;
+  outptr->FramesLate = outp.FramesLate;
+  outptr->FramesStale = outp.FramesStale;
+  outptr->FramesLost = outp.FramesLost;
+  outptr->MeanLag = outp.MeanLag;
+  outptr->MaxLag = outp.MaxLag;
+}
+
 
 void Client_GetServerOrientation( CClient* client, COutput_GetServerOrientation* outptr )
 {
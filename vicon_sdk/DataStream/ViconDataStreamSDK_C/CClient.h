@@ -134,6 +134,7 @@ CDLL_EXPORT CEnum Client_SetAxisMapping(CClient* client, CEnum XAxis, CEnum YAxi
 CDLL_EXPORT void Client_GetAxisMapping(CClient* client, COutput_GetAxisMapping* outptr);
 
 CDLL_EXPORT CEnum Client_GetFrame(CClient* client);
+CDLL_EXPORT CEnum Client_WaitForFrame(CClient* client, unsigned int TimeoutMs);
 CDLL_EXPORT void Client_GetFrameNumber(CClient* client, COutput_GetFrameNumber* outptr);
 
 CDLL_EXPORT void Client_GetTimecode(CClient* client, COutput_GetTimecode* outptr);
@@ -199,6 +200,9 @@ CDLL_EXPORT void Client_GetSegmentGlobalRotationQuaternion(CClient* client, CStr
 CDLL_EXPORT void Client_GetSegmentGlobalRotationEulerXYZ(CClient* client, CString  SubjectName,
                                                           CString  SegmentName, COutput_GetSegmentGlobalRotationEulerXYZ* outptr );
 
+CDLL_EXPORT void Client_GetAllSegmentGlobalPoses(CClient* client, const CSegmentGlobalPoses* poses,
+                                                 COutput_GetAllSegmentGlobalPoses* outptr );
+
 CDLL_EXPORT void Client_GetSegmentLocalTranslation(CClient* client, CString  SubjectName,
                                                     CString  SegmentName, COutput_GetSegmentLocalTranslation* outptr );
 
@@ -230,6 +234,9 @@ CDLL_EXPORT void Client_GetUnlabeledMarkerCount(CClient* client, COutput_GetUnla
 CDLL_EXPORT void Client_GetUnlabeledMarkerGlobalTranslation(CClient* client, unsigned int MarkerIndex, 
                       COutput_GetUnlabeledMarkerGlobalTranslation* outptr );
 
+CDLL_EXPORT void Client_GetAllMarkerGlobalTranslations(CClient* client, const CMarkerGlobalTranslations* buffers,
+                                                       COutput_GetAllMarkerGlobalTranslations* outptr );
+
 CDLL_EXPORT void Client_GetDeviceCount(CClient* client, COutput_GetDeviceCount* outptr);
 CDLL_EXPORT CEnum  Client_GetDeviceName(CClient* client, unsigned int DeviceIndex, 
                   int sizeOfBuffer, char* outstr, CEnum* DeviceType );
@@ -302,6 +309,13 @@ CDLL_EXPORT CBool Client_IsGreyscaleDataEnabled( CClient* client );
 CDLL_EXPORT CBool Client_IsVideoDataEnabled( CClient* client );
 CDLL_EXPORT CBool Client_IsDebugDataEnabled( CClient* client );
 CDLL_EXPORT void Client_SetBufferSize( CClient* client, unsigned int bufferSize );
+CDLL_EXPORT void Client_SetBufferDropPolicy( CClient* client, CEnum dropPolicy );
+CDLL_EXPORT void Client_SetLazyDecoding( CClient* client, CBool lazy );
+CDLL_EXPORT void Client_SetMulticastReceiveOptions( CClient* client, unsigned int socketBufferSize, unsigned int batchSize, unsigned int spinMicroseconds );
+CDLL_EXPORT void Client_GetReceiveStats( CClient* client, COutput_GetReceiveStats* outptr );
+CDLL_EXPORT void Client_GetLinkCount( CClient* client, COutput_GetLinkCount* outptr );
+CDLL_EXPORT void Client_GetLinkStats( CClient* client, unsigned int linkIndex, COutput_GetLinkStats* outptr );
+CDLL_EXPORT void Client_SetExecutorThreads( CClient* client, unsigned int threadCount );
 
 CDLL_EXPORT void Client_GetServerOrientation( CClient* client, COutput_GetServerOrientation* outptr );
 CDLL_EXPORT void Client_GetHardwareFrameNumber( CClient* client, COutput_GetHardwareFrameNumber* outptr );
@@ -387,6 +387,37 @@ CReal RetimingClient_MaximumPrediction( CRetimingClient* client )
   return ((RetimingClient*)client)->MaximumPrediction();
 }
 
+void RetimingClient_SetPredictor( CRetimingClient* client, CEnum i_Predictor )
+{
+  ((RetimingClient*)client)->SetPredictor( (PredictorModel::Enum) i_Predictor );
+}
+
+CEnum RetimingClient_Predictor( CRetimingClient* client )
+{
+  return ((RetimingClient*)client)->Predictor();
+}
+
+CEnum RetimingClient_SetOutputThreadOptions( CRetimingClient* client, unsigned int i_Priority, int i_Cpu )
+{
+  Output_SetOutputThreadOptions outpt = ((RetimingClient*)client)->SetOutputThreadOptions( i_Priority, i_Cpu );
+  return outpt.Result;
+}
+
+void RetimingClient_GetOutputJitter( CRetimingClient* client, COutput_GetOutputJitter* outptr )
+{
+  const Output_GetOutputJitter& outp = ((RetimingClient*)client)->GetOutputJitter();
+  outptr->Result = outp.Result;
+  outptr->FrameCount = outp.FrameCount;
+  outptr->MissedFrames = outp.MissedFrames;
+  outptr->Mean = outp.Mean;
+  outptr->Median = outp.Median;
+  outptr->Percentile90 = outp.Percentile90;
+  outptr->Percentile99 = outp.Percentile99;
+  outptr->Percentile999 = outp.Percentile999;
+  outptr->Maximum = outp.Maximum;
+  outptr->RealTime = outp.RealTime;
+}
+
 CEnum RetimingClient_ClearSubjectFilter(CRetimingClient* client )
 {
   Output_ClearSubjectFilter outpt = ( ( RetimingClient*)client )->ClearSubjectFilter();
@@ -149,6 +149,12 @@ CDLL_EXPORT CReal RetimingClient_OutputLatency( CRetimingClient* client );
 CDLL_EXPORT void RetimingClient_SetMaximumPrediction( CRetimingClient* client, CReal i_MaxPrediction );
 CDLL_EXPORT CReal RetimingClient_MaximumPrediction( CRetimingClient* client );
 
+CDLL_EXPORT void RetimingClient_SetPredictor( CRetimingClient* client, CEnum i_Predictor );
+CDLL_EXPORT CEnum RetimingClient_Predictor( CRetimingClient* client );
+
+CDLL_EXPORT CEnum RetimingClient_SetOutputThreadOptions( CRetimingClient* client, unsigned int i_Priority, int i_Cpu );
+CDLL_EXPORT void RetimingClient_GetOutputJitter( CRetimingClient* client, COutput_GetOutputJitter* outptr );
+
 CDLL_EXPORT CEnum RetimingClient_ClearSubjectFilter( CClient* client );
 CDLL_EXPORT CEnum RetimingClient_AddToSubjectFilter( CClient* client, CString i_rSubjectName );
 
@@ -235,6 +235,56 @@ typedef struct COutput_GetLatencyTotal
   double       Total;
 } COutput_GetLatencyTotal;
 
+/** @private */
+typedef struct COutput_GetReceiveStats
+{
+  CEnum Result;
+  unsigned long long DatagramsReceived;
+  unsigned long long DatagramsDropped;
+  unsigned long long DatagramsTruncated;
+  unsigned long long BatchesReceived;
+  unsigned long long BatchesFull;
+  unsigned long long SocketBufferSize;
+  unsigned long long BufferOverruns;
+  unsigned int BufferHighWaterMark;
+} COutput_GetReceiveStats;
+
+/** @private */
+typedef struct COutput_GetLinkCount
+{
+  CEnum Result;
+  unsigned int LinkCount;
+} COutput_GetLinkCount;
+
+/** @private */
+typedef struct COutput_GetLinkStats
+{
+  CEnum Result;
+  CBool Connected;
+  unsigned long long FramesReceived;
+  unsigned long long FramesFirst;
+  unsigned long long FramesLate;
+  unsigned long long FramesStale;
+  unsigned long long FramesLost;
+  double MeanLag;
+  double MaxLag;
+} COutput_GetLinkStats;
+
+/** @private */
+typedef struct COutput_GetOutputJitter
+{
+  CEnum Result;
+  unsigned long long FrameCount;
+  unsigned long long MissedFrames;
+  double Mean;
+  double Median;
+  double Percentile90;
+  double Percentile99;
+  double Percentile999;
+  double Maximum;
+  CBool RealTime;
+} COutput_GetOutputJitter;
+
 /** @private */
 typedef struct COutput_GetSubjectCount
 {
@@ -338,6 +388,23 @@ typedef struct COutput_GetSegmentGlobalRotationEulerXYZ
   CBool         Occluded;
 } COutput_GetSegmentGlobalRotationEulerXYZ;
 
+/** Caller-owned arrays for Client_GetAllSegmentGlobalPoses. Each must have room for Capacity segments. */
+typedef struct CSegmentGlobalPoses
+{
+  unsigned int        Capacity;
+  unsigned long long* Handles;
+  double*             Translations;
+  double*             Rotations;
+  CBool*              Occluded;
+} CSegmentGlobalPoses;
+
+/** @private */
+typedef struct COutput_GetAllSegmentGlobalPoses
+{
+  CEnum Result;
+  unsigned int SegmentCount;
+} COutput_GetAllSegmentGlobalPoses;
+
 /** @private */
 typedef struct COutput_GetSegmentLocalTranslation
 {
@@ -408,6 +475,30 @@ typedef struct COutput_GetUnlabeledMarkerGlobalTranslation
   unsigned int MarkerID;
 } COutput_GetUnlabeledMarkerGlobalTranslation;
 
+/** Caller-owned arrays for Client_GetAllMarkerGlobalTranslations. */
+typedef struct CMarkerGlobalTranslations
+{
+  unsigned int  LabeledCapacity;
+  unsigned int* SubjectIndices;
+  unsigned int* SegmentIndices;
+  unsigned int* MarkerIndices;
+  double*       Translations;
+  CBool*        Occluded;
+
+  unsigned int  UnlabeledCapacity;
+  double*       UnlabeledTranslations;
+  unsigned int* UnlabeledMarkerIDs;
+} CMarkerGlobalTranslations;
+
+/** @private */
+typedef struct COutput_GetAllMarkerGlobalTranslations
+{
+  CEnum Result;
+  unsigned int LabeledMarkerCount;
+  unsigned int UnlabeledMarkerCount;
+  unsigned int LayoutGeneration;
+} COutput_GetAllMarkerGlobalTranslations;
+
 /** @private */
 typedef struct COutput_GetDeviceCount
 {
@@ -664,6 +755,21 @@ typedef enum
   ServerPush
 } CStreamMode;
 
+/** @private */
+typedef enum
+{
+  DropOldest,
+  DropNewest
+} CBufferDropPolicy;
+
+/** @private */
+typedef enum
+{
+  Linear,
+  Spline,
+  Kalman
+} CPredictorModel;
+
 /** @private */
 typedef enum
 {
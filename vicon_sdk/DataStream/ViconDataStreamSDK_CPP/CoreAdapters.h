@@ -93,6 +93,41 @@ inline ViconDataStreamSDK::Core::StreamMode::Enum Adapt(ViconDataStreamSDK::CPP:
   }
 }
 
+// This function is provided to insulate us from changes to ViconDataStreamSDK::CPP::BufferDropPolicy::Enum 
+inline ViconDataStreamSDK::Core::BufferDropPolicy::Enum Adapt(ViconDataStreamSDK::CPP::BufferDropPolicy::Enum i_DropPolicy)
+{
+  switch (i_DropPolicy)
+  {
+  default:
+  case ViconDataStreamSDK::CPP::BufferDropPolicy::DropOldest: return ViconDataStreamSDK::Core::BufferDropPolicy::DropOldest;
+  case ViconDataStreamSDK::CPP::BufferDropPolicy::DropNewest: return ViconDataStreamSDK::Core::BufferDropPolicy::DropNewest;
+  }
+}
+
+// This function is provided to insulate us from changes to ViconDataStreamSDK::CPP::PredictorModel::Enum 
+inline ViconDataStreamSDK::Core::PredictorModel::Enum Adapt(ViconDataStreamSDK::CPP::PredictorModel::Enum i_Predictor)
+{
+  switch (i_Predictor)
+  {
+  default:
+  case ViconDataStreamSDK::CPP::PredictorModel::Linear: return ViconDataStreamSDK::Core::PredictorModel::Linear;
+  case ViconDataStreamSDK::CPP::PredictorModel::Spline: return ViconDataStreamSDK::Core::PredictorModel::Spline;
+  case ViconDataStreamSDK::CPP::PredictorModel::Kalman: return ViconDataStreamSDK::Core::PredictorModel::Kalman;
+  }
+}
+
+// This function is provided to insulate us from changes to ViconDataStreamSDK::Core::PredictorModel::Enum 
+inline ViconDataStreamSDK::CPP::PredictorModel::Enum Adapt(ViconDataStreamSDK::Core::PredictorModel::Enum i_Predictor)
+{
+  switch (i_Predictor)
+  {
+  default:
+  case ViconDataStreamSDK::Core::PredictorModel::Linear: return ViconDataStreamSDK::CPP::PredictorModel::Linear;
+  case ViconDataStreamSDK::Core::PredictorModel::Spline: return ViconDataStreamSDK::CPP::PredictorModel::Spline;
+  case ViconDataStreamSDK::Core::PredictorModel::Kalman: return ViconDataStreamSDK::CPP::PredictorModel::Kalman;
+  }
+}
+
 // This function is provided to insulate us from changes to ViconDataStreamSDK::Core::Result::Enum 
 inline ViconDataStreamSDK::CPP::Result::Enum Adapt(ViconDataStreamSDK::Core::Result::Enum i_Result)
 {
@@ -160,6 +160,106 @@ namespace CPP
   {
     m_pClientImpl->m_pCoreClient->SetBufferSize( i_BufferSize );
   }
+
+  // SetBufferDropPolicy
+  CLASS_DECLSPEC
+  void Client::SetBufferDropPolicy( const BufferDropPolicy::Enum i_DropPolicy )
+  {
+    m_pClientImpl->m_pCoreClient->SetBufferDropPolicy( Adapt( i_DropPolicy ) );
+  }
+
+  // SetLazyDecoding
+  CLASS_DECLSPEC
+  void Client::SetLazyDecoding( bool i_bLazy )
+  {
+    m_pClientImpl->m_pCoreClient->SetLazyDecoding( i_bLazy );
+  }
+
+  // SetMulticastReceiveOptions
+  CLASS_DECLSPEC
+  void Client::SetMulticastReceiveOptions( unsigned int i_SocketBufferSize, unsigned int i_BatchSize, unsigned int i_SpinMicroseconds )
+  {
+    m_pClientImpl->m_pCoreClient->SetMulticastReceiveOptions( i_SocketBufferSize, i_BatchSize, i_SpinMicroseconds );
+  }
+
+  // SetExecutorThreads
+  CLASS_DECLSPEC
+  void Client::SetExecutorThreads( unsigned int i_ThreadCount )
+  {
+    m_pClientImpl->m_pCoreClient->SetExecutorThreads( i_ThreadCount );
+  }
+
+  // GetReceiveStats
+  CLASS_DECLSPEC
+  Output_GetReceiveStats Client::GetReceiveStats() const
+  {
+    Output_GetReceiveStats Output;
+    VMulticastReceiveStats Stats;
+    ViconCGStreamClientSDK::VFrameQueueStats BufferStats;
+    Output.Result = Adapt( m_pClientImpl->m_pCoreClient->GetReceiveStats( Stats, BufferStats ) );
+    Output.DatagramsReceived = Stats.m_DatagramsReceived;
+    Output.DatagramsDropped = Stats.m_DatagramsDropped;
+    Output.DatagramsTruncated = Stats.m_DatagramsTruncated;
+    Output.BatchesReceived = Stats.m_BatchesReceived;
+    Output.BatchesFull = Stats.m_BatchesFull;
+    Output.SocketBufferSize = Stats.m_SocketBufferSize;
+    Output.BufferOverruns = BufferStats.m_Dropped;
+    Output.BufferHighWaterMark = BufferStats.m_HighWaterMark;
+
+    return Output;
+  }
+
+  // GetLinkCount
+  CLASS_DECLSPEC
+  Output_GetLinkCount Client::GetLinkCount() const
+  {
+    Output_GetLinkCount Output;
+    std::vector< ViconCGStreamClientSDK::VLinkStats > Stats;
+    Output.Result = Adapt( m_pClientImpl->m_pCoreClient->GetLinkStats( Stats ) );
+    Output.LinkCount = static_cast< unsigned int >( Stats.size() );
+
+    return Output;
+  }
+
+  // GetLinkStats
+  CLASS_DECLSPEC
+  Output_GetLinkStats Client::GetLinkStats( const unsigned int i_LinkIndex ) const
+  {
+    Output_GetLinkStats Output;
+    Output.Connected = false;
+    Output.FramesReceived = 0;
+    Output.FramesFirst = 0;
+    Output.FramesLate = 0;
+    Output.FramesStale = 0;
+    Output.FramesLost = 0;
+    Output.MeanLag = 0.0;
+    Output.MaxLag = 0.0;
+
+    std::vector< ViconCGStreamClientSDK::VLinkStats > Stats;
+    Output.Result = Adapt( m_pClientImpl->m_pCoreClient->GetLinkStats( Stats ) );
+    if( Output.Result != Result::Success )
+    {
+      return Output;
+    }
+
+    if( i_LinkIndex >= Stats.size() )
+    {
+      Output.Result = Result::InvalidIndex;
+      return Output;
+    }
+
+    const ViconCGStreamClientSDK::VLinkStats & rStats = Stats[ i_LinkIndex ];
+    Output.Connected = rStats.m_bConnected;
+    Output.FramesReceived = rStats.m_FramesReceived;
+    Output.FramesFirst = rStats.m_FramesFirst;
+    Output.FramesLate = rStats.m_FramesLate;
+    Output.FramesStale = rStats.m_FramesStale;
+    Output.FramesLost = rStats.m_FramesLost;
+    Output.MeanLag = rStats.m_FramesLate ? static_cast< double >( rStats.m_TotalLagMicroseconds ) / rStats.m_FramesLate / 1e6 : 0.0;
+    Output.MaxLag = static_cast< double >( rStats.m_MaxLagMicroseconds ) / 1e6;
+
+    return Output;
+  }
   
   // EnableSegmentData
   CLASS_DECLSPEC
@@ -524,6 +624,34 @@ namespace CPP
     return Output;
   }
 
+  // WaitForFrame
+  CLASS_DECLSPEC
+  Output_WaitForFrame Client::WaitForFrame( unsigned int TimeoutMs )
+  {
+    Output_WaitForFrame Output;
+    Output.Result = Adapt( m_pClientImpl->m_pCoreClient->WaitForFrame( TimeoutMs ) );
+
+    return Output;
+  }
+
+  // SetFrameCallback
+  CLASS_DECLSPEC
+  Output_SetFrameCallback Client::SetFrameCallback( FrameCallback Callback, void * pUserData )
+  {
+    if( Callback )
+    {
+      m_pClientImpl->m_pCoreClient->SetFrameCallback( [Callback, pUserData]( unsigned int FrameNumber ){ Callback( FrameNumber, pUserData ); } );
+    }
+    else
+    {
+      m_pClientImpl->m_pCoreClient->SetFrameCallback( nullptr );
+    }
+
+    Output_SetFrameCallback Output;
+    Output.Result = Result::Success;
+    return Output;
+  }
+
   // GetFrameNumber
   CLASS_DECLSPEC
   Output_GetFrameNumber Client::GetFrameNumber() const
@@ -818,6 +946,47 @@ namespace CPP
     return Output;
   }
 
+  // GetSegmentHandle
+  CLASS_DECLSPEC
+  Output_GetSegmentHandle Client::GetSegmentHandle( const String & SubjectName,
+                                                    const String & SegmentName ) const
+  {
+    Output_GetSegmentHandle Output;
+    ViconCGStreamType::UInt64 Handle = 0;
+    Output.Result = Adapt( m_pClientImpl->m_pCoreClient->GetSegmentHandle( SubjectName, SegmentName, Handle ) );
+    Output.Handle = Handle;
+
+    return Output;
+  }
+
+  // GetSegmentGlobalPose
+  CLASS_DECLSPEC
+  Output_GetSegmentGlobalPose Client::GetSegmentGlobalPose( const SegmentHandle Handle ) const
+  {
+    Output_GetSegmentGlobalPose Output;
+    Output.Result = Adapt( m_pClientImpl->m_pCoreClient->GetSegmentGlobalPose( Handle,
+                                                                               Output.Translation,
+                                                                               Output.Rotation,
+                                                                               Output.Occluded ) );
+
+    return Output;
+  }
+
+  // GetAllSegmentGlobalPoses
+  CLASS_DECLSPEC
+  Output_GetAllSegmentGlobalPoses Client::GetAllSegmentGlobalPoses( const SegmentGlobalPoses & Poses ) const
+  {
+    Output_GetAllSegmentGlobalPoses Output;
+    Output.Result = Adapt( m_pClientImpl->m_pCoreClient->GetAllSegmentGlobalPoses( Poses.Capacity,
+                                                                                   Poses.Handles,
+                                                                                   Poses.Translations,
+                                                                                   Poses.Rotations,
+                                                                                   Poses.Occluded,
+                                                                                   Output.SegmentCount ) );
+
+    return Output;
+  }
+
   // GetSegmentStaticTranslation
   CLASS_DECLSPEC
   Output_GetSegmentStaticTranslation Client::GetSegmentStaticTranslation( const String & SubjectName,
@@ -1087,6 +1256,27 @@ namespace CPP
     return Output;
   }
 
+  // GetAllMarkerGlobalTranslations
+  CLASS_DECLSPEC
+  Output_GetAllMarkerGlobalTranslations Client::GetAllMarkerGlobalTranslations( const MarkerGlobalTranslations & Buffers ) const
+  {
+    Output_GetAllMarkerGlobalTranslations Output;
+    Output.Result = Adapt( m_pClientImpl->m_pCoreClient->GetAllMarkerGlobalTranslations( Buffers.LabeledCapacity,
+                                                                                         Buffers.SubjectIndices,
+                                                                                         Buffers.SegmentIndices,
+                                                                                         Buffers.MarkerIndices,
+                                                                                         Buffers.Translations,
+                                                                                         Buffers.Occluded,
+                                                                                         Output.LabeledMarkerCount,
+                                                                                         Buffers.UnlabeledCapacity,
+                                                                                         Buffers.UnlabeledTranslations,
+                                                                                         Buffers.UnlabeledMarkerIDs,
+                                                                                         Output.UnlabeledMarkerCount,
+                                                                                         Output.LayoutGeneration ) );
+
+    return Output;
+  }
+
   // GetDeviceCount
   CLASS_DECLSPEC
   Output_GetDeviceCount Client::GetDeviceCount() const
@@ -64,6 +64,9 @@ namespace CPP
   class CLASS_DECLSPEC Client : public IDataStreamClientBase
   {
   public:
+    /// Signature of the function passed to SetFrameCallback().
+    typedef void ( *FrameCallback )( unsigned int FrameNumber, void * pUserData );
+
     /// Construction.
     /// You can create many instances of the Vicon DataStream Client which can connect to multiple Vicon DataStream Servers.
     ///
@@ -1689,6 +1692,284 @@ namespace CPP
     /// \return Nothing
     void SetBufferSize( unsigned int BufferSize );
 
+    /// Choose which frame is discarded when a new frame arrives and the buffer is full.
+    /// The default is DropOldest, which keeps the latest frames. DropNewest keeps the frames already buffered, 
+    /// so none are lost between fetches that keep up on average but occasionally fall behind.
+    /// Discarded frames are counted by GetReceiveStats().
+    ///
+    ///
+    /// C example
+    ///      
+    ///      CClient * pClient = Client_Create();
+    ///      Client_SetBufferSize( pClient, 5 );
+    ///      Client_SetBufferDropPolicy( pClient, DropNewest );
+    ///      Client_Destroy( pClient );
+    ///      
+    /// C++ example
+    ///      
+    ///      ViconDataStreamSDK::CPP::Client MyClient;
+    ///      MyClient.SetBufferSize( 5 );
+    ///      MyClient.SetBufferDropPolicy( ViconDataStreamSDK::CPP::BufferDropPolicy::DropNewest );
+    ///      
+    /// MATLAB example
+    ///      
+    ///      MyClient = ViconDataStreamSDK.DotNET.Client();
+    ///      MyClient.SetBufferSize( 5 );
+    ///      MyClient.SetBufferDropPolicy( ViconDataStreamSDK.DotNET.BufferDropPolicy.DropNewest );
+    ///      
+    /// .NET example
+    ///      
+    ///      ViconDataStreamSDK.DotNET.Client MyClient = new ViconDataStreamSDK.DotNET.Client();
+    ///      MyClient.SetBufferSize( 5 );
+    ///      MyClient.SetBufferDropPolicy( ViconDataStreamSDK.DotNET.BufferDropPolicy.DropNewest );
+    /// -----
+    /// See Also: SetBufferSize(), GetReceiveStats()
+    ///
+    /// \param  DropPolicy  One of the following:
+    ///           + BufferDropPolicy.DropOldest
+    ///           + BufferDropPolicy.DropNewest
+    /// \return Nothing
+    void SetBufferDropPolicy( const BufferDropPolicy::Enum DropPolicy );
+
+    /// Defer decoding of bulk frame data (segments, markers, centroids, device data and the like) until it is first read from a fetched frame.
+    /// Each kind of data is decoded separately, so data which is never read, and frames which are discarded from the buffer, are never decoded.
+    /// The default is false, which decodes every frame as it arrives from the network.
+    ///
+    ///
+    /// C example
+    ///      
+    ///      CClient * pClient = Client_Create();
+    ///      Client_SetLazyDecoding( pClient, 1 );
+    ///      Client_Connect( pClient, "localhost" );
+    ///      Client_Destroy( pClient );
+    ///      
+    /// C++ example
+    ///      
+    ///      ViconDataStreamSDK::CPP::Client MyClient;
+    ///      MyClient.SetLazyDecoding( true );
+    ///      MyClient.Connect( "localhost" );
+    ///      
+    /// MATLAB example
+    ///      
+    ///      MyClient = ViconDataStreamSDK.DotNET.Client();
+    ///      MyClient.SetLazyDecoding( true );
+    ///      MyClient.Connect( "localhost" );
+    ///      
+    /// .NET example
+    ///      
+    ///      ViconDataStreamSDK.DotNET.Client MyClient = new ViconDataStreamSDK.DotNET.Client();
+    ///      MyClient.SetLazyDecoding( true );
+    ///      MyClient.Connect( "localhost" );
+    /// -----
+    /// See Also: SetBufferSize(), GetFrame()
+    ///
+    /// \param  bLazy  Whether to defer decoding until the frame is fetched.
+    /// \return Nothing
+    void SetLazyDecoding( bool bLazy );
+
+    /// Tune how multicast data is received. Must be called before ConnectToMulticast().
+    /// On Linux several queued datagrams are read with each system call, up to BatchSize; elsewhere one datagram is read at a time.
+    /// SocketBufferSize is the kernel receive buffer to request; a larger buffer absorbs bursts that would otherwise be dropped.
+    /// If SpinMicroseconds is non-zero the socket is polled for that long before blocking, trading CPU for wake-up latency.
+    /// The defaults are a 128 KB buffer, batches of 16 datagrams and no polling.
+    ///
+    ///
+    /// C example
+    ///      
+    ///      CClient * pClient = Client_Create();
+    ///      Client_SetMulticastReceiveOptions( pClient, 4 * 1024 * 1024, 32, 50 );
+    ///      Client_ConnectToMulticast( pClient, "localhost", "224.0.0.0" );
+    ///      Client_Destroy( pClient );
+    ///      
+    /// C++ example
+    ///      
+    ///      ViconDataStreamSDK::CPP::Client MyClient;
+    ///      MyClient.SetMulticastReceiveOptions( 4 * 1024 * 1024, 32, 50 );
+    ///      MyClient.ConnectToMulticast( "localhost", "224.0.0.0" );
+    ///      
+    /// MATLAB example
+    ///      
+    ///      MyClient = ViconDataStreamSDK.DotNET.Client();
+    ///      MyClient.SetMulticastReceiveOptions( 4 * 1024 * 1024, 32, 50 );
+    ///      MyClient.ConnectToMulticast( 'localhost', '224.0.0.0' );
+    ///      
+    /// .NET example
+    ///      
+    ///      ViconDataStreamSDK.DotNET.Client MyClient = new ViconDataStreamSDK.DotNET.Client();
+    ///      MyClient.SetMulticastReceiveOptions( 4 * 1024 * 1024, 32, 50 );
+    ///      MyClient.ConnectToMulticast( "localhost", "224.0.0.0" );
+    /// -----
+    /// See Also: ConnectToMulticast(), GetReceiveStats()
+    ///
+    /// \param  SocketBufferSize  The kernel receive buffer size to request, in bytes.
+    /// \param  BatchSize         The maximum number of datagrams to read with each system call.
+    /// \param  SpinMicroseconds  How long to poll before blocking; zero never polls.
+    /// \return Nothing
+    void SetMulticastReceiveOptions( unsigned int SocketBufferSize, unsigned int BatchSize, unsigned int SpinMicroseconds );
+
+    /// Return counters for data lost or delayed on the way to the client.
+    /// The datagram counters apply when receiving multicast data and are zero otherwise; DatagramsDropped counts datagrams discarded by 
+    /// the kernel because the socket buffer was full (Linux only), and BatchesFull counts reads which filled every slot of a batch.
+    /// SocketBufferSize is the receive buffer actually granted by the kernel; with several multicast receivers it is the smallest of them.
+    /// BufferOverruns counts frames discarded from the client buffer (see SetBufferSize()) before they were fetched,
+    /// and BufferHighWaterMark is the most frames the buffer has held at once.
+    ///
+    ///
+    /// C example
+    ///      
+    ///      CClient * pClient = Client_Create();
+    ///      Client_ConnectToMulticast( pClient, "localhost", "224.0.0.0" );
+    ///      COutput_GetReceiveStats _Output_GetReceiveStats;
+    ///      Client_GetReceiveStats( pClient, &_Output_GetReceiveStats );
+    ///      Client_Destroy( pClient );
+    ///      
+    /// C++ example
+    ///      
+    ///      ViconDataStreamSDK::CPP::Client MyClient;
+    ///      MyClient.ConnectToMulticast( "localhost", "224.0.0.0" );
+    ///      Output_GetReceiveStats Output = MyClient.GetReceiveStats();
+    ///      
+    /// MATLAB example
+    ///      
+    ///      MyClient = ViconDataStreamSDK.DotNET.Client();
+    ///      MyClient.ConnectToMulticast( 'localhost', '224.0.0.0' );
+    ///      Output = MyClient.GetReceiveStats();
+    ///      
+    /// .NET example
+    ///      
+    ///      ViconDataStreamSDK.DotNET.Client MyClient = new ViconDataStreamSDK.DotNET.Client();
+    ///      MyClient.ConnectToMulticast( "localhost", "224.0.0.0" );
+    ///      Output_GetReceiveStats Output = MyClient.GetReceiveStats();
+    /// -----
+    /// See Also: SetMulticastReceiveOptions(), SetBufferSize(), SetBufferDropPolicy()
+    ///
+    /// \return An Output_GetReceiveStats class containing the result of the operation and the counters.
+    ///         - The Result will be:
+    ///           + Success
+    ///           + NotConnected
+    Output_GetReceiveStats GetReceiveStats() const;
+
+    /// Return the number of connections made by Connect(). This is the number of host names given, separated by semicolons.
+    /// The connections are links to redundant hosts, for example over separate network adapters; see GetLinkStats().
+    ///
+    ///
+    /// C example
+    ///      
+    ///      CClient * pClient = Client_Create();
+    ///      Client_Connect( pClient, "192.168.1.10;192.168.2.10" );
+    ///      COutput_GetLinkCount _Output_GetLinkCount;
+    ///      Client_GetLinkCount( pClient, &_Output_GetLinkCount );
+    ///      Client_Destroy( pClient );
+    ///      
+    /// C++ example
+    ///      
+    ///      ViconDataStreamSDK::CPP::Client MyClient;
+    ///      MyClient.Connect( "192.168.1.10;192.168.2.10" );
+    ///      Output_GetLinkCount Output = MyClient.GetLinkCount();
+    ///      
+    /// MATLAB example
+    ///      
+    ///      MyClient = ViconDataStreamSDK.DotNET.Client();
+    ///      MyClient.Connect( '192.168.1.10;192.168.2.10' );
+    ///      Output = MyClient.GetLinkCount();
+    ///      
+    /// .NET example
+    ///      
+    ///      ViconDataStreamSDK.DotNET.Client MyClient = new ViconDataStreamSDK.DotNET.Client();
+    ///      MyClient.Connect( "192.168.1.10;192.168.2.10" );
+    ///      Output_GetLinkCount Output = MyClient.GetLinkCount();
+    /// -----
+    /// See Also: Connect(), GetLinkStats()
+    ///
+    /// \return An Output_GetLinkCount class containing the result of the operation and the number of links.
+    ///         - The Result will be:
+    ///           + Success
+    ///           + NotConnected
+    Output_GetLinkCount GetLinkCount() const;
+
+    /// Return counters for one of the connections made by Connect().
+    /// When connected to several hosts, every frame is passed on from whichever link delivers it first, and the copies 
+    /// that arrive later over the other links are dropped. FramesFirst counts the frames this link delivered first and 
+    /// FramesLate the copies it delivered after another link; MeanLag and MaxLag give how far behind those copies were, in seconds.
+    /// FramesStale counts frames this link delivered after a newer frame had already been passed on, without a recent copy to match,
+    /// and frames sent from before a server restart that another link had already seen; these are dropped so that frames are never passed on out of order.
+    /// FramesLost counts frames missing from this link's own sequence, which in ServerPush mode means they were lost in transit.
+    ///
+    ///
+    /// C example
+    ///      
+    ///      CClient * pClient = Client_Create();
+    ///      Client_Connect( pClient, "192.168.1.10;192.168.2.10" );
+    ///      COutput_GetLinkStats _Output_GetLinkStats;
+    ///      Client_GetLinkStats( pClient, 1, &_Output_GetLinkStats );
+    ///      Client_Destroy( pClient );
+    ///      
+    /// C++ example
+    ///      
+    ///      ViconDataStreamSDK::CPP::Client MyClient;
+    ///      MyClient.Connect( "192.168.1.10;192.168.2.10" );
+    ///      Output_GetLinkStats Output = MyClient.GetLinkStats( 1 );
+    ///      
+    /// MATLAB example
+    ///      
+    ///      MyClient = ViconDataStreamSDK.DotNET.Client();
+    ///      MyClient.Connect( '192.168.1.10;192.168.2.10' );
+    ///      Output = MyClient.GetLinkStats( 1 );
+    ///      
+    /// .NET example
+    ///      
+    ///      ViconDataStreamSDK.DotNET.Client MyClient = new ViconDataStreamSDK.DotNET.Client();
+    ///      MyClient.Connect( "192.168.1.10;192.168.2.10" );
+    ///      Output_GetLinkStats Output = MyClient.GetLinkStats( 1 );
+    /// -----
+    /// See Also: Connect(), GetLinkCount(), GetReceiveStats()
+    ///
+    /// \param  LinkIndex  The index of the link, between 0 and GetLinkCount() - 1.
+    /// \return An Output_GetLinkStats class containing the result of the operation and the counters.
+    ///         - The Result will be:
+    ///           + Success
+    ///           + NotConnected
+    ///           + InvalidIndex
+    Output_GetLinkStats GetLinkStats( const unsigned int LinkIndex ) const;
+
+    /// Service network connections from a shared pool of threads. Must be called before Connect() or ConnectToMulticast().
+    /// When ThreadCount is non-zero, every connection made by any client in the process that has also called this runs as 
+    /// asynchronous operations on one shared executor, serviced by at least ThreadCount threads, rather than on a thread of its own.
+    /// This keeps the thread count fixed when many clients or servers are in use.
+    /// The default is zero, which gives each connection a dedicated thread.
+    ///
+    ///
+    /// C example
+    ///      
+    ///      CClient * pClient = Client_Create();
+    ///      Client_SetExecutorThreads( pClient, 2 );
+    ///      Client_Connect( pClient, "localhost" );
+    ///      Client_Destroy( pClient );
+    ///      
+    /// C++ example
+    ///      
+    ///      ViconDataStreamSDK::CPP::Client MyClient;
+    ///      MyClient.SetExecutorThreads( 2 );
+    ///      MyClient.Connect( "localhost" );
+    ///      
+    /// MATLAB example
+    ///      
+    ///      MyClient = ViconDataStreamSDK.DotNET.Client();
+    ///      MyClient.SetExecutorThreads( 2 );
+    ///      MyClient.Connect( 'localhost' );
+    ///      
+    /// .NET example
+    ///      
+    ///      ViconDataStreamSDK.DotNET.Client MyClient = new ViconDataStreamSDK.DotNET.Client();
+    ///      MyClient.SetExecutorThreads( 2 );
+    ///      MyClient.Connect( "localhost" );
+    /// -----
+    /// See Also: Connect(), ConnectToMulticast()
+    ///
+    /// \param  ThreadCount  The number of threads servicing the shared executor; zero for a thread per connection.
+    /// \return Nothing
+    void SetExecutorThreads( unsigned int ThreadCount );
+
     /// There are three modes that the SDK can operate in. Each mode has a different impact on the Client, Server, and network resources used.
     ///
     ///   + **ServerPush**
@@ -1938,6 +2219,76 @@ namespace CPP
     ///           + NotConnected
     Output_GetFrame GetFrame();
 
+    /// Request a new frame, blocking until it arrives or the timeout expires.
+    /// This behaves as GetFrame(), but lets the caller choose how long to wait. In ServerPush mode the call
+    /// returns as soon as the frame is received, so it may be called in a tight loop without sleeping.
+    ///
+    /// See Also: GetFrame(), SetFrameCallback()
+    ///
+    ///
+    /// C example
+    ///      
+    ///      CClient * pClient = Client_Create();
+    ///      Client_Connect( pClient, "localhost" );
+    ///      CEnum Output = Client_WaitForFrame( pClient, 100 ); // Output == Success, or NoFrame after 100ms
+    ///      Client_Destroy( pClient );
+    ///      
+    /// C++ example
+    ///      
+    ///      ViconDataStreamSDK::CPP::Client MyClient;
+    ///      MyClient.Connect( "localhost" );
+    ///      Output_WaitForFrame Output = MyClient.WaitForFrame( 100 ); // Output.Result == Success, or NoFrame after 100ms
+    ///      
+    /// MATLAB example
+    ///      
+    ///      Not available.
+    ///      
+    /// .NET example
+    ///      
+    ///      Not available.
+    /// -----
+    /// \param TimeoutMs The longest time to wait for a frame, in milliseconds.
+    /// \return An Output_WaitForFrame class containing the result of the operation.
+    ///         - The Result will be:
+    ///           + Success
+    ///           + NoFrame
+    ///           + NotConnected
+    Output_WaitForFrame WaitForFrame( unsigned int TimeoutMs );
+
+    /// Register a function to be called each time a new frame is received from the server.
+    /// The callback is made on the client's network thread with the frame number of the received frame;
+    /// it should only signal the application (which then calls GetFrame() or WaitForFrame()) and return quickly.
+    /// The callback may be set before or after connecting. Pass a null function to remove it.
+    ///
+    /// See Also: WaitForFrame()
+    ///
+    ///
+    /// C example
+    ///      
+    ///      Not available.
+    ///      
+    /// C++ example
+    ///      
+    ///      void OnFrame( unsigned int FrameNumber, void * pUserData ) { /* wake the consumer */ }
+    ///      ViconDataStreamSDK::CPP::Client MyClient;
+    ///      MyClient.SetFrameCallback( &OnFrame, nullptr );
+    ///      MyClient.Connect( "localhost" );
+    ///      
+    /// MATLAB example
+    ///      
+    ///      Not available.
+    ///      
+    /// .NET example
+    ///      
+    ///      Not available.
+    /// -----
+    /// \param Callback The function to call, or null.
+    /// \param pUserData Passed unchanged to the callback.
+    /// \return An Output_SetFrameCallback class containing the result of the operation.
+    ///         - The Result will be:
+    ///           + Success
+    Output_SetFrameCallback SetFrameCallback( FrameCallback Callback, void * pUserData );
+
     /// Return the number of the last frame retrieved from the DataStream.
     ///
     /// See Also: GetFrame(), GetTimecode()
@@ -3649,6 +4000,132 @@ namespace CPP
     Output_GetSegmentGlobalRotationEulerXYZ GetSegmentGlobalRotationEulerXYZ( const String & SubjectName,
                                                                               const String & SegmentName ) const;
 
+    /// Return a handle which identifies a subject segment in later calls without a search by name.
+    /// The handle remains valid until the list of subjects streamed by the server changes. After that, calls 
+    /// taking the handle return InvalidIndex and a new handle should be requested.
+    ///
+    /// See Also: GetSegmentGlobalPose()
+    ///
+    ///
+    /// C example
+    ///      
+    ///      Not available.
+    ///      
+    /// C++ example
+    ///      
+    ///      ViconDataStreamSDK::CPP::Client MyClient;
+    ///      MyClient.Connect( "localhost" );
+    ///      MyClient.GetFrame();
+    ///      Output_GetSegmentHandle Output = MyClient.GetSegmentHandle( "Alice", "Pelvis" );
+    ///      
+    /// MATLAB example
+    ///      
+    ///      Not available.
+    ///      
+    /// .NET example
+    ///      
+    ///      Not available.
+    /// -----
+    /// \param  SubjectName The name of the subject.
+    /// \param  SegmentName The name of the segment.
+    /// \return An Output_GetSegmentHandle class containing the result of the operation and the handle.
+    ///         - The Result will be:
+    ///           + Success
+    ///           + NotConnected
+    ///           + NoFrame
+    ///           + InvalidSubjectName
+    ///           + InvalidSegmentName
+    Output_GetSegmentHandle GetSegmentHandle( const String & SubjectName,
+                                              const String & SegmentName ) const;
+
+    /// Return the global translation and quaternion rotation of a subject segment in one call.
+    /// This is equivalent to GetSegmentGlobalTranslation() and GetSegmentGlobalRotationQuaternion(), but
+    /// the segment is identified by a handle from GetSegmentHandle().
+    ///
+    /// See Also: GetSegmentHandle(), GetSegmentGlobalTranslation(), GetSegmentGlobalRotationQuaternion()
+    ///
+    ///
+    /// C example
+    ///      
+    ///      Not available.
+    ///      
+    /// C++ example
+    ///      
+    ///      ViconDataStreamSDK::CPP::Client MyClient;
+    ///      MyClient.Connect( "localhost" );
+    ///      MyClient.GetFrame();
+    ///      SegmentHandle Pelvis = MyClient.GetSegmentHandle( "Alice", "Pelvis" ).Handle;
+    ///      Output_GetSegmentGlobalPose Output = MyClient.GetSegmentGlobalPose( Pelvis );
+    ///      
+    /// MATLAB example
+    ///      
+    ///      Not available.
+    ///      
+    /// .NET example
+    ///      
+    ///      Not available.
+    /// -----
+    /// \param  Handle A handle returned by GetSegmentHandle().
+    /// \return An Output_GetSegmentGlobalPose class containing the result of the operation, the translation
+    ///         and rotation of the segment, and whether the segment is occluded.
+    ///         - The Result will be:
+    ///           + Success
+    ///           + NotConnected
+    ///           + NoFrame
+    ///           + InvalidIndex
+    ///         - Occluded will be True if the segment was absent at this frame. In this case the Translation and Rotation will be zero.
+    Output_GetSegmentGlobalPose GetSegmentGlobalPose( const SegmentHandle Handle ) const;
+
+    /// Copy the global pose of every segment of every subject into caller-owned arrays.
+    /// All poses are taken from the same frame, and the whole copy is made under a single lock, so this is much
+    /// cheaper than calling GetSegmentGlobalTranslation() and GetSegmentGlobalRotationQuaternion() for each segment.
+    /// Segments are identified by the same handles as returned by GetSegmentHandle().
+    ///
+    /// See Also: GetSegmentHandle(), GetSegmentGlobalPose()
+    ///
+    ///
+    /// C example
+    ///      
+    ///      CClient * pClient = Client_Create();
+    ///      Client_Connect( pClient, "localhost" );
+    ///      Client_GetFrame( pClient );
+    ///      unsigned long long Handles[ 256 ];
+    ///      double Translations[ 256 * 3 ], Rotations[ 256 * 4 ];
+    ///      CBool Occluded[ 256 ];
+    ///      CSegmentGlobalPoses Poses = { 256, Handles, Translations, Rotations, Occluded };
+    ///      COutput_GetAllSegmentGlobalPoses Output;
+    ///      Client_GetAllSegmentGlobalPoses( pClient, &Poses, &Output );
+    ///      Client_Destroy( pClient );
+    ///      
+    /// C++ example
+    ///      
+    ///      ViconDataStreamSDK::CPP::Client MyClient;
+    ///      MyClient.Connect( "localhost" );
+    ///      MyClient.GetFrame();
+    ///      std::vector< SegmentHandle > Handles( 256 );
+    ///      std::vector< double > Translations( 256 * 3 ), Rotations( 256 * 4 );
+    ///      std::unique_ptr< bool[] > Occluded( new bool[ 256 ] );
+    ///      SegmentGlobalPoses Poses = { 256, Handles.data(), Translations.data(), Rotations.data(), Occluded.get() };
+    ///      Output_GetAllSegmentGlobalPoses Output = MyClient.GetAllSegmentGlobalPoses( Poses );
+    ///      
+    /// MATLAB example
+    ///      
+    ///      Not available.
+    ///      
+    /// .NET example
+    ///      
+    ///      Not available.
+    /// -----
+    /// \param  Poses The arrays to fill, and their capacity.
+    /// \return An Output_GetAllSegmentGlobalPoses class containing the result of the operation and the number of segments.
+    ///         - The Result will be:
+    ///           + Success
+    ///           + NotConnected
+    ///           + NoFrame
+    ///         - SegmentCount is the number of segments in the frame. If it exceeds Poses.Capacity, only the first Capacity are written.
+    ///         - Occluded segments have a zero Translation and Rotation.
+    Output_GetAllSegmentGlobalPoses GetAllSegmentGlobalPoses( const SegmentGlobalPoses & Poses ) const;
+
     /// Return the translation of a subject segment in local coordinates relative to its parent segment.
     ///
     /// See Also: GetSegmentLocalRotationHelical(), GetSegmentLocalRotationMatrix(), GetSegmentLocalRotationQuaternion(), GetSegmentLocalRotationEulerXYZ(), GetSegmentGlobalTranslation(), GetSegmentGlobalRotationHelical(), GetSegmentGlobalRotationMatrix(), GetSegmentGlobalRotationQuaternion(), GetSegmentGlobalRotationEulerXYZ()
@@ -4660,6 +5137,68 @@ namespace CPP
     ///           + InvalidIndex
     Output_GetLabeledMarkerGlobalTranslation GetLabeledMarkerGlobalTranslation( const unsigned int MarkerIndex ) const;
 
+    /// Copy the global translation of every subject marker and every unlabeled marker into caller-owned arrays.
+    /// Everything is taken from the same frame in a single pass over its reconstructions, so this is much cheaper
+    /// than calling GetMarkerGlobalTranslation() for each marker of each subject.
+    /// Subject markers are listed in subject and marker index order, and identified by their subject index, marker index
+    /// and the index of their parent segment, as used by GetSubjectName(), GetMarkerName() and GetSegmentName().
+    /// Markers without a parent segment have a SegmentIndex of 0xFFFFFFFF.
+    /// The indices only change when the subjects do, which is reported by a new LayoutGeneration, so names looked up
+    /// from them can be kept until then.
+    ///
+    /// See Also: GetMarkerGlobalTranslation(), GetUnlabeledMarkerGlobalTranslation()
+    ///
+    ///
+    /// C example
+    ///      
+    ///      CClient * pClient = Client_Create();
+    ///      Client_Connect( pClient, "localhost" );
+    ///      Client_EnableMarkerData( pClient );
+    ///      Client_EnableUnlabeledMarkerData( pClient );
+    ///      Client_GetFrame( pClient );
+    ///      unsigned int Subjects[ 256 ], Segments[ 256 ], Markers[ 256 ], MarkerIDs[ 256 ];
+    ///      double Translations[ 256 * 3 ], UnlabeledTranslations[ 256 * 3 ];
+    ///      CBool Occluded[ 256 ];
+    ///      CMarkerGlobalTranslations Buffers = { 256, Subjects, Segments, Markers, Translations, Occluded,
+    ///                                            256, UnlabeledTranslations, MarkerIDs };
+    ///      COutput_GetAllMarkerGlobalTranslations Output;
+    ///      Client_GetAllMarkerGlobalTranslations( pClient, &Buffers, &Output );
+    ///      Client_Destroy( pClient );
+    ///      
+    /// C++ example
+    ///      
+    ///      ViconDataStreamSDK::CPP::Client MyClient;
+    ///      MyClient.Connect( "localhost" );
+    ///      MyClient.EnableMarkerData();
+    ///      MyClient.EnableUnlabeledMarkerData();
+    ///      MyClient.GetFrame();
+    ///      std::vector< unsigned int > Subjects( 256 ), Segments( 256 ), Markers( 256 ), MarkerIDs( 256 );
+    ///      std::vector< double > Translations( 256 * 3 ), UnlabeledTranslations( 256 * 3 );
+    ///      std::unique_ptr< bool[] > Occluded( new bool[ 256 ] );
+    ///      MarkerGlobalTranslations Buffers = { 256, Subjects.data(), Segments.data(), Markers.data(), Translations.data(), Occluded.get(),
+    ///                                           256, UnlabeledTranslations.data(), MarkerIDs.data() };
+    ///      Output_GetAllMarkerGlobalTranslations Output = MyClient.GetAllMarkerGlobalTranslations( Buffers );
+    ///      
+    /// MATLAB example
+    ///      
+    ///      Not available.
+    ///      
+    /// .NET example
+    ///      
+    ///      Not available.
+    /// -----
+    /// \param  Buffers The arrays to fill, and their capacities.
+    /// \return An Output_GetAllMarkerGlobalTranslations class containing the result of the operation and the marker counts.
+    ///         - The Result will be:
+    ///           + Success
+    ///           + NotConnected
+    ///           + NoFrame
+    ///         - LabeledMarkerCount is the number of subject markers and UnlabeledMarkerCount the number of unlabeled markers in the frame.
+    ///           If either exceeds its capacity, only the first Capacity entries are written.
+    ///         - LayoutGeneration changes whenever the subject, segment and marker indices may have changed.
+    ///         - Occluded markers have a zero Translation.
+    Output_GetAllMarkerGlobalTranslations GetAllMarkerGlobalTranslations( const MarkerGlobalTranslations & Buffers ) const;
+
     /// Return the number of force plates, EMGs, and other devices in the DataStream. This information can be used in conjunction with GetDeviceName.
     ///
     /// See Also: GetDeviceName()
@@ -7473,6 +8012,8 @@ namespace CPP
     ///           + InvalidSubjectName
     Output_AddToSubjectFilter AddToSubjectFilter( const String & SubjectName);
 
+    /// Output timing information to binary log files, which timinglog_to_csv converts to comma separated values
+    /// @private
     virtual Output_SetTimingLogFile SetTimingLogFile(const String & ClientLog, const String & StreamLog );
 
     /// Request that the wireless adapters will be optimally configured for streaming data.
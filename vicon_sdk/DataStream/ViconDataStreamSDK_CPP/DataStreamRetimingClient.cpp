@@ -490,6 +490,45 @@ namespace ViconDataStreamSDK
       return m_pClientImpl->m_pCoreRetimingClient->MaximumPrediction();
     }
 
+    CLASS_DECLSPEC
+    void RetimingClient::SetPredictor( const PredictorModel::Enum Predictor )
+    {
+      m_pClientImpl->m_pCoreRetimingClient->SetPredictor( Adapt( Predictor ) );
+    }
+
+    CLASS_DECLSPEC
+    PredictorModel::Enum RetimingClient::Predictor() const
+    {
+      return Adapt( m_pClientImpl->m_pCoreRetimingClient->Predictor() );
+    }
+
+    CLASS_DECLSPEC
+    Output_SetOutputThreadOptions RetimingClient::SetOutputThreadOptions( const unsigned int Priority, const int Cpu )
+    {
+      Output_SetOutputThreadOptions Output;
+      Output.Result = Adapt( m_pClientImpl->m_pCoreRetimingClient->SetOutputThreadOptions( Priority, Cpu ) );
+      return Output;
+    }
+
+    CLASS_DECLSPEC
+    Output_GetOutputJitter RetimingClient::GetOutputJitter() const
+    {
+      ViconDataStreamSDK::Core::VOutputJitter Jitter;
+
+      Output_GetOutputJitter Output;
+      Output.Result = Adapt( m_pClientImpl->m_pCoreRetimingClient->GetOutputJitter( Jitter ) );
+      Output.FrameCount = Jitter.m_FrameCount;
+      Output.MissedFrames = Jitter.m_MissedFrames;
+      Output.Mean = Jitter.m_Mean;
+      Output.Median = Jitter.m_Median;
+      Output.Percentile90 = Jitter.m_Percentile90;
+      Output.Percentile99 = Jitter.m_Percentile99;
+      Output.Percentile999 = Jitter.m_Percentile999;
+      Output.Maximum = Jitter.m_Maximum;
+      Output.RealTime = Jitter.m_bRealTime;
+      return Output;
+    }
+
     CLASS_DECLSPEC
     bool RetimingClient::SetDebugLogFile(const String & LogFile)
     {
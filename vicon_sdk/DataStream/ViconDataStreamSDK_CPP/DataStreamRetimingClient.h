@@ -2004,6 +2004,148 @@ namespace ViconDataStreamSDK
       /// \return The maximum prediction allowed in milliseconds
       double MaximumPrediction() const;
 
+      /// Sets the model used to interpolate between received frames and to predict later than the latest one. The default is Linear.
+      /// Spline follows curved motion more closely, which allows a lower output latency for the same pose error.
+      /// Kalman smooths noisy input when predicting forwards, at the cost of responding more slowly to sudden changes in motion.
+      ///
+      ///
+      /// C example
+      ///      
+      ///      CRetimingClient * pRetimingClient = RetimingClient_Create();
+      ///      RetimingClient_SetPredictor( pRetimingClient, Spline );
+      ///      RetimingClient_Connect( pRetimingClient, "localhost" );
+      ///      RetimingClient_Destroy( pRetimingClient );
+      ///      
+      /// C++ example
+      ///      
+      ///      ViconDataStreamSDK::CPP::RetimingClient MyClient;
+      ///      MyClient.SetPredictor( ViconDataStreamSDK::CPP::PredictorModel::Spline );
+      ///      MyClient.Connect( "localhost" );
+      ///      
+      /// MATLAB example
+      ///      
+      ///     See .NET example
+      ///      
+      /// .NET example
+      ///      
+      ///      ViconDataStreamSDK.DotNET.RetimingClient MyClient = new ViconDataStreamSDK.DotNET.RetimingClient();
+      ///      MyClient.SetPredictor( ViconDataStreamSDK.DotNET.PredictorModel.Spline );
+      ///      MyClient.Connect( "localhost" );
+      /// -----      
+      /// \param Predictor The model to use:
+      ///           + PredictorModel.Linear
+      ///           + PredictorModel.Spline
+      ///           + PredictorModel.Kalman
+      void SetPredictor( const PredictorModel::Enum Predictor );
+
+      /// Returns the model currently used to interpolate and predict.
+      /// 
+      ///
+      /// C example
+      ///      
+      ///      CRetimingClient * pRetimingClient = RetimingClient_Create();
+      ///      RetimingClient_SetPredictor( pRetimingClient, Kalman );
+      ///      RetimingClient_Predictor( pRetimingClient ); // Returns Kalman
+      ///      RetimingClient_Destroy( pRetimingClient );
+      ///      
+      /// C++ example
+      ///      
+      ///      ViconDataStreamSDK::CPP::RetimingClient MyClient;
+      ///      MyClient.SetPredictor( ViconDataStreamSDK::CPP::PredictorModel::Kalman );
+      ///      MyClient.Predictor(); // Returns Kalman
+      ///      
+      /// MATLAB example
+      ///      
+      ///     See .NET example
+      ///      
+      /// .NET example
+      ///      
+      ///      ViconDataStreamSDK.DotNET.RetimingClient MyClient = new ViconDataStreamSDK.DotNET.RetimingClient();
+      ///      MyClient.SetPredictor( ViconDataStreamSDK.DotNET.PredictorModel.Kalman );
+      ///      MyClient.Predictor(); // Returns Kalman
+      /// -----      
+      /// \return The model in use
+      PredictorModel::Enum Predictor() const;
+
+      /// Sets the scheduling of the thread that outputs retimed frames when a frame rate has been given to Connect().
+      /// A priority above zero runs the thread with real-time (SCHED_FIFO) priority, which normally needs the CAP_SYS_NICE capability
+      /// or a suitable rtprio limit; zero leaves it with normal scheduling. A CPU index of zero or more pins the thread to that CPU.
+      /// The options take effect the next time output is started, so call this before Connect().
+      ///
+      /// See Also: GetOutputJitter()
+      ///
+      ///
+      /// C example
+      ///      
+      ///      CRetimingClient * pRetimingClient = RetimingClient_Create();
+      ///      RetimingClient_SetOutputThreadOptions( pRetimingClient, 80, 2 );
+      ///      RetimingClient_ConnectAndStart( pRetimingClient, "localhost", 240 );
+      ///      RetimingClient_Destroy( pRetimingClient );
+      ///      
+      /// C++ example
+      ///      
+      ///      ViconDataStreamSDK::CPP::RetimingClient MyClient;
+      ///      MyClient.SetOutputThreadOptions( 80, 2 );
+      ///      MyClient.Connect( "localhost", 240 );
+      ///      
+      /// MATLAB example
+      ///      
+      ///     See .NET example
+      ///      
+      /// .NET example
+      ///      
+      ///      ViconDataStreamSDK.DotNET.RetimingClient MyClient = new ViconDataStreamSDK.DotNET.RetimingClient();
+      ///      MyClient.SetOutputThreadOptions( 80, 2 );
+      ///      MyClient.Connect( "localhost", 240 );
+      /// -----      
+      /// \param Priority The SCHED_FIFO priority of the output thread, or zero for normal scheduling.
+      /// \param Cpu      The index of the CPU to run the output thread on, or -1 for any CPU.
+      /// \return An Output_SetOutputThreadOptions class containing the result of the operation.
+      ///         - The Result will be:
+      ///           + Success
+      ///           + InvalidIndex if the CPU does not exist
+      ///           + NotSupported on platforms where thread scheduling cannot be set
+      Output_SetOutputThreadOptions SetOutputThreadOptions( const unsigned int Priority, const int Cpu );
+
+      /// Reports how late the output thread has woken for each frame since output was last started, in milliseconds.
+      /// Output frames are scheduled at exact multiples of the frame period, so lateness does not accumulate; a frame whose 
+      /// time has passed entirely before the thread woke is skipped and counted in MissedFrames.
+      /// Percentiles are accurate to 1us below 1ms, 10us below 10ms and 100us below 100ms.
+      ///
+      /// See Also: SetOutputThreadOptions()
+      ///
+      ///
+      /// C example
+      ///      
+      ///      CRetimingClient * pRetimingClient = RetimingClient_Create();
+      ///      RetimingClient_ConnectAndStart( pRetimingClient, "localhost", 240 );
+      ///      COutput_GetOutputJitter Jitter;
+      ///      RetimingClient_GetOutputJitter( pRetimingClient, &Jitter );
+      ///      RetimingClient_Destroy( pRetimingClient );
+      ///      
+      /// C++ example
+      ///      
+      ///      ViconDataStreamSDK::CPP::RetimingClient MyClient;
+      ///      MyClient.Connect( "localhost", 240 );
+      ///      Output_GetOutputJitter Output = MyClient.GetOutputJitter();
+      ///      
+      /// MATLAB example
+      ///      
+      ///     See .NET example
+      ///      
+      /// .NET example
+      ///      
+      ///      ViconDataStreamSDK.DotNET.RetimingClient MyClient = new ViconDataStreamSDK.DotNET.RetimingClient();
+      ///      MyClient.Connect( "localhost", 240 );
+      ///      Output_GetOutputJitter Output = MyClient.GetOutputJitter();
+      /// -----      
+      /// \return An Output_GetOutputJitter class containing the result of the operation, the number of frames output and missed,
+      ///         the mean, median, 90th, 99th and 99.9th percentile and maximum wake-up delay, and whether the requested
+      ///         thread options were applied.
+      ///         - The Result will be:
+      ///           + Success
+      Output_GetOutputJitter GetOutputJitter() const;
+
       /// Set a debug log file that will contain timing information to allow analysis of the retiming performance
       /// \return false if the log file could not be opened.
       /// @private
@@ -2023,7 +2165,7 @@ namespace ViconDataStreamSDK
       /// @private
       Output_AddToSubjectFilter AddToSubjectFilter( const String& SubjectName );
 
-      /// Output timing information to a log file
+      /// Output timing information to binary log files, which timinglog_to_csv converts to comma separated values
       /// @private
       Output_SetTimingLogFile SetTimingLogFile(const String & ClientLog, const String & StreamLog);
 
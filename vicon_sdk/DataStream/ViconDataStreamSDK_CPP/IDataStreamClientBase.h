@@ -198,6 +198,25 @@ namespace StreamMode
   };
 }
 
+namespace BufferDropPolicy
+{
+  enum Enum
+  {
+    DropOldest,
+    DropNewest
+  };
+}
+
+namespace PredictorModel
+{
+  enum Enum
+  {
+    Linear, ///< Straight line translation and constant angular velocity rotation from the two samples either side
+    Spline, ///< Cubic Hermite translation and SQUAD rotation through the neighbouring samples
+    Kalman  ///< As Spline when interpolating; predicts translation forward with a constant acceleration Kalman filter
+  };
+}
+
 namespace TimecodeStandard
 {
   enum Enum
@@ -352,10 +371,12 @@ namespace Result
   class Output_GetFrame                   : public Output_SimpleResult {};
   class Output_UpdateFrame                : public Output_SimpleResult {};
   class Output_WaitForFrame               : public Output_SimpleResult {};
+  class Output_SetFrameCallback           : public Output_SimpleResult {};
   class Output_SetCameraFilter            : public Output_SimpleResult {};
   class Output_ClearSubjectFilter         : public Output_SimpleResult {};
   class Output_AddToSubjectFilter         : public Output_SimpleResult {};
   class Output_SetTimingLogFile           : public Output_SimpleResult {};
+  class Output_SetOutputThreadOptions     : public Output_SimpleResult {};
 
   class Output_EnabledFlag
   {
@@ -452,6 +473,56 @@ namespace Result
     double       Total;
   };
 
+  class Output_GetReceiveStats
+  {
+  public:
+    Result::Enum       Result;
+    unsigned long long DatagramsReceived;
+    unsigned long long DatagramsDropped;
+    unsigned long long DatagramsTruncated;
+    unsigned long long BatchesReceived;
+    unsigned long long BatchesFull;
+    unsigned long long SocketBufferSize;
+    unsigned long long BufferOverruns;
+    unsigned int       BufferHighWaterMark;
+  };
+
+  class Output_GetLinkCount
+  {
+  public:
+    Result::Enum Result;
+    unsigned int LinkCount;
+  };
+
+  class Output_GetLinkStats
+  {
+  public:
+    Result::Enum       Result;
+    bool               Connected;
+    unsigned long long FramesReceived;
+    unsigned long long FramesFirst;
+    unsigned long long FramesLate;
+    unsigned long long FramesStale;
+    unsigned long long FramesLost;
+    double             MeanLag;
+    double             MaxLag;
+  };
+
+  class Output_GetOutputJitter
+  {
+  public:
+    Result::Enum       Result;
+    unsigned long long FrameCount;
+    unsigned long long MissedFrames;
+    double             Mean;
+    double             Median;
+    double             Percentile90;
+    double             Percentile99;
+    double             Percentile999;
+    double             Maximum;
+    bool               RealTime;
+  };
+
   class Output_GetFrameRateCount
   {
   public:
@@ -611,6 +682,44 @@ namespace Result
     bool         Occluded;
   };
 
+  /// Opaque reference to a subject segment, returned by GetSegmentHandle().
+  typedef unsigned long long SegmentHandle;
+
+  class Output_GetSegmentHandle
+  {
+  public:
+    Result::Enum  Result;
+    SegmentHandle Handle;
+  };
+
+  class Output_GetSegmentGlobalPose
+  {
+  public:
+    Result::Enum Result;
+    double       Translation[ 3 ];
+    double       Rotation[ 4 ];
+    bool         Occluded;
+  };
+
+  /// Caller-owned arrays filled by GetAllSegmentGlobalPoses(). Each must have room for Capacity segments;
+  /// Translations holds three and Rotations four (quaternion x, y, z, w) values per segment.
+  class SegmentGlobalPoses
+  {
+  public:
+    unsigned int    Capacity;
+    SegmentHandle * Handles;
+    double        * Translations;
+    double        * Rotations;
+    bool          * Occluded;
+  };
+
+  class Output_GetAllSegmentGlobalPoses
+  {
+  public:
+    Result::Enum Result;
+    unsigned int SegmentCount;
+  };
+
   class Output_GetSegmentGlobalRotationEulerXYZ
   {
   public:
@@ -725,6 +834,32 @@ namespace Result
     unsigned int MarkerID;
   };
 
+  /// Caller-owned arrays filled by GetAllMarkerGlobalTranslations(). The labeled arrays must have room for
+  /// LabeledCapacity markers and the unlabeled arrays for UnlabeledCapacity; translations hold three values per marker.
+  class MarkerGlobalTranslations
+  {
+  public:
+    unsigned int   LabeledCapacity;
+    unsigned int * SubjectIndices;
+    unsigned int * SegmentIndices;
+    unsigned int * MarkerIndices;
+    double       * Translations;
+    bool         * Occluded;
+
+    unsigned int   UnlabeledCapacity;
+    double       * UnlabeledTranslations;
+    unsigned int * UnlabeledMarkerIDs;
+  };
+
+  class Output_GetAllMarkerGlobalTranslations
+  {
+  public:
+    Result::Enum Result;
+    unsigned int LabeledMarkerCount;
+    unsigned int UnlabeledMarkerCount;
+    unsigned int LayoutGeneration;
+  };
+
   class Output_GetLabeledMarkerCount
   {
   public:
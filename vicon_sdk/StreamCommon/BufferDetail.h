@@ -32,6 +32,12 @@ namespace ViconCGStreamIO
 {
 //-------------------------------------------------------------------------------------------------
 
+/// Types whose in-memory layout matches the stream layout specialise this, so that arrays of them are read and written
+/// with a single copy. They are still copied out of the buffer, which is reused for the next frame; there is no view into it.
+/// Opted in: centroids, edge pairs, 2D and 3D wand points, and lightweight segments.
+/// Not opted in, so decoded element by element: global and local segments, labeled recons and centroid tracks, whose
+/// padding differs from the packed stream layout, and greyscale blobs, whose lines each carry their own pixel array
+/// (the pixels of a line are copied as one block).
 template< typename T >
 struct VIsPod
 {
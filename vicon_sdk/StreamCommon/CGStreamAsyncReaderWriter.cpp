@@ -42,7 +42,21 @@ void VCGStreamAsyncReaderWriter::ReadBuffer(  boost::asio::ip::tcp::socket& i_rS
   boost::asio::async_read(  i_rSocket,
                             boost::asio::buffer( i_rBuffer.Raw(), i_rBuffer.Length() ),
                             std::bind( &VCGStreamAsyncReaderWriter::OnBufferHeaderRead, ph::_1, ph::_2,
-                              std::ref( i_rSocket ), std::ref( i_rBuffer ), i_VerifyHandler, i_Handler ) );
+                              std::ref( i_rSocket ), nullptr, std::ref( i_rBuffer ), i_VerifyHandler, i_Handler ) );
+}
+
+void VCGStreamAsyncReaderWriter::ReadBuffer(  boost::asio::ip::tcp::socket& i_rSocket,
+                                              boost::asio::io_service::strand& i_rStrand,
+                                              ViconCGStreamIO::VBuffer& i_rBuffer,
+                                              std::function< bool( ViconCGStreamType::Enum, ViconCGStreamType::UInt32 ) > i_VerifyHandler,
+                                              std::function< void( bool ) > i_Handler )
+{
+  i_rBuffer.SetLength( sizeof( ViconCGStreamType::Enum ) + sizeof( ViconCGStreamType::UInt32 ) );
+  i_rBuffer.SetOffset( 0 );
+  boost::asio::async_read(  i_rSocket,
+                            boost::asio::buffer( i_rBuffer.Raw(), i_rBuffer.Length() ),
+                            i_rStrand.wrap( std::bind( &VCGStreamAsyncReaderWriter::OnBufferHeaderRead, ph::_1, ph::_2,
+                              std::ref( i_rSocket ), &i_rStrand, std::ref( i_rBuffer ), i_VerifyHandler, i_Handler ) ) );
 }
 
 void VCGStreamAsyncReaderWriter::WriteBuffer( boost::asio::ip::tcp::socket& i_rSocket,
@@ -74,6 +88,7 @@ void VCGStreamAsyncReaderWriter::SendBufferTo( std::shared_ptr< boost::asio::ip:
 void VCGStreamAsyncReaderWriter::OnBufferHeaderRead(  const boost::system::error_code i_Error,
                                                       const std::size_t /*i_BytesRead*/,
                                                       boost::asio::ip::tcp::socket& i_rSocket,
+                                                      boost::asio::io_service::strand* i_pStrand,
                                                       ViconCGStreamIO::VBuffer& i_rBuffer,
                                                       std::function< bool( ViconCGStreamType::Enum, ViconCGStreamType::UInt32 ) > i_VerifyHandler,
                                                       std::function< void( bool ) > i_Handler )
@@ -98,7 +113,14 @@ void VCGStreamAsyncReaderWriter::OnBufferHeaderRead(  const boost::system::error
   i_rBuffer.SetLength( i_rBuffer.Length() + BlockLength );
   boost::asio::mutable_buffers_1 AsioBuffer(  boost::asio::buffer( i_rBuffer.Raw() + i_rBuffer.Offset(), BlockLength ) );
   i_rBuffer.SetOffset( 0 );
-  boost::asio::async_read(  i_rSocket, AsioBuffer, std::bind( &VCGStreamAsyncReaderWriter::OnBufferBodyRead, ph::_1, ph::_2, i_Handler ) );
+  if( i_pStrand )
+  {
+    boost::asio::async_read(  i_rSocket, AsioBuffer, i_pStrand->wrap( std::bind( &VCGStreamAsyncReaderWriter::OnBufferBodyRead, ph::_1, ph::_2, i_Handler ) ) );
+  }
+  else
+  {
+    boost::asio::async_read(  i_rSocket, AsioBuffer, std::bind( &VCGStreamAsyncReaderWriter::OnBufferBodyRead, ph::_1, ph::_2, i_Handler ) );
+  }
 }
 
 void VCGStreamAsyncReaderWriter::OnBufferBodyRead(    const boost::system::error_code i_Error,
@@ -43,6 +43,15 @@ public:
                             std::function< bool( ViconCGStreamType::Enum, ViconCGStreamType::UInt32 ) > i_VerifyHandler,
                             std::function< void( bool ) > i_Handler );
 
+  /// As ReadBuffer, but each step of the read and the supplied handler are run through the strand,
+  /// so they never run concurrently with other work the caller dispatches on the same strand.
+  /// The strand must also remain valid until the handler is called.
+  static void ReadBuffer(   boost::asio::ip::tcp::socket& i_rSocket,
+                            boost::asio::io_service::strand& i_rStrand,
+                            ViconCGStreamIO::VBuffer& i_rBuffer,
+                            std::function< bool( ViconCGStreamType::Enum, ViconCGStreamType::UInt32 ) > i_VerifyHandler,
+                            std::function< void( bool ) > i_Handler );
+
   /// Asynchronously Write a CGStream block from the buffer to the socket.
   /// Calls the supplied handler with true on success or false on failure.
   /// Note that it is the callers responsibility to ensure that the socket
@@ -70,6 +79,7 @@ private:
   static void OnBufferHeaderRead( const boost::system::error_code i_Error,
                                   const std::size_t i_BytesRead,
                                   boost::asio::ip::tcp::socket& i_rSocket,
+                                  boost::asio::io_service::strand* i_pStrand,
                                   ViconCGStreamIO::VBuffer& i_rBuffer,
                                   std::function< bool( ViconCGStreamType::Enum, ViconCGStreamType::UInt32 ) > i_VerifyHandler,
                                   std::function< void( bool ) > i_Handler );